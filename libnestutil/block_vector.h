@@ -249,6 +249,16 @@ public:
    */
   void clear();
 
+  /**
+   * @brief Allocates all blocks required to hold a given number of elements.
+   * @param n Number of elements.
+   *
+   * Subsequent calls to push_back() fill the allocated blocks without
+   * allocating memory until the BlockVector holds n elements. Blocks
+   * which are not filled are released by clear() and erase().
+   */
+  void reserve( const size_t n );
+
   /**
    * Returns the number of elements in the BlockVector.
    */
@@ -407,8 +417,9 @@ template < typename value_type_ >
 void
 BlockVector< value_type_ >::push_back( const value_type_& value )
 {
-  // If this is the last element in the current block, add another block
-  if ( finish_.block_it_ == finish_.current_block_end_ - 1 )
+  // If this is the last element in the current block and no further block is
+  // reserved, add another block
+  if ( finish_.block_it_ == finish_.current_block_end_ - 1 and finish_.block_vector_it_ + 1 == blockmap_.end() )
   {
     // Need to get the current position here, then recreate the iterator after we extend the blockmap,
     // because after the blockmap is changed the iterator becomes invalid.
@@ -424,8 +435,9 @@ template < typename value_type_ >
 void
 BlockVector< value_type_ >::push_back( value_type_&& value )
 {
-  // If this is the last element in the current block, add another block
-  if ( finish_.block_it_ == finish_.current_block_end_ - 1 )
+  // If this is the last element in the current block and no further block is
+  // reserved, add another block
+  if ( finish_.block_it_ == finish_.current_block_end_ - 1 and finish_.block_vector_it_ + 1 == blockmap_.end() )
   {
     // Need to get the current position here, then recreate the iterator after we extend the blockmap,
     // because after the blockmap is changed the iterator becomes invalid.
@@ -451,6 +463,29 @@ BlockVector< value_type_ >::clear()
   finish_ = begin();
 }
 
+template < typename value_type_ >
+void
+BlockVector< value_type_ >::reserve( const size_t n )
+{
+  // finish_ always points into an allocated block, so one block more than
+  // strictly necessary is needed to hold n elements.
+  const size_t num_blocks_needed = n / max_block_size + 1;
+  if ( num_blocks_needed <= blockmap_.size() )
+  {
+    return;
+  }
+
+  // Blocks are moved when the blockmap is reallocated, so iterators into blocks
+  // stay valid, but the iterator into the blockmap needs to be recreated.
+  const auto current_block = finish_.block_vector_it_ - blockmap_.begin();
+  blockmap_.reserve( num_blocks_needed );
+  while ( blockmap_.size() < num_blocks_needed )
+  {
+    blockmap_.emplace_back( max_block_size );
+  }
+  finish_.block_vector_it_ = blockmap_.begin() + current_block;
+}
+
 template < typename value_type_ >
 inline size_t
 BlockVector< value_type_ >::size() const
@@ -24,13 +24,17 @@
 #define SORT_H
 
 #include <algorithm>
+#include <cassert>
 #include <cstddef>
+#include <cstdint>
+#include <type_traits>
 #include <vector>
 
 // Generated includes:
 #include "config.h"
 
 #include "block_vector.h"
+#include "source.h"
 
 #ifdef HAVE_BOOST
 #include "iterator_pair.h"
@@ -38,6 +42,8 @@
 #endif
 
 #define INSERTION_SORT_CUTOFF 10 // use insertion sort for smaller arrays
+#define RADIX_SORT_CHUNK_SIZE 65536 // elements per task in radix sort
+#define RADIX_SORT_DIGIT_BITS 11     // bits sorted per pass of radix sort
 
 namespace nest
 {
@@ -185,6 +191,200 @@ sort( BlockVector< T1 >& vec_sort, BlockVector< T2 >& vec_perm )
 #endif
 }
 
+/**
+ * Returns the key of an element for radix_sort as unsigned integer with
+ * the same order as the element.
+ */
+template < typename T >
+inline typename std::enable_if< std::is_integral< T >::value, uint64_t >::type
+radix_key_( const T value )
+{
+  // flip the sign bit so that negative values precede positive ones
+  return std::is_signed< T >::value
+    ? static_cast< uint64_t >( static_cast< int64_t >( value ) ) ^ ( static_cast< uint64_t >( 1 ) << 63 )
+    : static_cast< uint64_t >( value );
+}
+
+inline uint64_t
+radix_key_( const Source& source )
+{
+  return source.get_node_id();
+}
+
+/**
+ * Returns the number of bits required to represent value.
+ */
+inline unsigned int
+num_bits_( uint64_t value )
+{
+  unsigned int n = 0;
+  for ( ; value > 0; value >>= 1 )
+  {
+    ++n;
+  }
+  return n;
+}
+
+constexpr size_t radix_num_digits_ = static_cast< size_t >( 1 ) << RADIX_SORT_DIGIT_BITS;
+constexpr uint64_t radix_digit_mask_ = radix_num_digits_ - 1;
+
+/**
+ * Sorts entries of keys in [begin, end) stably by the digit starting at
+ * bit shift and writes them to sorted, where offsets holds the first
+ * position of each digit.
+ */
+inline void
+radix_scatter_( const std::vector< uint64_t >& keys,
+  std::vector< uint64_t >& sorted,
+  std::vector< size_t >& offsets,
+  const size_t begin,
+  const size_t end,
+  const unsigned int shift )
+{
+  for ( size_t i = begin; i < end; ++i )
+  {
+    sorted[ offsets[ ( keys[ i ] >> shift ) & radix_digit_mask_ ]++ ] = keys[ i ];
+  }
+}
+
+/**
+ * Moves entry positions[ i ] of vec to position i.
+ *
+ * Entries are gathered into a temporary vector in order of their new
+ * position and moved back block by block.
+ */
+template < typename T >
+void
+permute_( BlockVector< T >& vec, const std::vector< uint64_t >& positions, const size_t num_chunks )
+{
+  const size_t n = vec.size();
+  std::vector< T > permuted( n );
+#pragma omp taskloop grainsize( 1 ) if ( num_chunks > 1 ) shared( vec, positions, permuted )
+  for ( size_t chunk = 0; chunk < num_chunks; ++chunk )
+  {
+    const size_t end = std::min( n, ( chunk + 1 ) * RADIX_SORT_CHUNK_SIZE );
+    for ( size_t i = chunk * RADIX_SORT_CHUNK_SIZE; i < end; ++i )
+    {
+      permuted[ i ] = std::move( vec[ positions[ i ] ] );
+    }
+  }
+  std::move( permuted.begin(), permuted.end(), vec.begin() );
+}
+
+/**
+ * Least-significant-digit radix sort.
+ *
+ * Sorts the two vectors vec_sort and vec_perm by the entries in vec_sort,
+ * which must be integers or Sources; Sources are sorted by node ID. The sort
+ * is stable.
+ *
+ * Keys relative to the smallest key are packed together with the position
+ * of the entry into one 64-bit integer and sorted in passes over
+ * RADIX_SORT_DIGIT_BITS bits of the key each, skipping bits above the
+ * largest key. Afterwards, vec_sort and vec_perm are permuted according to
+ * the sorted positions one after the other. This requires 16 bytes per
+ * entry for sorting and temporary memory for one copy of the larger of
+ * both vectors for permuting. If key and position do not fit into 64 bits,
+ * nest::sort() is used instead.
+ *
+ * If called inside an OpenMP parallel region, each pass over the keys is
+ * split into tasks of RADIX_SORT_CHUNK_SIZE entries, which threads of the
+ * team that are waiting at a barrier execute. Thus, threads that are done
+ * with their own work help the thread that sorts the largest vector.
+ */
+template < typename T1, typename T2 >
+void
+radix_sort( BlockVector< T1 >& vec_sort, BlockVector< T2 >& vec_perm )
+{
+  const size_t n = vec_sort.size();
+  assert( vec_perm.size() == n );
+  if ( n <= INSERTION_SORT_CUTOFF )
+  {
+    if ( n > 1 )
+    {
+      insertion_sort( vec_sort, vec_perm, 0, n - 1 );
+    }
+    return;
+  }
+
+  uint64_t min_key = radix_key_( vec_sort[ 0 ] );
+  uint64_t max_key = min_key;
+  for ( const auto& entry : vec_sort )
+  {
+    const uint64_t key = radix_key_( entry );
+    min_key = std::min( min_key, key );
+    max_key = std::max( max_key, key );
+  }
+
+  const unsigned int index_bits = num_bits_( n - 1 );
+  const unsigned int key_bits = num_bits_( max_key - min_key );
+  if ( index_bits + key_bits > 64 )
+  {
+    sort( vec_sort, vec_perm );
+    return;
+  }
+
+  const size_t num_chunks = ( n + RADIX_SORT_CHUNK_SIZE - 1 ) / RADIX_SORT_CHUNK_SIZE;
+  std::vector< uint64_t > keys( n );
+#pragma omp taskloop grainsize( 1 ) if ( num_chunks > 1 ) shared( vec_sort, keys )
+  for ( size_t chunk = 0; chunk < num_chunks; ++chunk )
+  {
+    const size_t end = std::min( n, ( chunk + 1 ) * RADIX_SORT_CHUNK_SIZE );
+    for ( size_t i = chunk * RADIX_SORT_CHUNK_SIZE; i < end; ++i )
+    {
+      keys[ i ] = ( ( radix_key_( vec_sort[ i ] ) - min_key ) << index_bits ) | i;
+    }
+  }
+
+  std::vector< uint64_t > sorted( n );
+  std::vector< std::vector< size_t > > offsets( num_chunks, std::vector< size_t >( radix_num_digits_ ) );
+  for ( unsigned int shift = index_bits; shift < index_bits + key_bits; shift += RADIX_SORT_DIGIT_BITS )
+  {
+    // count digits per chunk
+#pragma omp taskloop grainsize( 1 ) if ( num_chunks > 1 ) shared( keys, offsets )
+    for ( size_t chunk = 0; chunk < num_chunks; ++chunk )
+    {
+      std::fill( offsets[ chunk ].begin(), offsets[ chunk ].end(), 0 );
+      const size_t end = std::min( n, ( chunk + 1 ) * RADIX_SORT_CHUNK_SIZE );
+      for ( size_t i = chunk * RADIX_SORT_CHUNK_SIZE; i < end; ++i )
+      {
+        ++offsets[ chunk ][ ( keys[ i ] >> shift ) & radix_digit_mask_ ];
+      }
+    }
+
+    // turn counts into first positions, chunks with the same digit in order
+    size_t pos = 0;
+    for ( size_t digit = 0; digit < radix_num_digits_; ++digit )
+    {
+      for ( size_t chunk = 0; chunk < num_chunks; ++chunk )
+      {
+        const size_t count = offsets[ chunk ][ digit ];
+        offsets[ chunk ][ digit ] = pos;
+        pos += count;
+      }
+    }
+
+#pragma omp taskloop grainsize( 1 ) if ( num_chunks > 1 ) shared( keys, sorted, offsets )
+    for ( size_t chunk = 0; chunk < num_chunks; ++chunk )
+    {
+      const size_t end = std::min( n, ( chunk + 1 ) * RADIX_SORT_CHUNK_SIZE );
+      radix_scatter_( keys, sorted, offsets[ chunk ], chunk * RADIX_SORT_CHUNK_SIZE, end, shift );
+    }
+    keys.swap( sorted );
+  }
+  std::vector< uint64_t >().swap( sorted );
+
+  // keys[ i ] now holds the position of the entry that belongs to position i
+  const uint64_t index_mask = ( static_cast< uint64_t >( 1 ) << index_bits ) - 1;
+  for ( auto& key : keys )
+  {
+    key &= index_mask;
+  }
+
+  permute_( vec_sort, keys, num_chunks );
+  permute_( vec_perm, keys, num_chunks );
+}
+
 } // namespace sort
 
 #endif /* #ifndef SORT_H */
@@ -107,9 +107,7 @@ public:
   /**
    * Default Destructor.
    */
-  ~cont_delay_synapse()
-  {
-  }
+  ~cont_delay_synapse() = default;
 
   // Explicitly declare all methods inherited from the dependent base
   // ConnectionBase. This avoids explicit name prefixes in all places these
@@ -32,6 +32,7 @@
 #include "kernel_manager.h"
 #include "nest_impl.h"
 #include "numerics.h"
+#include "population_kernel_impl.h"
 #include "ring_buffer_impl.h"
 #include "universal_data_logger_impl.h"
 
@@ -371,6 +372,244 @@ iaf_psc_alpha::update( Time const& origin, const long from, const long to )
   }
 }
 
+/* ----------------------------------------------------------------
+ * Population kernel
+ */
+
+class iaf_psc_alpha::Population_ : public GenericPopulationKernel< iaf_psc_alpha >
+{
+public:
+  bool add_node( Node& ) override;
+  void load_state() override;
+  void store_state() override;
+  void update( Time const&, const long, const long ) override;
+
+private:
+  // state variables
+  std::vector< double > y0_;
+  std::vector< double > dI_ex_;
+  std::vector< double > I_ex_;
+  std::vector< double > dI_in_;
+  std::vector< double > I_in_;
+  std::vector< double > y3_;
+  std::vector< int > r_;
+
+  // parameters and propagators
+  std::vector< double > I_e_;
+  std::vector< double > LowerBound_;
+  std::vector< double > Theta_;
+  std::vector< double > V_reset_;
+  std::vector< double > EPSCInitialValue_;
+  std::vector< double > IPSCInitialValue_;
+  std::vector< double > P11_ex_;
+  std::vector< double > P21_ex_;
+  std::vector< double > P22_ex_;
+  std::vector< double > P31_ex_;
+  std::vector< double > P32_ex_;
+  std::vector< double > P11_in_;
+  std::vector< double > P21_in_;
+  std::vector< double > P22_in_;
+  std::vector< double > P31_in_;
+  std::vector< double > P32_in_;
+  std::vector< double > P30_;
+  std::vector< double > expm1_tau_m_;
+  std::vector< int > RefractoryCounts_;
+
+  // input collected from the ring buffers for the current step
+  std::vector< double > spikes_ex_;
+  std::vector< double > spikes_in_;
+  std::vector< double > currents_;
+  std::vector< char > spiked_;
+};
+
+std::unique_ptr< PopulationKernel >
+iaf_psc_alpha::create_population_kernel() const
+{
+  return std::unique_ptr< PopulationKernel >( new Population_() );
+}
+
+bool
+iaf_psc_alpha::get_spike_input_buffer( SpikeInputBuffer& buffer )
+{
+  buffer.bins = B_.input_buffer_.data();
+  buffer.stride = Buffers_::NUM_INPUT_CHANNELS;
+  buffer.excitatory_channel = Buffers_::SYN_EX;
+  buffer.inhibitory_channel = Buffers_::SYN_IN;
+  return true;
+}
+
+bool
+iaf_psc_alpha::Population_::add_node( Node& node )
+{
+  iaf_psc_alpha* n = dynamic_cast< iaf_psc_alpha* >( &node );
+
+  // recording requires access to the node state in every step
+  if ( not n or n->B_.logger_.has_loggers() )
+  {
+    return false;
+  }
+
+  nodes_.push_back( n );
+  return true;
+}
+
+void
+iaf_psc_alpha::Population_::load_state()
+{
+  const size_t n = nodes_.size();
+  for ( auto* v : { &y0_,
+          &dI_ex_,
+          &I_ex_,
+          &dI_in_,
+          &I_in_,
+          &y3_,
+          &I_e_,
+          &LowerBound_,
+          &Theta_,
+          &V_reset_,
+          &EPSCInitialValue_,
+          &IPSCInitialValue_,
+          &P11_ex_,
+          &P21_ex_,
+          &P22_ex_,
+          &P31_ex_,
+          &P32_ex_,
+          &P11_in_,
+          &P21_in_,
+          &P22_in_,
+          &P31_in_,
+          &P32_in_,
+          &P30_,
+          &expm1_tau_m_,
+          &spikes_ex_,
+          &spikes_in_,
+          &currents_ } )
+  {
+    v->resize( n );
+  }
+  r_.resize( n );
+  RefractoryCounts_.resize( n );
+  spiked_.resize( n );
+
+  for ( size_t i = 0; i < n; ++i )
+  {
+    const iaf_psc_alpha& node = *nodes_[ i ];
+
+    y0_[ i ] = node.S_.y0_;
+    dI_ex_[ i ] = node.S_.dI_ex_;
+    I_ex_[ i ] = node.S_.I_ex_;
+    dI_in_[ i ] = node.S_.dI_in_;
+    I_in_[ i ] = node.S_.I_in_;
+    y3_[ i ] = node.S_.y3_;
+    r_[ i ] = node.S_.r_;
+
+    I_e_[ i ] = node.P_.I_e_;
+    LowerBound_[ i ] = node.P_.LowerBound_;
+    Theta_[ i ] = node.P_.Theta_;
+    V_reset_[ i ] = node.P_.V_reset_;
+    EPSCInitialValue_[ i ] = node.V_.EPSCInitialValue_;
+    IPSCInitialValue_[ i ] = node.V_.IPSCInitialValue_;
+    P11_ex_[ i ] = node.V_.P11_ex_;
+    P21_ex_[ i ] = node.V_.P21_ex_;
+    P22_ex_[ i ] = node.V_.P22_ex_;
+    P31_ex_[ i ] = node.V_.P31_ex_;
+    P32_ex_[ i ] = node.V_.P32_ex_;
+    P11_in_[ i ] = node.V_.P11_in_;
+    P21_in_[ i ] = node.V_.P21_in_;
+    P22_in_[ i ] = node.V_.P22_in_;
+    P31_in_[ i ] = node.V_.P31_in_;
+    P32_in_[ i ] = node.V_.P32_in_;
+    P30_[ i ] = node.V_.P30_;
+    expm1_tau_m_[ i ] = node.V_.expm1_tau_m_;
+    RefractoryCounts_[ i ] = node.V_.RefractoryCounts_;
+  }
+}
+
+void
+iaf_psc_alpha::Population_::store_state()
+{
+  for ( size_t i = 0; i < nodes_.size(); ++i )
+  {
+    iaf_psc_alpha& node = *nodes_[ i ];
+
+    node.S_.y0_ = y0_[ i ];
+    node.S_.dI_ex_ = dI_ex_[ i ];
+    node.S_.I_ex_ = I_ex_[ i ];
+    node.S_.dI_in_ = dI_in_[ i ];
+    node.S_.I_in_ = I_in_[ i ];
+    node.S_.y3_ = y3_[ i ];
+    node.S_.r_ = r_[ i ];
+  }
+}
+
+void
+iaf_psc_alpha::Population_::update( Time const& origin, const long from, const long to )
+{
+  const size_t n = nodes_.size();
+
+  double* const y0 = y0_.data();
+  double* const dI_ex = dI_ex_.data();
+  double* const I_ex = I_ex_.data();
+  double* const dI_in = dI_in_.data();
+  double* const I_in = I_in_.data();
+  double* const y3 = y3_.data();
+  int* const r = r_.data();
+  char* const spiked = spiked_.data();
+
+  for ( long lag = from; lag < to; ++lag )
+  {
+    // gather input from the ring buffers of the individual nodes
+    const size_t input_buffer_slot = kernel().event_delivery_manager.get_modulo( lag );
+    for ( size_t i = 0; i < n; ++i )
+    {
+      auto& input_buffer = nodes_[ i ]->B_.input_buffer_;
+      auto& input = input_buffer.get_values_all_channels( input_buffer_slot );
+      spikes_ex_[ i ] = input[ Buffers_::SYN_EX ];
+      spikes_in_[ i ] = input[ Buffers_::SYN_IN ];
+      currents_[ i ] = input[ Buffers_::I0 ];
+      input_buffer.reset_values_all_channels( input_buffer_slot );
+    }
+
+    // Same arithmetic as iaf_psc_alpha::update(), with branches replaced by
+    // selections so that the loop can be vectorized.
+#pragma omp simd
+    for ( size_t i = 0; i < n; ++i )
+    {
+      const bool not_refractory = r[ i ] == 0;
+      double y3_new = P30_[ i ] * ( y0[ i ] + I_e_[ i ] ) + P31_ex_[ i ] * dI_ex[ i ] + P32_ex_[ i ] * I_ex[ i ]
+        + P31_in_[ i ] * dI_in[ i ] + P32_in_[ i ] * I_in[ i ] + expm1_tau_m_[ i ] * y3[ i ] + y3[ i ];
+      y3_new = ( y3_new < LowerBound_[ i ] ? LowerBound_[ i ] : y3_new );
+      y3[ i ] = not_refractory ? y3_new : y3[ i ];
+      r[ i ] = not_refractory ? r[ i ] : r[ i ] - 1;
+
+      I_ex[ i ] = P21_ex_[ i ] * dI_ex[ i ] + P22_ex_[ i ] * I_ex[ i ];
+      dI_ex[ i ] *= P11_ex_[ i ];
+      dI_ex[ i ] += EPSCInitialValue_[ i ] * spikes_ex_[ i ];
+
+      I_in[ i ] = P21_in_[ i ] * dI_in[ i ] + P22_in_[ i ] * I_in[ i ];
+      dI_in[ i ] *= P11_in_[ i ];
+      dI_in[ i ] += IPSCInitialValue_[ i ] * spikes_in_[ i ];
+
+      const bool spike = y3[ i ] >= Theta_[ i ];
+      r[ i ] = spike ? RefractoryCounts_[ i ] : r[ i ];
+      y3[ i ] = spike ? V_reset_[ i ] : y3[ i ];
+      spiked[ i ] = spike;
+
+      y0[ i ] = currents_[ i ];
+    }
+
+    for ( size_t i = 0; i < n; ++i )
+    {
+      if ( spiked[ i ] )
+      {
+        register_spike_( i, lag );
+      }
+    }
+  }
+
+  send_spikes_( origin );
+}
+
 void
 iaf_psc_alpha::handle( SpikeEvent& e )
 {
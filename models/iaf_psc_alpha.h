@@ -244,6 +244,12 @@ private:
 
   void update( Time const&, const long, const long ) override;
 
+  std::unique_ptr< PopulationKernel > create_population_kernel() const override;
+  bool get_spike_input_buffer( SpikeInputBuffer& ) override;
+
+  //! Batched update of consecutive iaf_psc_alpha nodes, see PopulationKernel
+  class Population_;
+
   // The next two classes need to be friends to access the State_ class/member
   friend class RecordablesMap< iaf_psc_alpha >;
   friend class UniversalDataLogger< iaf_psc_alpha >;
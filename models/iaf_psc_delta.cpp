@@ -35,6 +35,7 @@
 #include "exceptions.h"
 #include "kernel_manager.h"
 #include "nest_impl.h"
+#include "population_kernel_impl.h"
 #include "universal_data_logger_impl.h"
 
 // Includes from sli:
@@ -331,6 +332,166 @@ nest::iaf_psc_delta::update( Time const& origin, const long from, const long to
   }
 }
 
+/* ----------------------------------------------------------------
+ * Population kernel
+ */
+
+class iaf_psc_delta::Population_ : public GenericPopulationKernel< iaf_psc_delta >
+{
+public:
+  bool add_node( Node& ) override;
+  void load_state() override;
+  void store_state() override;
+  void update( Time const&, const long, const long ) override;
+
+private:
+  // state variables
+  std::vector< double > y0_;
+  std::vector< double > y3_;
+  std::vector< int > r_;
+
+  // parameters and propagators
+  std::vector< double > I_e_;
+  std::vector< double > V_th_;
+  std::vector< double > V_min_;
+  std::vector< double > V_reset_;
+  std::vector< double > P30_;
+  std::vector< double > P33_;
+  std::vector< int > RefractoryCounts_;
+
+  // input collected from the ring buffers for the current step
+  std::vector< double > spikes_;
+  std::vector< double > currents_;
+  std::vector< char > spiked_;
+};
+
+std::unique_ptr< PopulationKernel >
+iaf_psc_delta::create_population_kernel() const
+{
+  return std::unique_ptr< PopulationKernel >( new Population_() );
+}
+
+bool
+iaf_psc_delta::get_spike_input_buffer( SpikeInputBuffer& buffer )
+{
+  buffer.bins = B_.spikes_.data();
+  buffer.stride = 1;
+  buffer.excitatory_channel = 0;
+  buffer.inhibitory_channel = 0;
+  return true;
+}
+
+bool
+iaf_psc_delta::Population_::add_node( Node& node )
+{
+  iaf_psc_delta* n = dynamic_cast< iaf_psc_delta* >( &node );
+
+  // recording requires access to the node state in every step, input during
+  // refractoriness requires per-node exponentials
+  if ( not n or n->B_.logger_.has_loggers() or n->P_.with_refr_input_ )
+  {
+    return false;
+  }
+
+  nodes_.push_back( n );
+  return true;
+}
+
+void
+iaf_psc_delta::Population_::load_state()
+{
+  const size_t n = nodes_.size();
+  for ( auto* v : { &y0_, &y3_, &I_e_, &V_th_, &V_min_, &V_reset_, &P30_, &P33_, &spikes_, &currents_ } )
+  {
+    v->resize( n );
+  }
+  r_.resize( n );
+  RefractoryCounts_.resize( n );
+  spiked_.resize( n );
+
+  for ( size_t i = 0; i < n; ++i )
+  {
+    const iaf_psc_delta& node = *nodes_[ i ];
+
+    y0_[ i ] = node.S_.y0_;
+    y3_[ i ] = node.S_.y3_;
+    r_[ i ] = node.S_.r_;
+
+    I_e_[ i ] = node.P_.I_e_;
+    V_th_[ i ] = node.P_.V_th_;
+    V_min_[ i ] = node.P_.V_min_;
+    V_reset_[ i ] = node.P_.V_reset_;
+    P30_[ i ] = node.V_.P30_;
+    P33_[ i ] = node.V_.P33_;
+    RefractoryCounts_[ i ] = node.V_.RefractoryCounts_;
+  }
+}
+
+void
+iaf_psc_delta::Population_::store_state()
+{
+  for ( size_t i = 0; i < nodes_.size(); ++i )
+  {
+    iaf_psc_delta& node = *nodes_[ i ];
+
+    node.S_.y0_ = y0_[ i ];
+    node.S_.y3_ = y3_[ i ];
+    node.S_.r_ = r_[ i ];
+  }
+}
+
+void
+iaf_psc_delta::Population_::update( Time const& origin, const long from, const long to )
+{
+  const size_t n = nodes_.size();
+
+  double* const y0 = y0_.data();
+  double* const y3 = y3_.data();
+  int* const r = r_.data();
+  char* const spiked = spiked_.data();
+
+  for ( long lag = from; lag < to; ++lag )
+  {
+    // gather input from the ring buffers of the individual nodes; reading
+    // clears the buffer entry, spikes arriving during refractoriness are
+    // ignored below
+    for ( size_t i = 0; i < n; ++i )
+    {
+      spikes_[ i ] = nodes_[ i ]->B_.spikes_.get_value( lag );
+      currents_[ i ] = nodes_[ i ]->B_.currents_.get_value( lag );
+    }
+
+    // Same arithmetic as iaf_psc_delta::update(), with branches replaced by
+    // selections so that the loop can be vectorized.
+#pragma omp simd
+    for ( size_t i = 0; i < n; ++i )
+    {
+      const bool not_refractory = r[ i ] == 0;
+      double y3_new = P30_[ i ] * ( y0[ i ] + I_e_[ i ] ) + P33_[ i ] * y3[ i ] + spikes_[ i ];
+      y3_new = ( y3_new < V_min_[ i ] ? V_min_[ i ] : y3_new );
+      y3[ i ] = not_refractory ? y3_new : y3[ i ];
+      r[ i ] = not_refractory ? r[ i ] : r[ i ] - 1;
+
+      const bool spike = y3[ i ] >= V_th_[ i ];
+      r[ i ] = spike ? RefractoryCounts_[ i ] : r[ i ];
+      y3[ i ] = spike ? V_reset_[ i ] : y3[ i ];
+      spiked[ i ] = spike;
+
+      y0[ i ] = currents_[ i ];
+    }
+
+    for ( size_t i = 0; i < n; ++i )
+    {
+      if ( spiked[ i ] )
+      {
+        register_spike_( i, lag );
+      }
+    }
+  }
+
+  send_spikes_( origin );
+}
+
 void
 nest::iaf_psc_delta::handle( SpikeEvent& e )
 {
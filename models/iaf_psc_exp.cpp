@@ -34,6 +34,7 @@
 #include "kernel_manager.h"
 #include "nest_impl.h"
 #include "numerics.h"
+#include "population_kernel_impl.h"
 #include "ring_buffer_impl.h"
 #include "universal_data_logger_impl.h"
 
@@ -350,6 +351,218 @@ nest::iaf_psc_exp::update( const Time& origin, const long from, const long to )
   }
 }
 
+/* ----------------------------------------------------------------
+ * Population kernel
+ * ---------------------------------------------------------------- */
+
+class nest::iaf_psc_exp::Population_ : public GenericPopulationKernel< iaf_psc_exp >
+{
+public:
+  bool add_node( Node& ) override;
+  void load_state() override;
+  void store_state() override;
+  void update( const Time&, const long, const long ) override;
+
+private:
+  // state variables
+  std::vector< double > i_0_;
+  std::vector< double > i_1_;
+  std::vector< double > i_syn_ex_;
+  std::vector< double > i_syn_in_;
+  std::vector< double > V_m_;
+  std::vector< int > r_ref_;
+
+  // parameters and propagators
+  std::vector< double > I_e_;
+  std::vector< double > Theta_;
+  std::vector< double > V_reset_;
+  std::vector< double > P20_;
+  std::vector< double > P11ex_;
+  std::vector< double > P11in_;
+  std::vector< double > P21ex_;
+  std::vector< double > P21in_;
+  std::vector< double > P22_;
+  std::vector< int > RefractoryCounts_;
+
+  // input collected from the ring buffers for the current step
+  std::vector< double > spikes_ex_;
+  std::vector< double > spikes_in_;
+  std::vector< double > currents_0_;
+  std::vector< double > currents_1_;
+  std::vector< char > spiked_;
+};
+
+std::unique_ptr< nest::PopulationKernel >
+nest::iaf_psc_exp::create_population_kernel() const
+{
+  return std::unique_ptr< PopulationKernel >( new Population_() );
+}
+
+bool
+nest::iaf_psc_exp::get_spike_input_buffer( SpikeInputBuffer& buffer )
+{
+  buffer.bins = B_.input_buffer_.data();
+  buffer.stride = Buffers_::NUM_INPUT_CHANNELS;
+  buffer.excitatory_channel = Buffers_::SYN_EX;
+  buffer.inhibitory_channel = Buffers_::SYN_IN;
+  return true;
+}
+
+bool
+nest::iaf_psc_exp::Population_::add_node( Node& node )
+{
+  iaf_psc_exp* n = dynamic_cast< iaf_psc_exp* >( &node );
+
+  // recording requires access to the node state in every step, stochastic
+  // spiking draws random numbers in node order
+  if ( not n or n->B_.logger_.has_loggers() or not( n->P_.delta_ < 1e-10 ) )
+  {
+    return false;
+  }
+
+  nodes_.push_back( n );
+  return true;
+}
+
+void
+nest::iaf_psc_exp::Population_::load_state()
+{
+  const size_t n = nodes_.size();
+  for ( auto* v : { &i_0_,
+          &i_1_,
+          &i_syn_ex_,
+          &i_syn_in_,
+          &V_m_,
+          &I_e_,
+          &Theta_,
+          &V_reset_,
+          &P20_,
+          &P11ex_,
+          &P11in_,
+          &P21ex_,
+          &P21in_,
+          &P22_,
+          &spikes_ex_,
+          &spikes_in_,
+          &currents_0_,
+          &currents_1_ } )
+  {
+    v->resize( n );
+  }
+  r_ref_.resize( n );
+  RefractoryCounts_.resize( n );
+  spiked_.resize( n );
+
+  for ( size_t i = 0; i < n; ++i )
+  {
+    const iaf_psc_exp& node = *nodes_[ i ];
+
+    i_0_[ i ] = node.S_.i_0_;
+    i_1_[ i ] = node.S_.i_1_;
+    i_syn_ex_[ i ] = node.S_.i_syn_ex_;
+    i_syn_in_[ i ] = node.S_.i_syn_in_;
+    V_m_[ i ] = node.S_.V_m_;
+    r_ref_[ i ] = node.S_.r_ref_;
+
+    I_e_[ i ] = node.P_.I_e_;
+    Theta_[ i ] = node.P_.Theta_;
+    V_reset_[ i ] = node.P_.V_reset_;
+    P20_[ i ] = node.V_.P20_;
+    P11ex_[ i ] = node.V_.P11ex_;
+    P11in_[ i ] = node.V_.P11in_;
+    P21ex_[ i ] = node.V_.P21ex_;
+    P21in_[ i ] = node.V_.P21in_;
+    P22_[ i ] = node.V_.P22_;
+    RefractoryCounts_[ i ] = node.V_.RefractoryCounts_;
+  }
+}
+
+void
+nest::iaf_psc_exp::Population_::store_state()
+{
+  for ( size_t i = 0; i < nodes_.size(); ++i )
+  {
+    iaf_psc_exp& node = *nodes_[ i ];
+
+    node.S_.i_0_ = i_0_[ i ];
+    node.S_.i_1_ = i_1_[ i ];
+    node.S_.i_syn_ex_ = i_syn_ex_[ i ];
+    node.S_.i_syn_in_ = i_syn_in_[ i ];
+    node.S_.V_m_ = V_m_[ i ];
+    node.S_.r_ref_ = r_ref_[ i ];
+  }
+}
+
+void
+nest::iaf_psc_exp::Population_::update( const Time& origin, const long from, const long to )
+{
+  const size_t n = nodes_.size();
+
+  double* const i_0 = i_0_.data();
+  double* const i_1 = i_1_.data();
+  double* const i_syn_ex = i_syn_ex_.data();
+  double* const i_syn_in = i_syn_in_.data();
+  double* const V_m = V_m_.data();
+  int* const r_ref = r_ref_.data();
+  char* const spiked = spiked_.data();
+
+  for ( long lag = from; lag < to; ++lag )
+  {
+    // gather input from the ring buffers of the individual nodes
+    const size_t input_buffer_slot = kernel().event_delivery_manager.get_modulo( lag );
+    for ( size_t i = 0; i < n; ++i )
+    {
+      auto& input_buffer = nodes_[ i ]->B_.input_buffer_;
+      auto& input = input_buffer.get_values_all_channels( input_buffer_slot );
+      spikes_ex_[ i ] = input[ Buffers_::SYN_EX ];
+      spikes_in_[ i ] = input[ Buffers_::SYN_IN ];
+      currents_0_[ i ] = input[ Buffers_::I0 ];
+      currents_1_[ i ] = input[ Buffers_::I1 ];
+      input_buffer.reset_values_all_channels( input_buffer_slot );
+    }
+
+    // Same arithmetic as iaf_psc_exp::update(), with branches replaced by
+    // selections so that the loop can be vectorized.
+#pragma omp simd
+    for ( size_t i = 0; i < n; ++i )
+    {
+      const bool not_refractory = r_ref[ i ] == 0;
+      const double V_m_new = V_m[ i ] * P22_[ i ] + i_syn_ex[ i ] * P21ex_[ i ] + i_syn_in[ i ] * P21in_[ i ]
+        + ( I_e_[ i ] + i_0[ i ] ) * P20_[ i ];
+      V_m[ i ] = not_refractory ? V_m_new : V_m[ i ];
+      r_ref[ i ] = not_refractory ? r_ref[ i ] : r_ref[ i ] - 1;
+
+      // exponential decaying PSCs
+      i_syn_ex[ i ] *= P11ex_[ i ];
+      i_syn_in[ i ] *= P11in_[ i ];
+
+      // add evolution of presynaptic input current
+      i_syn_ex[ i ] += ( 1. - P11ex_[ i ] ) * i_1[ i ];
+
+      i_syn_ex[ i ] += spikes_ex_[ i ];
+      i_syn_in[ i ] += spikes_in_[ i ];
+
+      const bool spike = V_m[ i ] >= Theta_[ i ];
+      r_ref[ i ] = spike ? RefractoryCounts_[ i ] : r_ref[ i ];
+      V_m[ i ] = spike ? V_reset_[ i ] : V_m[ i ];
+      spiked[ i ] = spike;
+
+      i_0[ i ] = currents_0_[ i ];
+      i_1[ i ] = currents_1_[ i ];
+    }
+
+    for ( size_t i = 0; i < n; ++i )
+    {
+      if ( spiked[ i ] )
+      {
+        register_spike_( i, lag );
+      }
+    }
+  }
+
+  send_spikes_( origin );
+}
+
 void
 nest::iaf_psc_exp::handle( SpikeEvent& e )
 {
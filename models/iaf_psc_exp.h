@@ -286,6 +286,12 @@ private:
 
   void update( const Time&, const long, const long ) override;
 
+  std::unique_ptr< PopulationKernel > create_population_kernel() const override;
+  bool get_spike_input_buffer( SpikeInputBuffer& ) override;
+
+  //! Batched update of consecutive iaf_psc_exp nodes, see PopulationKernel
+  class Population_;
+
   // intensity function
   double phi_() const;
 
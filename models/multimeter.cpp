@@ -205,12 +205,16 @@ multimeter::update( Time const& origin, const long from, const long )
   // We send a request to each of our targets.
   // The target then immediately returns a DataLoggingReply event,
   // which is caught by multimeter::handle(), which in turn
-  // ensures that the event is recorded.
+  // adds the data to the block of samples of this slice.
   // handle() has access to request_, so it knows what we asked for.
   //
   // Note that not all nodes receiving the request will necessarily answer.
+  B_.senders_.clear();
   DataLoggingRequest req;
   kernel().event_delivery_manager.send( *this, req );
+
+  // All replies have been received, so the block is complete
+  write_block_();
 }
 
 void
@@ -219,6 +223,65 @@ multimeter::handle( DataLoggingReply& reply )
   // easy access to relevant information
   DataLoggingReply::Container const& info = reply.get_info();
 
+  // invalid samples at the end of the reply are marked by time stamp -inf
+  size_t num_samples = 0;
+  while ( num_samples < info.size() and info[ num_samples ].timestamp.is_finite() )
+  {
+    ++num_samples;
+  }
+
+  if ( B_.senders_.empty() )
+  {
+    // the first reply of the slice defines the time stamps of the block
+    B_.sample_times_.clear();
+    for ( size_t j = 0; j < num_samples; ++j )
+    {
+      B_.sample_times_.push_back( info[ j ].timestamp );
+    }
+    B_.rows_.resize( num_samples );
+    for ( auto& row : B_.rows_ )
+    {
+      row.clear();
+    }
+  }
+  else if ( not has_sample_times_( info, num_samples ) )
+  {
+    // Nodes that were frozen or created during the simulation may
+    // reply with different time stamps and cannot be added to the block
+    write_reply_( reply );
+    return;
+  }
+
+  for ( size_t j = 0; j < num_samples; ++j )
+  {
+    B_.rows_[ j ].insert( B_.rows_[ j ].end(), info[ j ].data.begin(), info[ j ].data.end() );
+  }
+  B_.senders_.push_back( reply.get_sender_node_id() );
+}
+
+bool
+multimeter::has_sample_times_( const DataLoggingReply::Container& info, const size_t num_samples ) const
+{
+  if ( num_samples != B_.sample_times_.size() )
+  {
+    return false;
+  }
+
+  for ( size_t j = 0; j < num_samples; ++j )
+  {
+    if ( info[ j ].timestamp != B_.sample_times_[ j ] )
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+void
+multimeter::write_reply_( DataLoggingReply& reply )
+{
+  DataLoggingReply::Container const& info = reply.get_info();
+
   // record all data, time point by time point
   for ( size_t j = 0; j < info.size(); ++j )
   {
@@ -238,6 +301,35 @@ multimeter::handle( DataLoggingReply& reply )
   }
 }
 
+void
+multimeter::write_block_()
+{
+  if ( B_.senders_.empty() )
+  {
+    return;
+  }
+
+  // keep only the time stamps within the recording window
+  B_.block_.clear();
+  size_t num_active = 0;
+  for ( size_t j = 0; j < B_.sample_times_.size(); ++j )
+  {
+    if ( is_active( B_.sample_times_[ j ] ) )
+    {
+      B_.sample_times_[ num_active++ ] = B_.sample_times_[ j ];
+      B_.block_.insert( B_.block_.end(), B_.rows_[ j ].begin(), B_.rows_[ j ].end() );
+    }
+  }
+  B_.sample_times_.erase( B_.sample_times_.begin() + num_active, B_.sample_times_.end() );
+
+  if ( num_active > 0 )
+  {
+    write_samples( B_.sample_times_, B_.senders_, B_.block_ );
+  }
+
+  B_.senders_.clear();
+}
+
 RecordingDevice::Type
 multimeter::get_type() const
 {
@@ -111,6 +111,14 @@ neurons to `mm`.
    ``record_from`` property is already set to record the variable ``V_m``
    from the neurons it is connected to.
 
+The ``multimeter`` hands all samples it collects on one thread during a
+time slice to the recording backend at once. Recorded events are thus
+ordered by time first and by sender second within each time slice, i.e.,
+the samples of all neurons taken at the same time follow each other. In
+earlier versions of NEST, the events of each time slice were grouped by
+sender instead. Scripts that rely on a particular order of the events
+should sort them by ``times`` and ``senders`` explicitly.
+
 .. include:: ../models/recording_device.rst
 
 record_from
@@ -190,13 +198,27 @@ protected:
    * This function pages all its targets at all pertinent sample
    * points for membrane potential information and then outputs
    * that information. The sampled nodes must provide data from
-   * the previous time slice.
+   * the previous time slice. The replies of all targets are
+   * gathered into a single block, which is handed to the recording
+   * backend in one call.
    */
   void update( Time const&, const long, const long ) override;
 
 private:
   struct Buffers_;
 
+  /**
+   * Check whether the valid samples of a reply have the time stamps of
+   * the samples collected so far in the current slice.
+   */
+  bool has_sample_times_( const DataLoggingReply::Container&, size_t num_samples ) const;
+
+  //! Write the samples of a reply one by one
+  void write_reply_( DataLoggingReply& );
+
+  //! Hand the samples collected in the current slice to the backend in one block
+  void write_block_();
+
   struct Parameters_
   {
     Time interval_;                   //!< recording interval, in ms
@@ -222,6 +244,18 @@ private:
     Buffers_();
 
     bool has_targets_;
+
+    //! Time stamps of the samples collected in the current slice
+    std::vector< Time > sample_times_;
+
+    //! Node IDs of the nodes whose samples are collected in the current slice
+    std::vector< size_t > senders_;
+
+    //! Samples collected in the current slice, one row of sender × value per time stamp
+    std::vector< std::vector< double > > rows_;
+
+    //! Samples of the current slice in the order time × sender × value
+    std::vector< double > block_;
   };
 
   // ------------------------------------------------------------
@@ -23,6 +23,10 @@
 #ifndef STATICSYNAPSE_H
 #define STATICSYNAPSE_H
 
+// C++ includes:
+#include <utility>
+#include <vector>
+
 // Includes from nestkernel:
 #include "connection.h"
 
@@ -74,7 +78,7 @@ public:
 
   static constexpr ConnectionModelProperties properties = ConnectionModelProperties::HAS_DELAY
     | ConnectionModelProperties::IS_PRIMARY | ConnectionModelProperties::SUPPORTS_HPC
-    | ConnectionModelProperties::SUPPORTS_LBL;
+    | ConnectionModelProperties::SUPPORTS_LBL | ConnectionModelProperties::IS_STATIC;
 
   /**
    * Default Constructor.
@@ -168,10 +172,22 @@ public:
     return true;
   }
 
+  //! Weight transmitted by send()
+  double
+  get_transmitted_weight( const CommonSynapseProperties& ) const
+  {
+    return weight_;
+  }
+
   void get_status( DictionaryDatum& d ) const;
 
   void set_status( const DictionaryDatum& d, ConnectorModel& cm );
 
+  /**
+   * Typed getters of the parameters, used by get_connection_columns().
+   */
+  static const std::vector< std::pair< Name, ParameterGetter< static_synapse > > >& get_parameter_getters();
+
   double
   get_weight()
   {
@@ -206,6 +222,16 @@ static_synapse< targetidentifierT >::set_status( const DictionaryDatum& d, Conne
   updateValue< double >( d, names::weight, weight_ );
 }
 
+template < typename targetidentifierT >
+const std::vector< std::pair< Name, ParameterGetter< static_synapse< targetidentifierT > > > >&
+static_synapse< targetidentifierT >::get_parameter_getters()
+{
+  static const std::vector< std::pair< Name, ParameterGetter< static_synapse > > > getters = {
+    { names::weight, []( const static_synapse& c ) { return c.weight_; } }
+  };
+  return getters;
+}
+
 } // namespace
 
 #endif /* #ifndef STATICSYNAPSE_H */
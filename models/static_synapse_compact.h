@@ -0,0 +1,229 @@
+/*
+ *  static_synapse_compact.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef STATIC_SYNAPSE_COMPACT_H
+#define STATIC_SYNAPSE_COMPACT_H
+
+// Includes from nestkernel:
+#include "connection.h"
+#include "target_identifier.h"
+
+// Includes from models:
+#include "static_synapse.h"
+
+namespace nest
+{
+
+/* BeginUserDocs: synapse, static
+
+Short description
++++++++++++++++++
+
+Static synapse with single-precision weight and compact target identifier
+
+Description
++++++++++++
+
+``static_synapse_compact`` behaves like ``static_synapse``, but requires less
+memory per connection. It stores the weight in single precision and identifies
+the target by its thread-local index, as the ``_hpc`` variants of synapse models
+do. It therefore has the same restrictions as these variants: targets must
+be addressed via receptor port 0 and there may be at most 65535 nodes per thread.
+
+The weight is rounded to single precision (about seven significant decimal
+digits) when it is set. ``GetConnections`` and ``GetStatus`` report the rounded
+weight.
+
+The number of bytes saved by compact synapse models on a rank is reported by the
+kernel attribute ``compact_synapse_memory_saved``.
+
+Transmits
++++++++++
+
+SpikeEvent, RateEvent, CurrentEvent, ConductanceEvent,
+DoubleDataEvent, DataLoggingRequest
+
+See also
+++++++++
+
+static_synapse, static_synapse_quantized
+
+Examples using this model
++++++++++++++++++++++++++
+
+.. listexamples:: static_synapse_compact
+
+EndUserDocs */
+
+void register_static_synapse_compact( const std::string& name );
+
+template < typename targetidentifierT >
+class static_synapse_compact : public Connection< targetidentifierT >
+{
+  float weight_;
+
+public:
+  // this line determines which common properties to use
+  typedef CommonSynapseProperties CommonPropertiesType;
+  typedef Connection< targetidentifierT > ConnectionBase;
+
+  static constexpr ConnectionModelProperties properties = ConnectionModelProperties::HAS_DELAY
+    | ConnectionModelProperties::IS_PRIMARY | ConnectionModelProperties::IS_STATIC
+    | ConnectionModelProperties::IS_COMPACT;
+
+  //! Size of the connection replaced by this model, see ConnectorModel::get_memory_saved_per_connection()
+  static constexpr size_t size_of_full_synapse = sizeof( static_synapse< TargetIdentifierPtrRport > );
+
+  static_synapse_compact()
+    : ConnectionBase()
+    , weight_( 1.0 )
+  {
+  }
+
+  static_synapse_compact( const static_synapse_compact& rhs ) = default;
+  static_synapse_compact& operator=( const static_synapse_compact& rhs ) = default;
+
+  // Explicitly declare all methods inherited from the dependent base
+  // ConnectionBase. This avoids explicit name prefixes in all places these
+  // functions are used. Since ConnectionBase depends on the template parameter,
+  // they are not automatically found in the base class.
+  using ConnectionBase::get_delay_steps;
+  using ConnectionBase::get_rport;
+  using ConnectionBase::get_target;
+
+  class ConnTestDummyNode : public ConnTestDummyNodeBase
+  {
+  public:
+    // Ensure proper overriding of overloaded virtual functions.
+    // Return values from functions are ignored.
+    using ConnTestDummyNodeBase::handles_test_event;
+    size_t
+    handles_test_event( SpikeEvent&, size_t ) override
+    {
+      return invalid_port;
+    }
+    size_t
+    handles_test_event( RateEvent&, size_t ) override
+    {
+      return invalid_port;
+    }
+    size_t
+    handles_test_event( DataLoggingRequest&, size_t ) override
+    {
+      return invalid_port;
+    }
+    size_t
+    handles_test_event( CurrentEvent&, size_t ) override
+    {
+      return invalid_port;
+    }
+    size_t
+    handles_test_event( ConductanceEvent&, size_t ) override
+    {
+      return invalid_port;
+    }
+    size_t
+    handles_test_event( DoubleDataEvent&, size_t ) override
+    {
+      return invalid_port;
+    }
+    size_t
+    handles_test_event( DSSpikeEvent&, size_t ) override
+    {
+      return invalid_port;
+    }
+    size_t
+    handles_test_event( DSCurrentEvent&, size_t ) override
+    {
+      return invalid_port;
+    }
+  };
+
+  void
+  check_connection( Node& s, Node& t, size_t receptor_type, const CommonPropertiesType& )
+  {
+    ConnTestDummyNode dummy_target;
+    ConnectionBase::check_connection_( dummy_target, s, t, receptor_type );
+  }
+
+  bool
+  send( Event& e, const size_t tid, const CommonSynapseProperties& )
+  {
+    e.set_weight( weight_ );
+    e.set_delay_steps( get_delay_steps() );
+    e.set_receiver( *get_target( tid ) );
+    e.set_rport( get_rport() );
+    e();
+    return true;
+  }
+
+  //! Weight transmitted by send()
+  double
+  get_transmitted_weight( const CommonSynapseProperties& ) const
+  {
+    return weight_;
+  }
+
+  void get_status( DictionaryDatum& d ) const;
+
+  void set_status( const DictionaryDatum& d, ConnectorModel& cm );
+
+  double
+  get_weight()
+  {
+    return weight_;
+  }
+
+  void
+  set_weight( double w )
+  {
+    weight_ = w;
+  }
+};
+
+template < typename targetidentifierT >
+constexpr ConnectionModelProperties static_synapse_compact< targetidentifierT >::properties;
+
+template < typename targetidentifierT >
+void
+static_synapse_compact< targetidentifierT >::get_status( DictionaryDatum& d ) const
+{
+  ConnectionBase::get_status( d );
+  def< double >( d, names::weight, weight_ );
+  def< long >( d, names::size_of, sizeof( *this ) );
+}
+
+template < typename targetidentifierT >
+void
+static_synapse_compact< targetidentifierT >::set_status( const DictionaryDatum& d, ConnectorModel& cm )
+{
+  ConnectionBase::set_status( d, cm );
+  double weight = weight_;
+  if ( updateValue< double >( d, names::weight, weight ) )
+  {
+    set_weight( weight );
+  }
+}
+
+} // namespace
+
+#endif /* #ifndef STATIC_SYNAPSE_COMPACT_H */
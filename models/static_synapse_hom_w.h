@@ -87,7 +87,7 @@ public:
 
   static constexpr ConnectionModelProperties properties = ConnectionModelProperties::HAS_DELAY
     | ConnectionModelProperties::IS_PRIMARY | ConnectionModelProperties::SUPPORTS_HPC
-    | ConnectionModelProperties::SUPPORTS_LBL;
+    | ConnectionModelProperties::SUPPORTS_LBL | ConnectionModelProperties::IS_STATIC;
 
   class ConnTestDummyNode : public ConnTestDummyNodeBase
   {
@@ -178,6 +178,13 @@ public:
     return true;
   }
 
+  //! Weight transmitted by send()
+  double
+  get_transmitted_weight( const CommonPropertiesHomW& cp ) const
+  {
+    return cp.get_weight();
+  }
+
   void
   set_weight( double )
   {
@@ -0,0 +1,94 @@
+/*
+ *  static_synapse_quantized.cpp
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "static_synapse_quantized.h"
+
+// C++ includes:
+#include <cmath>
+#include <limits>
+
+// Includes from libnestutil:
+#include "compose.hpp"
+
+// Includes from nestkernel:
+#include "nest_impl.h"
+
+// Includes from sli:
+#include "dictutils.h"
+
+void
+nest::register_static_synapse_quantized( const std::string& name )
+{
+  register_connection_model< static_synapse_quantized >( name );
+}
+
+namespace nest
+{
+
+QuantizedWeightCommonProperties::QuantizedWeightCommonProperties()
+  : CommonSynapseProperties()
+  , weight_scale_( 0.1 )
+{
+}
+
+void
+QuantizedWeightCommonProperties::get_status( DictionaryDatum& d ) const
+{
+  CommonSynapseProperties::get_status( d );
+  def< double >( d, names::weight_scale, weight_scale_ );
+}
+
+void
+QuantizedWeightCommonProperties::set_status( const DictionaryDatum& d, ConnectorModel& cm )
+{
+  CommonSynapseProperties::set_status( d, cm );
+
+  double new_weight_scale = weight_scale_;
+  if ( updateValue< double >( d, names::weight_scale, new_weight_scale ) and new_weight_scale != weight_scale_ )
+  {
+    if ( new_weight_scale <= 0 )
+    {
+      throw BadProperty( "weight_scale > 0 required." );
+    }
+    if ( kernel().connection_manager.get_num_connections( cm.get_syn_id() ) > 0 )
+    {
+      throw BadProperty( "weight_scale cannot be changed after connections have been created." );
+    }
+    weight_scale_ = new_weight_scale;
+  }
+}
+
+int16_t
+QuantizedWeightCommonProperties::quantize( const double weight ) const
+{
+  const double q = std::round( weight / weight_scale_ );
+  if ( not( std::numeric_limits< int16_t >::min() <= q and q <= std::numeric_limits< int16_t >::max() ) )
+  {
+    throw BadProperty( String::compose(
+      "Weight %1 cannot be represented with weight_scale %2, weight must lie within [-32768, 32767] * weight_scale.",
+      weight,
+      weight_scale_ ) );
+  }
+  return static_cast< int16_t >( q );
+}
+
+} // namespace nest
@@ -0,0 +1,335 @@
+/*
+ *  static_synapse_quantized.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef STATIC_SYNAPSE_QUANTIZED_H
+#define STATIC_SYNAPSE_QUANTIZED_H
+
+// C++ includes:
+#include <cstdint>
+
+// Includes from nestkernel:
+#include "connection.h"
+#include "connector_model.h"
+#include "kernel_manager.h"
+#include "target_identifier.h"
+
+// Includes from models:
+#include "static_synapse.h"
+
+namespace nest
+{
+
+/* BeginUserDocs: synapse, static
+
+Short description
++++++++++++++++++
+
+Static synapse with 16-bit quantized weight
+
+Description
++++++++++++
+
+``static_synapse_quantized`` behaves like ``static_synapse``, but stores the
+weight as a 16-bit integer multiple of the parameter ``weight_scale``, which is
+common to all connections of the model. Together with a target identifier based
+on the thread-local index of the target, as used by the ``_hpc`` variants of
+synapse models, this reduces the memory required per connection to a third of
+that of ``static_synapse``. Targets must be addressed via receptor port 0 and
+there may be at most 65535 nodes per thread.
+
+Weights are rounded to the nearest multiple of ``weight_scale`` when they are
+set and must lie within ``[-32768, 32767] * weight_scale``. ``GetConnections``
+and ``GetStatus`` report the rounded weight.
+
+``weight_scale`` can only be changed with ``SetDefaults`` as long as no
+connections of the model exist. Since the default weight is also stored as a
+multiple of ``weight_scale``, a new default weight should be set together with
+a new ``weight_scale``. ``CopyModel`` can be used to create models with
+different scales.
+
+The number of bytes saved by compact synapse models on a rank is reported by the
+kernel attribute ``compact_synapse_memory_saved``.
+
+Parameters
+++++++++++
+
+============= ======= =========================================================
+ weight_scale  real    Weight represented by one quantization step, common to
+                       all connections of the model (default: 0.1)
+============= ======= =========================================================
+
+Transmits
++++++++++
+
+SpikeEvent, RateEvent, CurrentEvent, ConductanceEvent,
+DoubleDataEvent, DataLoggingRequest
+
+See also
+++++++++
+
+static_synapse, static_synapse_compact
+
+Examples using this model
++++++++++++++++++++++++++
+
+.. listexamples:: static_synapse_quantized
+
+EndUserDocs */
+
+/**
+ * Class containing the common properties for all synapses of type
+ * static_synapse_quantized.
+ */
+class QuantizedWeightCommonProperties : public CommonSynapseProperties
+{
+public:
+  QuantizedWeightCommonProperties();
+
+  void get_status( DictionaryDatum& d ) const;
+
+  /**
+   * Set properties from the values given in dictionary.
+   *
+   * The weight scale can only be changed while no connections of the model exist.
+   */
+  void set_status( const DictionaryDatum& d, ConnectorModel& cm );
+
+  double
+  get_weight_scale() const
+  {
+    return weight_scale_;
+  }
+
+  //! Return quantized representation of weight, throws BadProperty if weight is out of range
+  int16_t quantize( const double weight ) const;
+
+private:
+  double weight_scale_;
+};
+
+/**
+ * Target identifier extended by a 16-bit quantized weight.
+ *
+ * With TargetIdentifierIndex as base, the weight occupies the padding that
+ * otherwise follows the target index in Connection, so that it requires
+ * no extra memory.
+ */
+template < typename targetidentifierT >
+class TargetIdentifierQuantizedWeight : public targetidentifierT
+{
+public:
+  TargetIdentifierQuantizedWeight()
+    : targetidentifierT()
+    , quantized_weight_( 0 )
+  {
+  }
+
+  int16_t
+  get_quantized_weight() const
+  {
+    return quantized_weight_;
+  }
+
+  void
+  set_quantized_weight( const int16_t q )
+  {
+    quantized_weight_ = q;
+  }
+
+private:
+  int16_t quantized_weight_;
+};
+
+void register_static_synapse_quantized( const std::string& name );
+
+template < typename targetidentifierT >
+class static_synapse_quantized : public Connection< TargetIdentifierQuantizedWeight< targetidentifierT > >
+{
+public:
+  // this line determines which common properties to use
+  typedef QuantizedWeightCommonProperties CommonPropertiesType;
+  typedef Connection< TargetIdentifierQuantizedWeight< targetidentifierT > > ConnectionBase;
+
+  static constexpr ConnectionModelProperties properties = ConnectionModelProperties::HAS_DELAY
+    | ConnectionModelProperties::IS_PRIMARY | ConnectionModelProperties::IS_STATIC
+    | ConnectionModelProperties::IS_COMPACT;
+
+  //! Size of the connection replaced by this model, see ConnectorModel::get_memory_saved_per_connection()
+  static constexpr size_t size_of_full_synapse = sizeof( static_synapse< TargetIdentifierPtrRport > );
+
+  /**
+   * Default Constructor.
+   * Sets the default weight 1.0 in units of the default weight scale.
+   */
+  static_synapse_quantized()
+    : ConnectionBase()
+  {
+    ConnectionBase::target_.set_quantized_weight( CommonPropertiesType().quantize( 1.0 ) );
+  }
+
+  static_synapse_quantized( const static_synapse_quantized& rhs ) = default;
+  static_synapse_quantized& operator=( const static_synapse_quantized& rhs ) = default;
+
+  // Explicitly declare all methods inherited from the dependent base
+  // ConnectionBase. This avoids explicit name prefixes in all places these
+  // functions are used. Since ConnectionBase depends on the template parameter,
+  // they are not automatically found in the base class.
+  using ConnectionBase::get_delay_steps;
+  using ConnectionBase::get_rport;
+  using ConnectionBase::get_syn_id;
+  using ConnectionBase::get_target;
+
+  class ConnTestDummyNode : public ConnTestDummyNodeBase
+  {
+  public:
+    // Ensure proper overriding of overloaded virtual functions.
+    // Return values from functions are ignored.
+    using ConnTestDummyNodeBase::handles_test_event;
+    size_t
+    handles_test_event( SpikeEvent&, size_t ) override
+    {
+      return invalid_port;
+    }
+    size_t
+    handles_test_event( RateEvent&, size_t ) override
+    {
+      return invalid_port;
+    }
+    size_t
+    handles_test_event( DataLoggingRequest&, size_t ) override
+    {
+      return invalid_port;
+    }
+    size_t
+    handles_test_event( CurrentEvent&, size_t ) override
+    {
+      return invalid_port;
+    }
+    size_t
+    handles_test_event( ConductanceEvent&, size_t ) override
+    {
+      return invalid_port;
+    }
+    size_t
+    handles_test_event( DoubleDataEvent&, size_t ) override
+    {
+      return invalid_port;
+    }
+    size_t
+    handles_test_event( DSSpikeEvent&, size_t ) override
+    {
+      return invalid_port;
+    }
+    size_t
+    handles_test_event( DSCurrentEvent&, size_t ) override
+    {
+      return invalid_port;
+    }
+  };
+
+  void
+  check_connection( Node& s, Node& t, size_t receptor_type, const CommonPropertiesType& )
+  {
+    ConnTestDummyNode dummy_target;
+    ConnectionBase::check_connection_( dummy_target, s, t, receptor_type );
+  }
+
+  bool
+  send( Event& e, const size_t tid, const CommonPropertiesType& cp )
+  {
+    e.set_weight( get_transmitted_weight( cp ) );
+    e.set_delay_steps( get_delay_steps() );
+    e.set_receiver( *get_target( tid ) );
+    e.set_rport( get_rport() );
+    e();
+    return true;
+  }
+
+  //! Weight transmitted by send()
+  double
+  get_transmitted_weight( const CommonPropertiesType& cp ) const
+  {
+    return ConnectionBase::target_.get_quantized_weight() * cp.get_weight_scale();
+  }
+
+  void get_status( DictionaryDatum& d ) const;
+
+  void set_status( const DictionaryDatum& d, ConnectorModel& cm );
+
+  double
+  get_weight()
+  {
+    return get_transmitted_weight( get_common_properties_() );
+  }
+
+  void
+  set_weight( double w )
+  {
+    ConnectionBase::target_.set_quantized_weight( get_common_properties_().quantize( w ) );
+  }
+
+private:
+  /**
+   * Return common properties of the model of this connection.
+   *
+   * Used where the common properties are not passed in, i.e., when the
+   * weight is set by Connect or read by GetConnections.
+   */
+  const CommonPropertiesType&
+  get_common_properties_() const
+  {
+    const ConnectorModel& cm =
+      kernel().model_manager.get_connection_model( get_syn_id(), kernel().vp_manager.get_thread_id() );
+    return static_cast< const CommonPropertiesType& >( cm.get_common_properties() );
+  }
+};
+
+template < typename targetidentifierT >
+constexpr ConnectionModelProperties static_synapse_quantized< targetidentifierT >::properties;
+
+template < typename targetidentifierT >
+void
+static_synapse_quantized< targetidentifierT >::get_status( DictionaryDatum& d ) const
+{
+  ConnectionBase::get_status( d );
+  def< double >( d, names::weight, get_transmitted_weight( get_common_properties_() ) );
+  def< long >( d, names::size_of, sizeof( *this ) );
+}
+
+template < typename targetidentifierT >
+void
+static_synapse_quantized< targetidentifierT >::set_status( const DictionaryDatum& d, ConnectorModel& cm )
+{
+  ConnectionBase::set_status( d, cm );
+
+  // Use the common properties of cm, which may just have been updated by SetDefaults
+  const CommonPropertiesType& cp = static_cast< const CommonPropertiesType& >( cm.get_common_properties() );
+  double weight = 0.0;
+  if ( updateValue< double >( d, names::weight, weight ) )
+  {
+    ConnectionBase::target_.set_quantized_weight( cp.quantize( weight ) );
+  }
+}
+
+} // namespace
+
+#endif /* #ifndef STATIC_SYNAPSE_QUANTIZED_H */
@@ -25,6 +25,8 @@
 
 // C++ includes:
 #include <cmath>
+#include <utility>
+#include <vector>
 
 // Includes from nestkernel:
 #include "common_synapse_properties.h"
@@ -161,6 +163,21 @@ public:
    */
   void set_status( const DictionaryDatum& d, ConnectorModel& cm );
 
+  /**
+   * Typed setters of the parameters, used by connect_arrays().
+   */
+  static const std::vector< std::pair< Name, ParameterSetter< stdp_synapse > > >& get_parameter_setters();
+
+  /**
+   * Typed getters of the parameters, used by get_connection_columns().
+   */
+  static const std::vector< std::pair< Name, ParameterGetter< stdp_synapse > > >& get_parameter_getters();
+
+  /**
+   * Throw BadProperty if the parameters of this connection are inconsistent.
+   */
+  void check_parameters() const;
+
   /**
    * Send an event to the receiver of this connection.
    * \param e The event to send
@@ -336,6 +353,46 @@ stdp_synapse< targetidentifierT >::set_status( const DictionaryDatum& d, Connect
   updateValue< double >( d, names::Wmax, Wmax_ );
   updateValue< double >( d, names::Kplus, Kplus_ );
 
+  check_parameters();
+}
+
+template < typename targetidentifierT >
+const std::vector< std::pair< Name, ParameterSetter< stdp_synapse< targetidentifierT > > > >&
+stdp_synapse< targetidentifierT >::get_parameter_setters()
+{
+  static const std::vector< std::pair< Name, ParameterSetter< stdp_synapse > > > setters = {
+    { names::tau_plus, []( stdp_synapse& c, double v ) { c.tau_plus_ = v; } },
+    { names::lambda, []( stdp_synapse& c, double v ) { c.lambda_ = v; } },
+    { names::alpha, []( stdp_synapse& c, double v ) { c.alpha_ = v; } },
+    { names::mu_plus, []( stdp_synapse& c, double v ) { c.mu_plus_ = v; } },
+    { names::mu_minus, []( stdp_synapse& c, double v ) { c.mu_minus_ = v; } },
+    { names::Wmax, []( stdp_synapse& c, double v ) { c.Wmax_ = v; } },
+    { names::Kplus, []( stdp_synapse& c, double v ) { c.Kplus_ = v; } }
+  };
+  return setters;
+}
+
+template < typename targetidentifierT >
+const std::vector< std::pair< Name, ParameterGetter< stdp_synapse< targetidentifierT > > > >&
+stdp_synapse< targetidentifierT >::get_parameter_getters()
+{
+  static const std::vector< std::pair< Name, ParameterGetter< stdp_synapse > > > getters = {
+    { names::weight, []( const stdp_synapse& c ) { return c.weight_; } },
+    { names::tau_plus, []( const stdp_synapse& c ) { return c.tau_plus_; } },
+    { names::lambda, []( const stdp_synapse& c ) { return c.lambda_; } },
+    { names::alpha, []( const stdp_synapse& c ) { return c.alpha_; } },
+    { names::mu_plus, []( const stdp_synapse& c ) { return c.mu_plus_; } },
+    { names::mu_minus, []( const stdp_synapse& c ) { return c.mu_minus_; } },
+    { names::Wmax, []( const stdp_synapse& c ) { return c.Wmax_; } },
+    { names::Kplus, []( const stdp_synapse& c ) { return c.Kplus_; } }
+  };
+  return getters;
+}
+
+template < typename targetidentifierT >
+void
+stdp_synapse< targetidentifierT >::check_parameters() const
+{
   // check if weight_ and Wmax_ has the same sign
   if ( not( ( ( weight_ >= 0 ) - ( weight_ < 0 ) ) == ( ( Wmax_ >= 0 ) - ( Wmax_ < 0 ) ) ) )
   {
@@ -149,9 +149,7 @@ public:
   /**
    * Default Destructor.
    */
-  ~stdp_triplet_synapse()
-  {
-  }
+  ~stdp_triplet_synapse() = default;
 
   // Explicitly declare all methods inherited from the dependent base
   // ConnectionBase. This avoids explicit name prefixes in all places
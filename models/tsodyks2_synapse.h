@@ -145,9 +145,7 @@ public:
   /**
    * Default Destructor.
    */
-  ~tsodyks2_synapse()
-  {
-  }
+  ~tsodyks2_synapse() = default;
 
   // Explicitly declare all methods inherited from the dependent base
   // ConnectionBase. This avoids explicit name prefixes in all places these
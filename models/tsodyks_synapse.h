@@ -165,9 +165,7 @@ public:
   /**
    * Default Destructor.
    */
-  ~tsodyks_synapse()
-  {
-  }
+  ~tsodyks_synapse() = default;
 
   // Explicitly declare all methods inherited from the dependent base
   // ConnectionBase. This avoids explicit name prefixes in all places these
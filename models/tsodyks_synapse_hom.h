@@ -199,9 +199,7 @@ public:
   /**
    * Default Destructor.
    */
-  ~tsodyks_synapse_hom()
-  {
-  }
+  ~tsodyks_synapse_hom() = default;
 
   // Explicitly declare all methods inherited from the dependent base
   // ConnectionBase. This avoids explicit name prefixes in all places these
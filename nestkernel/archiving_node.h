@@ -48,6 +48,10 @@ namespace nest
  */
 class ArchivingNode : public StructuralPlasticityNode
 {
+  //! Population kernels record spike times on behalf of their member nodes
+  template < typename NodeT >
+  friend class GenericPopulationKernel;
+
 public:
   ArchivingNode();
 
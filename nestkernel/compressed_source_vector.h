@@ -0,0 +1,364 @@
+/*
+ *  compressed_source_vector.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef COMPRESSED_SOURCE_VECTOR_H
+#define COMPRESSED_SOURCE_VECTOR_H
+
+// C++ includes:
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+// Includes from nestkernel:
+#include "source.h"
+
+// Includes from libnestutil:
+#include "block_vector.h"
+#include "nest_types.h"
+
+namespace nest
+{
+
+/**
+ * Consecutive entries with the same source node ID in a CompressedSourceVector.
+ */
+struct SourceRun
+{
+  size_t node_id;    //!< node ID of source
+  size_t first_lcid; //!< local connection index of first entry
+  size_t length;     //!< number of entries
+  size_t index;      //!< index of run in CompressedSourceVector
+  bool is_primary;   //!< whether connections are primary
+};
+
+/**
+ * Sorted sources of one thread and synapse type in compressed form.
+ *
+ * Consecutive entries with the same node ID are stored as one run. A run
+ * is encoded as the difference of its node ID to the node ID of the
+ * preceding run, followed by the number of entries with the primary flag
+ * in the lowest bit. Both are stored as variable-length integers with seven
+ * bits per byte. Runs are grouped into blocks of runs_per_block runs; for
+ * each block, node ID, local connection index and byte offset of its first
+ * run are kept, so that any entry is found by a binary search over blocks
+ * and decoding of at most one block.
+ *
+ * All entries of a run are communicated as a single target during
+ * construction of the presynaptic connection infrastructure, so processed
+ * flags are stored per run. Flags take one byte each, such that threads can
+ * set flags of different runs concurrently.
+ */
+class CompressedSourceVector
+{
+public:
+  static constexpr size_t runs_per_block = 32;
+
+  CompressedSourceVector();
+
+  /**
+   * Encodes sources, which must be sorted by node ID.
+   *
+   * Returns false and leaves the vector empty if sources are not sorted or
+   * entries with the same node ID differ in their primary flag.
+   */
+  bool assign( const BlockVector< Source >& sources );
+
+  /**
+   * Releases all memory.
+   */
+  void clear();
+
+  /**
+   * Returns the number of entries.
+   */
+  size_t size() const;
+
+  bool empty() const;
+
+  /**
+   * Returns the number of runs, which is the number of unique node IDs.
+   */
+  size_t num_runs() const;
+
+  /**
+   * Returns the run containing the entry at lcid.
+   */
+  SourceRun get_run( const size_t lcid ) const;
+
+  /**
+   * Returns the node ID of the entry at lcid.
+   */
+  size_t get_node_id( const size_t lcid ) const;
+
+  /**
+   * Returns local connection index of first entry with given node ID, or
+   * invalid_index if there is no such entry.
+   */
+  size_t find_first( const size_t node_id ) const;
+
+  bool is_processed( const SourceRun& run ) const;
+  void set_processed( const SourceRun& run, const bool processed );
+  void reset_processed_flags();
+
+  /**
+   * Calls f( run ) for all runs in order of increasing node ID.
+   */
+  template < typename FunctionT >
+  void for_each_run( FunctionT f ) const;
+
+private:
+  struct Block
+  {
+    size_t node_id;    //!< node ID of first run
+    size_t first_lcid; //!< local connection index of first entry of first run
+    size_t offset;     //!< offset of first run in data_
+  };
+
+  void write_varint_( uint64_t value );
+  static uint64_t read_varint_( const uint8_t*& pos );
+
+  /**
+   * Decodes run at pos into run, which holds the preceding run on entry.
+   */
+  static void read_run_( const uint8_t*& pos, SourceRun& run );
+
+  std::vector< uint8_t > data_;
+  std::vector< Block > blocks_;
+  std::vector< uint8_t > processed_;
+  size_t size_;
+};
+
+inline CompressedSourceVector::CompressedSourceVector()
+  : size_( 0 )
+{
+}
+
+inline void
+CompressedSourceVector::write_varint_( uint64_t value )
+{
+  while ( value >= 0x80 )
+  {
+    data_.push_back( static_cast< uint8_t >( value | 0x80 ) );
+    value >>= 7;
+  }
+  data_.push_back( static_cast< uint8_t >( value ) );
+}
+
+inline uint64_t
+CompressedSourceVector::read_varint_( const uint8_t*& pos )
+{
+  uint64_t value = 0;
+  for ( unsigned int shift = 0;; shift += 7 )
+  {
+    const uint8_t byte = *pos++;
+    value |= static_cast< uint64_t >( byte & 0x7f ) << shift;
+    if ( byte < 0x80 )
+    {
+      return value;
+    }
+  }
+}
+
+inline void
+CompressedSourceVector::read_run_( const uint8_t*& pos, SourceRun& run )
+{
+  run.first_lcid += run.length;
+  run.node_id += read_varint_( pos );
+  const uint64_t length_and_primary = read_varint_( pos );
+  run.length = length_and_primary >> 1;
+  run.is_primary = length_and_primary & 1;
+}
+
+inline bool
+CompressedSourceVector::assign( const BlockVector< Source >& sources )
+{
+  clear();
+
+  size_t previous_node_id = 0;
+  auto it = sources.begin();
+  while ( it != sources.end() )
+  {
+    const size_t node_id = it->get_node_id();
+    const bool is_primary = it->is_primary();
+    if ( node_id < previous_node_id )
+    {
+      clear();
+      return false;
+    }
+
+    size_t length = 0;
+    for ( ; it != sources.end() and it->get_node_id() == node_id; ++it )
+    {
+      if ( it->is_primary() != is_primary )
+      {
+        clear();
+        return false;
+      }
+      ++length;
+    }
+
+    if ( processed_.size() % runs_per_block == 0 )
+    {
+      blocks_.push_back( { node_id, size_, data_.size() } );
+      previous_node_id = node_id;
+    }
+
+    write_varint_( node_id - previous_node_id );
+    write_varint_( ( static_cast< uint64_t >( length ) << 1 ) | is_primary );
+    processed_.push_back( false );
+    size_ += length;
+    previous_node_id = node_id;
+  }
+
+  data_.shrink_to_fit();
+  blocks_.shrink_to_fit();
+  processed_.shrink_to_fit();
+  return true;
+}
+
+inline void
+CompressedSourceVector::clear()
+{
+  std::vector< uint8_t >().swap( data_ );
+  std::vector< Block >().swap( blocks_ );
+  std::vector< uint8_t >().swap( processed_ );
+  size_ = 0;
+}
+
+inline size_t
+CompressedSourceVector::size() const
+{
+  return size_;
+}
+
+inline bool
+CompressedSourceVector::empty() const
+{
+  return size_ == 0;
+}
+
+inline size_t
+CompressedSourceVector::num_runs() const
+{
+  return processed_.size();
+}
+
+inline SourceRun
+CompressedSourceVector::get_run( const size_t lcid ) const
+{
+  assert( lcid < size_ );
+
+  // find last block starting at or before lcid
+  const auto block_it = std::upper_bound( blocks_.begin(),
+                          blocks_.end(),
+                          lcid,
+                          []( const size_t l, const Block& block ) { return l < block.first_lcid; } )
+    - 1;
+
+  const uint8_t* pos = data_.data() + block_it->offset;
+  SourceRun run { block_it->node_id, block_it->first_lcid, 0, ( block_it - blocks_.begin() ) * runs_per_block, false };
+  read_run_( pos, run );
+  while ( run.first_lcid + run.length <= lcid )
+  {
+    read_run_( pos, run );
+    ++run.index;
+  }
+  return run;
+}
+
+inline size_t
+CompressedSourceVector::get_node_id( const size_t lcid ) const
+{
+  return get_run( lcid ).node_id;
+}
+
+inline size_t
+CompressedSourceVector::find_first( const size_t node_id ) const
+{
+  // find last block starting at or before node_id
+  auto block_it = std::upper_bound( blocks_.begin(),
+    blocks_.end(),
+    node_id,
+    []( const size_t id, const Block& block ) { return id < block.node_id; } );
+  if ( block_it == blocks_.begin() or node_id == DISABLED_NODE_ID )
+  {
+    return invalid_index;
+  }
+  --block_it;
+
+  const uint8_t* pos = data_.data() + block_it->offset;
+  const size_t block_end_offset = block_it + 1 == blocks_.end() ? data_.size() : ( block_it + 1 )->offset;
+  const uint8_t* const block_end = data_.data() + block_end_offset;
+  SourceRun run { block_it->node_id, block_it->first_lcid, 0, 0, false };
+  while ( pos < block_end )
+  {
+    read_run_( pos, run );
+    if ( run.node_id >= node_id )
+    {
+      return run.node_id == node_id ? run.first_lcid : invalid_index;
+    }
+  }
+  return invalid_index;
+}
+
+inline bool
+CompressedSourceVector::is_processed( const SourceRun& run ) const
+{
+  return processed_[ run.index ];
+}
+
+inline void
+CompressedSourceVector::set_processed( const SourceRun& run, const bool processed )
+{
+  processed_[ run.index ] = processed;
+}
+
+inline void
+CompressedSourceVector::reset_processed_flags()
+{
+  std::fill( processed_.begin(), processed_.end(), false );
+}
+
+template < typename FunctionT >
+void
+CompressedSourceVector::for_each_run( FunctionT f ) const
+{
+  const uint8_t* pos = data_.data();
+  const uint8_t* const end = data_.data() + data_.size();
+  SourceRun run { 0, 0, 0, 0, false };
+  while ( pos < end )
+  {
+    if ( run.index % runs_per_block == 0 )
+    {
+      // first run of each block is encoded relative to the block's node ID
+      run.node_id = blocks_[ run.index / runs_per_block ].node_id;
+    }
+    read_run_( pos, run );
+    f( run );
+    ++run.index;
+  }
+}
+
+} // namespace nest
+
+#endif /* #ifndef COMPRESSED_SOURCE_VECTOR_H */
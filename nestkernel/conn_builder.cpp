@@ -42,6 +42,9 @@
 
 // Includes from C++:
 #include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <numeric>
 
 
 nest::ConnBuilder::ConnBuilder( const std::string& primary_rule,
@@ -498,6 +501,47 @@ nest::BipartiteConnBuilder::loop_over_targets_() const
     or parameters_requiring_skipping_.size() > 0;
 }
 
+size_t
+nest::BipartiteConnBuilder::num_local_targets_( const size_t tid ) const
+{
+  size_t num_local_targets = 0;
+
+  if ( loop_over_targets_() )
+  {
+    NodeCollection::const_iterator target_it = targets_->begin();
+    for ( ; target_it < targets_->end(); ++target_it )
+    {
+      const Node* const target = kernel().node_manager.get_node_or_proxy( ( *target_it ).node_id, tid );
+      if ( not target->is_proxy() and target->has_proxies() and target->get_thread() == tid )
+      {
+        ++num_local_targets;
+      }
+    }
+  }
+  else
+  {
+    const SparseNodeArray& local_nodes = kernel().node_manager.get_local_nodes( tid );
+    for ( SparseNodeArray::const_iterator n = local_nodes.begin(); n != local_nodes.end(); ++n )
+    {
+      if ( n->get_node()->has_proxies() and targets_->get_nc_index( n->get_node_id() ) >= 0 )
+      {
+        ++num_local_targets;
+      }
+    }
+  }
+
+  return num_local_targets;
+}
+
+void
+nest::BipartiteConnBuilder::reserve_connections_( const size_t tid, const size_t num_connections )
+{
+  for ( auto synapse_model_id : synapse_model_id_ )
+  {
+    kernel().connection_manager.reserve_connections( tid, synapse_model_id, num_connections );
+  }
+}
+
 void
 nest::BipartiteConnBuilder::set_synapse_model_( DictionaryDatum syn_params, size_t synapse_indx )
 {
@@ -962,6 +1006,8 @@ nest::OneToOneBuilder::OneToOneBuilder( const NodeCollectionPTR sources,
 void
 nest::OneToOneBuilder::connect_()
 {
+  // Connections from devices are not stored in connectors, so there is nothing to reserve for them.
+  const bool reserve_memory = sources_->has_proxies();
 
 #pragma omp parallel
   {
@@ -972,6 +1018,11 @@ nest::OneToOneBuilder::connect_()
     {
       RngPtr rng = get_vp_specific_rng( tid );
 
+      if ( reserve_memory )
+      {
+        reserve_connections_( tid, num_local_targets_( tid ) );
+      }
+
       if ( loop_over_targets_() )
       {
         // A more efficient way of doing this might be to use NodeCollection's local_begin(). For this to work we
@@ -1176,6 +1227,8 @@ nest::OneToOneBuilder::sp_disconnect_()
 void
 nest::AllToAllBuilder::connect_()
 {
+  // Connections from devices are not stored in connectors, so there is nothing to reserve for them.
+  const bool reserve_memory = sources_->has_proxies();
 
 #pragma omp parallel
   {
@@ -1186,6 +1239,12 @@ nest::AllToAllBuilder::connect_()
     {
       RngPtr rng = get_vp_specific_rng( tid );
 
+      if ( reserve_memory )
+      {
+        // upper bound, since autapses may be excluded
+        reserve_connections_( tid, num_local_targets_( tid ) * sources_->size() );
+      }
+
       if ( loop_over_targets_() )
       {
         NodeCollection::const_iterator target_it = targets_->begin();
@@ -1457,6 +1516,10 @@ nest::FixedInDegreeBuilder::FixedInDegreeBuilder( NodeCollectionPTR sources,
 void
 nest::FixedInDegreeBuilder::connect_()
 {
+  // The number of connections is known in advance only for constant indegree. Random indegrees cannot be drawn
+  // twice without changing the random number streams. Connections from devices are not stored in connectors.
+  const bool reserve_memory = dynamic_cast< ConstantParameter* >( indegree_.get() ) and sources_->has_proxies();
+  const size_t constant_indegree = reserve_memory ? std::max( std::lround( indegree_->value( nullptr, nullptr ) ), 0L ) : 0;
 
 #pragma omp parallel
   {
@@ -1467,6 +1530,11 @@ nest::FixedInDegreeBuilder::connect_()
     {
       RngPtr rng = get_vp_specific_rng( tid );
 
+      if ( reserve_memory )
+      {
+        reserve_connections_( tid, num_local_targets_( tid ) * constant_indegree );
+      }
+
       if ( loop_over_targets_() )
       {
         NodeCollection::const_iterator target_it = targets_->begin();
@@ -1597,21 +1665,6 @@ nest::FixedOutDegreeBuilder::FixedOutDegreeBuilder( NodeCollectionPTR sources,
       {
         throw BadProperty( "Outdegree cannot be larger than population size." );
       }
-      else if ( value == n_targets and not allow_autapses_ )
-      {
-        LOG( M_WARNING,
-          "FixedOutDegreeBuilder::connect",
-          "Multapses and autapses prohibited. When the sources and the targets "
-          "have a non-empty intersection, the connect algorithm will enter an infinite loop." );
-        return;
-      }
-
-      if ( value > 0.9 * n_targets )
-      {
-        LOG( M_WARNING,
-          "FixedOutDegreeBuilder::connect",
-          "Multapses are prohibited and you request more than 90% connectivity. Expect long connecting times!" );
-      }
     }
 
     if ( value < 0 )
@@ -1624,73 +1677,234 @@ nest::FixedOutDegreeBuilder::FixedOutDegreeBuilder( NodeCollectionPTR sources,
 void
 nest::FixedOutDegreeBuilder::connect_()
 {
-  // get global rng that is tested for synchronization for all threads
+  // Outdegrees are drawn from the rank-synchronized RNG, so that all threads on all ranks know the
+  // number of connections of each source. This is the only part of the work replicated on each rank.
   RngPtr grng = get_rank_synced_rng();
 
-  NodeCollection::const_iterator source_it = sources_->begin();
-  for ( ; source_it < sources_->end(); ++source_it )
+  const size_t num_sources = sources_->size();
+  const size_t num_targets = targets_->size();
+  std::vector< size_t > outdegrees( num_sources );
+  size_t source_index = 0;
+  for ( NodeCollection::const_iterator source_it = sources_->begin(); source_it < sources_->end(); ++source_it )
   {
     const size_t snode_id = ( *source_it ).node_id;
-
-    std::set< long > ch_ids;
-    std::vector< size_t > tgt_ids_;
-    const long n_rnd = targets_->size();
-
     Node* source_node = kernel().node_manager.get_node_or_proxy( snode_id );
     const long outdegree_value = std::round( outdegree_->value( grng, source_node ) );
-    for ( long j = 0; j < outdegree_value; ++j )
+    if ( outdegree_value < 0 )
     {
-      unsigned long t_id;
-      size_t tnode_id;
-      bool skip_autapse = false;
-      bool skip_multapse = false;
+      throw BadProperty( "Outdegree cannot be less than zero." );
+    }
 
-      do
-      {
-        t_id = grng->ulrand( n_rnd );
-        tnode_id = ( *targets_ )[ t_id ];
-        skip_autapse = not allow_autapses_ and tnode_id == snode_id;
-        skip_multapse = not allow_multapses_ and ch_ids.find( t_id ) != ch_ids.end();
-      } while ( skip_autapse or skip_multapse );
+    const size_t num_available =
+      num_targets - ( not allow_autapses_ and targets_->get_nc_index( snode_id ) >= 0 ? 1 : 0 );
+    if ( static_cast< size_t >( outdegree_value ) > num_available and ( not allow_multapses_ or num_available == 0 ) )
+    {
+      throw BadProperty( String::compose(
+        "Source %1 cannot have outdegree %2 with %3 available targets.", snode_id, outdegree_value, num_available ) );
+    }
+    outdegrees[ source_index++ ] = outdegree_value;
+  }
+
+  // Key of the streams that split outdegrees between virtual processes
+  const std::uint64_t stream_seed = grng->ulrand( std::numeric_limits< unsigned long >::max() );
+
+#pragma omp parallel
+  {
+    // get thread id
+    const size_t tid = kernel().vp_manager.get_thread_id();
+
+    try
+    {
+      RngPtr rng = get_vp_specific_rng( tid );
 
-      if ( not allow_multapses_ )
+      const size_t num_vps = kernel().vp_manager.get_num_virtual_processes();
+      const size_t vp = kernel().vp_manager.thread_to_vp( tid );
+
+      // The targets are partitioned into one group per VP and one group of nodes without proxies,
+      // e.g. recording devices. The latter is served by the VP of the source, which connects to its
+      // local instance of the device.
+      const size_t device_group = num_vps;
+      // After counting, group_begin[ g ] is the number of targets in groups before g
+      std::vector< size_t > group_begin( num_vps + 2, 0 );
+      std::vector< size_t > local_targets;
+      std::vector< size_t > device_targets;
+      for ( NodeCollection::const_iterator target_it = targets_->begin(); target_it < targets_->end(); ++target_it )
       {
-        ch_ids.insert( t_id );
+        const size_t tnode_id = ( *target_it ).node_id;
+        if ( kernel().model_manager.get_node_model( ( *target_it ).model_id )->has_proxies() )
+        {
+          const size_t target_vp = kernel().vp_manager.node_id_to_vp( tnode_id );
+          ++group_begin[ target_vp + 1 ];
+          if ( target_vp == vp )
+          {
+            local_targets.push_back( tnode_id );
+          }
+        }
+        else
+        {
+          ++group_begin[ device_group + 1 ];
+          device_targets.push_back( tnode_id );
+        }
       }
+      std::partial_sum( group_begin.begin(), group_begin.end(), group_begin.begin() );
 
-      tgt_ids_.push_back( tnode_id );
-    }
+      std::vector< bool > chosen( std::max( local_targets.size(), device_targets.size() ), false );
+      std::vector< size_t > chosen_indices;
 
-#pragma omp parallel
-    {
-      // get thread id
-      const size_t tid = kernel().vp_manager.get_thread_id();
+      // Connections of each source are ordered by group. To match parameter arrays, we skip the
+      // connections of other groups.
+      size_t num_pending_skips = 0;
 
-      try
+      source_index = 0;
+      for ( NodeCollection::const_iterator source_it = sources_->begin(); source_it < sources_->end(); ++source_it )
       {
-        RngPtr rng = get_vp_specific_rng( tid );
+        const size_t snode_id = ( *source_it ).node_id;
+        const size_t outdegree = outdegrees[ source_index ];
 
-        std::vector< size_t >::const_iterator tnode_id_it = tgt_ids_.begin();
-        for ( ; tnode_id_it != tgt_ids_.end(); ++tnode_id_it )
+        size_t excluded_group = invalid_index;
+        if ( not allow_autapses_ and targets_->get_nc_index( snode_id ) >= 0 )
         {
-          Node* const target = kernel().node_manager.get_node_or_proxy( *tnode_id_it, tid );
-          if ( target->is_proxy() )
+          excluded_group = kernel().node_manager.get_node_or_proxy( snode_id, tid )->has_proxies()
+            ? kernel().vp_manager.node_id_to_vp( snode_id )
+            : device_group;
+        }
+
+        size_t num_handled = 0;
+        for ( const size_t group : { vp, device_group } )
+        {
+          if ( group == device_group and kernel().vp_manager.node_id_to_vp( snode_id ) != vp )
           {
-            // skip array parameters handled in other virtual processes
-            skip_conn_parameter_( tid );
             continue;
           }
 
-          single_connect_( snode_id, *target, tid, rng );
+          size_t offset = 0;
+          const size_t num_connections =
+            split_outdegree_( stream_seed, source_index, outdegree, group_begin, excluded_group, group, offset );
+          if ( num_connections == 0 )
+          {
+            continue;
+          }
+
+          num_pending_skips += offset - num_handled;
+          if ( num_pending_skips > 0 )
+          {
+            skip_conn_parameter_( tid, num_pending_skips );
+            num_pending_skips = 0;
+          }
+
+          const std::vector< size_t >& group_targets = group == device_group ? device_targets : local_targets;
+          const long excluded_position = group == excluded_group
+            ? std::lower_bound( group_targets.begin(), group_targets.end(), snode_id ) - group_targets.begin()
+            : -1;
+          const size_t num_candidates = group_targets.size() - ( excluded_position >= 0 ? 1 : 0 );
+
+          sample_targets_( rng, num_candidates, num_connections, chosen, chosen_indices );
+          for ( size_t index : chosen_indices )
+          {
+            if ( excluded_position >= 0 and index >= static_cast< size_t >( excluded_position ) )
+            {
+              ++index;
+            }
+            Node* const target = kernel().node_manager.get_node_or_proxy( group_targets[ index ], tid );
+            single_connect_( snode_id, *target, tid, rng );
+          }
+          num_handled = offset + num_connections;
         }
+
+        num_pending_skips += outdegree - num_handled;
+        ++source_index;
       }
-      catch ( std::exception& err )
-      {
-        // We must create a new exception here, err's lifetime ends at
-        // the end of the catch block.
-        exceptions_raised_.at( tid ) = std::shared_ptr< WrappedThreadException >( new WrappedThreadException( err ) );
-      }
     }
+    catch ( std::exception& err )
+    {
+      // We must create a new exception here, err's lifetime ends at
+      // the end of the catch block.
+      exceptions_raised_.at( tid ) = std::shared_ptr< WrappedThreadException >( new WrappedThreadException( err ) );
+    }
+  }
+}
+
+size_t
+nest::FixedOutDegreeBuilder::split_outdegree_( const std::uint64_t stream_seed,
+  const size_t source_index,
+  const size_t outdegree,
+  const std::vector< size_t >& group_begin,
+  const size_t excluded_group,
+  const size_t group,
+  size_t& offset ) const
+{
+  const auto num_candidates = [ &group_begin, excluded_group ]( const size_t first, const size_t last )
+  { return group_begin[ last ] - group_begin[ first ] - ( first <= excluded_group and excluded_group < last ? 1 : 0 ); };
+
+  // Descend the binary tree over groups towards the given group. Each split is drawn from a stream
+  // determined by source and tree node, so all VPs descending through a node obtain the same split.
+  size_t first = 0;
+  size_t last = group_begin.size() - 1;
+  size_t tree_node = 1;
+  size_t n = outdegree;
+  size_t population = num_candidates( first, last );
+  offset = 0;
+  while ( last - first > 1 and n > 0 )
+  {
+    const size_t mid = first + ( last - first ) / 2;
+    const size_t population_left = num_candidates( first, mid );
+
+    CounterBasedRandomStream stream( { stream_seed, source_index, tree_node } );
+    const size_t n_left = allow_multapses_
+      ? stream.binomial( n, population > 0 ? static_cast< double >( population_left ) / population : 0.0 )
+      : stream.hypergeometric( n, population_left, population );
+
+    if ( group < mid )
+    {
+      last = mid;
+      n = n_left;
+      population = population_left;
+      tree_node = 2 * tree_node;
+    }
+    else
+    {
+      first = mid;
+      n -= n_left;
+      offset += n_left;
+      population -= population_left;
+      tree_node = 2 * tree_node + 1;
+    }
+  }
+  return n;
+}
+
+void
+nest::FixedOutDegreeBuilder::sample_targets_( RngPtr rng,
+  const size_t num_candidates,
+  const size_t num_samples,
+  std::vector< bool >& chosen,
+  std::vector< size_t >& chosen_indices ) const
+{
+  chosen_indices.clear();
+  if ( allow_multapses_ )
+  {
+    for ( size_t i = 0; i < num_samples; ++i )
+    {
+      chosen_indices.push_back( rng->ulrand( num_candidates ) );
+    }
+    return;
+  }
+
+  // Floyd's algorithm draws each sample once, with marks kept in a bitset
+  assert( num_samples <= num_candidates );
+  for ( size_t j = num_candidates - num_samples; j < num_candidates; ++j )
+  {
+    size_t index = rng->ulrand( j + 1 );
+    if ( chosen[ index ] )
+    {
+      index = j;
+    }
+    chosen[ index ] = true;
+    chosen_indices.push_back( index );
+  }
+  for ( const size_t index : chosen_indices )
+  {
+    chosen[ index ] = false;
   }
 }
 
@@ -31,6 +31,7 @@
  */
 
 // C++ includes:
+#include <cstdint>
 #include <map>
 #include <set>
 #include <vector>
@@ -216,6 +217,22 @@ protected:
    */
   bool loop_over_targets_() const;
 
+  /**
+   * Returns the number of targets with proxies located on thread tid.
+   *
+   * Connections to devices are not stored in connectors and are not counted.
+   */
+  size_t num_local_targets_( size_t tid ) const;
+
+  /**
+   * Allocates memory for connections created by thread tid.
+   *
+   * Memory for num_connections connections is reserved for each synapse
+   * specification of the rule. Rules that can cheaply count the connections
+   * they create call this before creating them.
+   */
+  void reserve_connections_( size_t tid, size_t num_connections );
+
   NodeCollectionPTR sources_; //!< Population to connect from
   NodeCollectionPTR targets_; //!< Population to connect to
 
@@ -694,6 +711,40 @@ protected:
   void connect_() override;
 
 private:
+  /**
+   * Return number of connections of a source to targets in the given group.
+   *
+   * The outdegree of the source is split between groups of targets in proportion to
+   * the group sizes, with sampling without replacement if multapses are not allowed.
+   *
+   * @param stream_seed Seed common to all VPs for this connect call
+   * @param source_index Index of source in sources_
+   * @param outdegree Outdegree of source
+   * @param group_begin Prefix sums of group sizes, with group_begin[ 0 ] == 0 and one entry per group plus one
+   * @param excluded_group Group containing the source if autapses are not allowed, else invalid_index
+   * @param group Group for which to return the number of connections
+   * @param offset Set to the number of connections of the source to groups before group
+   */
+  size_t split_outdegree_( const std::uint64_t stream_seed,
+    const size_t source_index,
+    const size_t outdegree,
+    const std::vector< size_t >& group_begin,
+    const size_t excluded_group,
+    const size_t group,
+    size_t& offset ) const;
+
+  /**
+   * Draw indices of num_samples targets from num_candidates candidates.
+   *
+   * If multapses are not allowed, indices are distinct. The bitset chosen must have at least
+   * num_candidates entries, all false, and is left unchanged.
+   */
+  void sample_targets_( RngPtr rng,
+    const size_t num_candidates,
+    const size_t num_samples,
+    std::vector< bool >& chosen,
+    std::vector< size_t >& chosen_indices ) const;
+
   ParameterDatum outdegree_;
 };
 
@@ -254,6 +254,18 @@ public:
   {
     return target_.get_target_ptr( tid );
   }
+
+  /**
+   * Point the connection to the given target node.
+   *
+   * Used when restoring connections from a connectivity snapshot, in which
+   * target pointers are not valid.
+   */
+  void
+  set_target( Node& target )
+  {
+    target_.set_target( &target );
+  }
   size_t
   get_rport() const
   {
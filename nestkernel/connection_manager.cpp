@@ -29,8 +29,11 @@
 #include <algorithm>
 #include <cassert>
 #include <cmath>
+#include <cstdint>
+#include <fstream>
 #include <iomanip>
 #include <limits>
+#include <numeric>
 #include <set>
 #include <vector>
 
@@ -76,9 +79,14 @@ nest::ConnectionManager::ConnectionManager()
   , min_delay_( 1 )
   , max_delay_( 1 )
   , keep_source_table_( true )
+  , compress_source_table_( false )
   , connections_have_changed_( false )
   , get_connections_has_been_called_( false )
   , use_compressed_spikes_( true )
+  , use_radix_sort_( false )
+  , use_incremental_connection_update_( true )
+  , connection_infrastructure_extendable_( false )
+  , incremental_update_( false )
   , has_primary_connections_( false )
   , check_primary_connections_()
   , secondary_connections_exist_( false )
@@ -117,14 +125,20 @@ nest::ConnectionManager::initialize( const bool adjust_number_of_threads_or_rng_
 #endif
 
     keep_source_table_ = true;
+    compress_source_table_ = false;
     connections_have_changed_ = false;
     get_connections_has_been_called_ = false;
     use_compressed_spikes_ = true;
+    use_radix_sort_ = false;
+    use_incremental_connection_update_ = true;
     stdp_eps_ = 1.0e-6;
     min_delay_ = max_delay_ = 1;
     sw_construction_connect.reset();
   }
 
+  connection_infrastructure_extendable_ = false;
+  incremental_update_ = false;
+
   const size_t num_threads = kernel().vp_manager.get_num_threads();
   connections_.resize( num_threads );
   secondary_recv_buffer_pos_.resize( num_threads );
@@ -194,15 +208,38 @@ nest::ConnectionManager::set_status( const DictionaryDatum& d )
     delay_checkers_[ i ].set_status( d );
   }
 
-  updateValue< bool >( d, names::keep_source_table, keep_source_table_ );
-  if ( not keep_source_table_ and kernel().sp_manager.is_structural_plasticity_enabled() )
+  // validate both source table flags together before changing either of them
+  bool keep_source_table = keep_source_table_;
+  updateValue< bool >( d, names::keep_source_table, keep_source_table );
+  if ( not keep_source_table and kernel().sp_manager.is_structural_plasticity_enabled() )
   {
     throw KernelException(
       "If structural plasticity is enabled, keep_source_table can not be set "
       "to false." );
   }
 
+  bool compress_source_table = compress_source_table_;
+  updateValue< bool >( d, names::compress_source_table, compress_source_table );
+  if ( compress_source_table and keep_source_table )
+  {
+    throw KernelException( "compress_source_table can only be set if keep_source_table is false." );
+  }
+
+  keep_source_table_ = keep_source_table;
+  compress_source_table_ = compress_source_table;
+
+  const bool use_compressed_spikes = use_compressed_spikes_;
   updateValue< bool >( d, names::use_compressed_spikes, use_compressed_spikes_ );
+  if ( use_compressed_spikes_ != use_compressed_spikes )
+  {
+    // targets on the presynaptic side have a different meaning with and
+    // without spike compression
+    connection_infrastructure_extendable_ = false;
+    source_table_.clear_source_indices();
+  }
+
+  updateValue< bool >( d, names::use_incremental_connection_update, use_incremental_connection_update_ );
+  updateValue< bool >( d, names::use_radix_sort, use_radix_sort_ );
 
   //  Need to update the saved values if we have changed the delay bounds.
   if ( d->known( names::min_delay ) or d->known( names::max_delay ) )
@@ -226,8 +263,23 @@ nest::ConnectionManager::get_status( DictionaryDatum& dict )
 
   const size_t n = get_num_connections();
   def< long >( dict, names::num_connections, n );
+
+  size_t memory_saved = 0;
+  for ( synindex syn_id = 0; syn_id < kernel().model_manager.get_num_connection_models(); ++syn_id )
+  {
+    const size_t saved_per_connection =
+      kernel().model_manager.get_connection_model( syn_id, /* thread */ 0 ).get_memory_saved_per_connection();
+    if ( saved_per_connection > 0 )
+    {
+      memory_saved += saved_per_connection * get_num_connections( syn_id );
+    }
+  }
+  def< long >( dict, names::compact_synapse_memory_saved, memory_saved );
   def< bool >( dict, names::keep_source_table, keep_source_table_ );
+  def< bool >( dict, names::compress_source_table, compress_source_table_ );
   def< bool >( dict, names::use_compressed_spikes, use_compressed_spikes_ );
+  def< bool >( dict, names::use_incremental_connection_update, use_incremental_connection_update_ );
+  def< bool >( dict, names::use_radix_sort, use_radix_sort_ );
 
   sw_construction_connect.get_status( dict, names::time_construction_connect, names::time_construction_connect_cpu );
 
@@ -556,6 +608,14 @@ nest::ConnectionManager::update_delay_extrema_()
   {
     min_delay_ = Time::get_resolution().get_steps();
   }
+
+  if ( kernel().event_delivery_manager.use_pipelined_spike_exchange() )
+  {
+    // Spikes are delivered one slice later than usual, so slices must not be
+    // longer than half the minimal delay. SimulationManager::prepare() checks
+    // that this is possible.
+    min_delay_ = std::max( min_delay_ / 2, 1L );
+  }
 }
 
 // node ID node thread syn_id dict delay weight
@@ -632,78 +692,83 @@ nest::ConnectionManager::connect( const size_t snode_id,
   return connected;
 }
 
+void
+nest::ConnectionManager::reserve_connections( const size_t tid, const synindex syn_id, const size_t n )
+{
+  if ( n == 0 )
+  {
+    return;
+  }
+
+  kernel().model_manager.get_connection_model( syn_id, tid ).reserve_connections( connections_[ tid ], syn_id, n );
+  source_table_.reserve( tid, syn_id, n );
+}
+
 void
 nest::ConnectionManager::connect_arrays( long* sources,
   long* targets,
   double* weights,
   double* delays,
   std::vector< std::string >& p_keys,
-  double* p_values,
+  std::vector< double* >& p_values,
   size_t n,
   std::string syn_model )
 {
   // only place, where stopwatch sw_construction_connect is needed in addition to nestmodule.cpp
   sw_construction_connect.start();
 
-  // Mapping pointers to the first parameter value of each parameter to their respective names.
-  // The bool indicates whether the value is an integer or not, and is determined at a later point.
-  std::map< Name, std::pair< double*, bool > > param_pointers;
-  if ( p_keys.size() != 0 )
+  if ( p_keys.size() != p_values.size() )
   {
-    size_t i = 0;
-    for ( auto& key : p_keys )
-    {
-      // Shifting the pointer to the first value of the parameter.
-      param_pointers[ key ] = std::make_pair( p_values + i * n, false );
-      ++i;
-    }
+    throw BadParameter( "connect_arrays requires one array of values per additional synapse parameter." );
   }
 
   const auto synapse_model_id = kernel().model_manager.get_synapse_model_id( syn_model );
   const auto syn_model_defaults = kernel().model_manager.get_connector_defaults( synapse_model_id );
 
+  // Parameter names and whether the model expects integer values for them. Both are looked up once here.
+  std::vector< Name > param_names;
+  std::vector< bool > param_is_int;
+  for ( auto& param_key : p_keys )
+  {
+    const Name param_name = param_key; // Convert string to Name
+    // Check that the parameter exists for the synapse model.
+    const auto syn_model_default_it = syn_model_defaults->find( param_name );
+    if ( syn_model_default_it == syn_model_defaults->end() )
+    {
+      throw BadParameter( syn_model + " does not have parameter " + param_key );
+    }
+    param_names.push_back( param_name );
+    // If the default value is an integer, the synapse parameter must also be an integer.
+    param_is_int.push_back( dynamic_cast< IntegerDatum* >( syn_model_default_it->second.datum() ) );
+  }
+
+  // Bind the parameter columns to typed setters of the synapse model once, so that connections are created
+  // without passing their parameters through dictionaries. This is only possible if the model has setters for
+  // all parameters; otherwise, and for connections from or to devices, the parameters are passed in dictionaries.
+  const std::vector< const double* > param_columns( p_values.begin(), p_values.end() );
+  BoundParameterColumns bound_params;
+  const bool use_typed_setters = kernel().model_manager.get_connection_model( synapse_model_id, 0 )
+                                   .bind_parameter_columns( param_names, param_columns, bound_params );
+
   // Dictionary holding additional synapse parameters, passed to the connect call.
   std::vector< DictionaryDatum > param_dicts;
   param_dicts.reserve( kernel().vp_manager.get_num_threads() );
   for ( size_t i = 0; i < kernel().vp_manager.get_num_threads(); ++i )
   {
     param_dicts.emplace_back( new Dictionary );
-    for ( auto& param_key : p_keys )
+    for ( size_t k = 0; k < param_names.size(); ++k )
     {
-      const Name param_name = param_key; // Convert string to Name
-      // Check that the parameter exists for the synapse model.
-      const auto syn_model_default_it = syn_model_defaults->find( param_name );
-      if ( syn_model_default_it == syn_model_defaults->end() )
-      {
-        throw BadParameter( syn_model + " does not have parameter " + param_key );
-      }
-
-      // If the default value is an integer, the synapse parameter must also be an integer.
-      if ( dynamic_cast< IntegerDatum* >( syn_model_default_it->second.datum() ) )
+      if ( param_is_int[ k ] )
       {
-        param_pointers[ param_key ].second = true;
-        ( *param_dicts[ i ] )[ param_key ] = Token( new IntegerDatum( 0 ) );
+        ( *param_dicts[ i ] )[ param_names[ k ] ] = Token( new IntegerDatum( 0 ) );
       }
       else
       {
-        ( *param_dicts[ i ] )[ param_key ] = Token( new DoubleDatum( 0.0 ) );
+        ( *param_dicts[ i ] )[ param_names[ k ] ] = Token( new DoubleDatum( 0.0 ) );
       }
     }
   }
 
-  // Increments pointers to weight and delay, if they are specified.
-  auto increment_wd = [ weights, delays ]( decltype( weights ) & w, decltype( delays ) & d )
-  {
-    if ( weights )
-    {
-      ++w;
-    }
-    if ( delays )
-    {
-      ++d;
-    }
-  };
-
   // Set flag before entering parallel section in case we have fewer connections than ranks.
   set_connections_have_changed();
 
@@ -715,78 +780,121 @@ nest::ConnectionManager::connect_arrays( long* sources,
     const auto tid = kernel().vp_manager.get_thread_id();
     try
     {
-      auto s = sources;
-      auto t = targets;
-      auto w = weights;
-      auto d = delays;
-      double weight_buffer = numerics::nan;
-      double delay_buffer = numerics::nan;
-      int index_counter = 0; // Index of the current connection, for connection parameters
-
-      for ( ; s != sources + n; ++s, ++t, ++index_counter )
+      // Each thread creates the connections to its local targets. Looking targets up among the local nodes of
+      // the thread avoids creating proxies for all other targets.
+      const SparseNodeArray& local_nodes = kernel().node_manager.get_local_nodes( tid );
+
+      // Count connections created by this thread to allocate memory for them at once. Connections from and to
+      // devices are not stored in connectors.
+      size_t num_local_connections = 0;
+      for ( size_t i = 0; i < n; ++i )
       {
-        if ( 0 >= *s or static_cast< size_t >( *s ) > kernel().node_manager.size() )
+        if ( 0 >= sources[ i ] or static_cast< size_t >( sources[ i ] ) > kernel().node_manager.size() )
         {
-          throw UnknownNode( *s );
+          throw UnknownNode( sources[ i ] );
         }
-        if ( 0 >= *t or static_cast< size_t >( *t ) > kernel().node_manager.size() )
+        if ( 0 >= targets[ i ] or static_cast< size_t >( targets[ i ] ) > kernel().node_manager.size() )
         {
-          throw UnknownNode( *t );
+          throw UnknownNode( targets[ i ] );
         }
-        auto target_node = kernel().node_manager.get_node_or_proxy( *t, tid );
-        if ( target_node->is_proxy() )
+        const Node* const target_node = local_nodes.get_node_by_node_id( targets[ i ] );
+        if ( target_node and target_node->has_proxies()
+          and kernel().node_manager.get_node_or_proxy( sources[ i ], tid )->has_proxies() )
         {
-          increment_wd( w, d );
-          continue;
+          ++num_local_connections;
         }
+      }
+      reserve_connections( tid, synapse_model_id, num_local_connections );
 
-        // If weights or delays are specified, the buffers are replaced with the values.
-        // If not, the buffers will be NaN and replaced by a default value by the connect function.
-        if ( weights )
+      // Bind the parameter columns to the datums in the dictionary of this thread, so that values can be changed
+      // without looking up entries or allocating new datums.
+      std::vector< IntegerDatum* > int_datums( param_names.size(), nullptr );
+      std::vector< DoubleDatum* > double_datums( param_names.size(), nullptr );
+      for ( size_t k = 0; k < param_names.size(); ++k )
+      {
+        Datum* datum = ( *param_dicts[ tid ] )[ param_names[ k ] ].datum();
+        if ( param_is_int[ k ] )
         {
-          weight_buffer = *w;
+          int_datums[ k ] = static_cast< IntegerDatum* >( datum );
         }
-        if ( delays )
+        else
         {
-          delay_buffer = *d;
+          double_datums[ k ] = static_cast< DoubleDatum* >( datum );
         }
+      }
 
-        // Store the key-value pair of each parameter in the Dictionary.
-        for ( auto& param_pointer_pair : param_pointers )
+      bool entries_checked = false;
+      for ( size_t i = 0; i < n; ++i )
+      {
+        Node* target_node = local_nodes.get_node_by_node_id( targets[ i ] );
+        if ( not target_node )
         {
-          // Increment the pointer to the parameter value.
-          const auto param_pointer = param_pointer_pair.second.first;
-          const auto is_int = param_pointer_pair.second.second;
-          auto* param = param_pointer + index_counter;
+          continue;
+        }
 
-          // Integer parameters are stored as IntegerDatums.
-          if ( is_int )
+        for ( size_t k = 0; k < param_names.size(); ++k )
+        {
+          const double param = p_values[ k ][ i ];
+          if ( param_is_int[ k ]
+            and ( param > 1L << 31 or std::abs( param - static_cast< long >( param ) ) > 0 ) ) // To avoid rounding errors
           {
-            const auto rtype_as_long = static_cast< long >( *param );
+            const auto msg =
+              std::string( "Expected integer value for " ) + param_names[ k ].toString() + ", but got double.";
+            throw BadParameter( msg );
+          }
+        }
 
-            if ( *param > 1L << 31 or std::abs( *param - rtype_as_long ) > 0 ) // To avoid rounding errors
-            {
-              const auto msg = std::string( "Expected integer value for " ) + param_pointer_pair.first.toString()
-                + ", but got double.";
-              throw BadParameter( msg );
-            }
+        if ( use_typed_setters )
+        {
+          Node* source = kernel().node_manager.get_node_or_proxy( sources[ i ], tid );
+          const ConnectionType connection_type = connection_required( source, target_node, tid );
+          if ( connection_type == NO_CONNECTION )
+          {
+            continue;
+          }
+          if ( connection_type == CONNECT )
+          {
+            connect_( *source,
+              *target_node,
+              sources[ i ],
+              tid,
+              synapse_model_id,
+              bound_params,
+              i,
+              delays ? delays[ i ] : numerics::nan,
+              weights ? weights[ i ] : numerics::nan );
+            continue;
+          }
+        }
 
-            // Change value of dictionary entry without allocating new datum.
-            auto id = static_cast< IntegerDatum* >( ( ( *param_dicts[ tid ] )[ param_pointer_pair.first ] ).datum() );
-            ( *id ) = rtype_as_long;
+        // Integer parameters are stored as IntegerDatums.
+        for ( size_t k = 0; k < param_names.size(); ++k )
+        {
+          if ( param_is_int[ k ] )
+          {
+            *int_datums[ k ] = static_cast< long >( p_values[ k ][ i ] );
           }
           else
           {
-            auto dd = static_cast< DoubleDatum* >( ( ( *param_dicts[ tid ] )[ param_pointer_pair.first ] ).datum() );
-            ( *dd ) = *param;
+            *double_datums[ k ] = p_values[ k ][ i ];
           }
         }
 
-        connect( *s, target_node, tid, synapse_model_id, param_dicts[ tid ], delay_buffer, weight_buffer );
-
-        ALL_ENTRIES_ACCESSED( *param_dicts[ tid ], "connect_arrays", "Unread dictionary entries: " );
-
-        increment_wd( w, d );
+        // If weights or delays are not specified, NaN is replaced by a default value by the connect function.
+        connect( sources[ i ],
+          target_node,
+          tid,
+          synapse_model_id,
+          param_dicts[ tid ],
+          delays ? delays[ i ] : numerics::nan,
+          weights ? weights[ i ] : numerics::nan );
+
+        // The same entries are read for all connections, so checking the first connection suffices.
+        if ( not entries_checked )
+        {
+          ALL_ENTRIES_ACCESSED( *param_dicts[ tid ], "connect_arrays", "Unread dictionary entries: " );
+          entries_checked = true;
+        }
       }
     }
     catch ( std::exception& err )
@@ -822,6 +930,333 @@ nest::ConnectionManager::connect_sonata( const DictionaryDatum& graph_specs, con
 #endif
 }
 
+// Identification and version of the connectivity snapshot format
+static const char connectivity_magic[ 8 ] = { 'N', 'E', 'S', 'T', 'C', 'O', 'N', 'N' };
+static const uint64_t connectivity_format_version = 1;
+
+// Helpers for reading and writing fixed-size entries of connectivity snapshots
+template < typename T >
+static inline void
+write_snapshot_value( std::ostream& out, const T value )
+{
+  out.write( reinterpret_cast< const char* >( &value ), sizeof( T ) );
+}
+
+template < typename T >
+static inline T
+read_snapshot_value( std::istream& in )
+{
+  T value {};
+  in.read( reinterpret_cast< char* >( &value ), sizeof( T ) );
+  return value;
+}
+
+// 64-bit FNV-1a hash, continuing from hash
+static inline uint64_t
+fnv1a_hash( uint64_t hash, const void* data, const size_t num_bytes )
+{
+  const unsigned char* bytes = static_cast< const unsigned char* >( data );
+  for ( size_t i = 0; i < num_bytes; ++i )
+  {
+    hash ^= bytes[ i ];
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+
+uint64_t
+nest::ConnectionManager::get_connectivity_checksum_() const
+{
+  uint64_t checksum = 14695981039346656037ULL;
+  auto add = [ &checksum ]( const uint64_t value ) { checksum = fnv1a_hash( checksum, &value, sizeof( value ) ); };
+
+  add( kernel().mpi_manager.get_num_processes() );
+  add( kernel().vp_manager.get_num_threads() );
+  add( Time::get_resolution().get_tics() );
+  add( kernel().node_manager.size() );
+  for ( auto it = kernel().modelrange_manager.begin(); it != kernel().modelrange_manager.end(); ++it )
+  {
+    add( it->get_first_node_id() );
+    add( it->get_last_node_id() );
+    add( it->get_model_id() );
+  }
+  for ( size_t syn_id = 0; syn_id < kernel().model_manager.get_num_connection_models(); ++syn_id )
+  {
+    const std::string name = kernel().model_manager.get_connection_model( syn_id, 0 ).get_name();
+    checksum = fnv1a_hash( checksum, name.data(), name.size() );
+  }
+
+  return checksum;
+}
+
+std::string
+nest::ConnectionManager::get_connectivity_filename_( const std::string& filename, const size_t tid ) const
+{
+  return String::compose( "%1-%2-%3.conn", filename, kernel().mpi_manager.get_rank(), tid );
+}
+
+void
+nest::ConnectionManager::save_connectivity( const std::string& filename )
+{
+  if ( source_table_.is_cleared() )
+  {
+    throw KernelException(
+      "Connectivity can only be saved while source table is available. "
+      "Set keep_source_table to true before the first simulation." );
+  }
+
+  // Connections of other than static synapse models have time-dependent
+  // state, such as the time of the last presynaptic spike, which refers to
+  // the clock of this simulation and cannot be restored in a new network.
+  if ( kernel().simulation_manager.has_been_simulated() )
+  {
+    std::string non_static_model;
+    for ( synindex syn_id = 0; syn_id < kernel().model_manager.get_num_connection_models(); ++syn_id )
+    {
+      const ConnectorModel& model = kernel().model_manager.get_connection_model( syn_id, 0 );
+      if ( get_num_connections( syn_id ) > 0 and not model.has_property( ConnectionModelProperties::IS_STATIC ) )
+      {
+        non_static_model = model.get_name();
+        break;
+      }
+    }
+
+    // all ranks must throw, also those without connections of the model
+    if ( kernel().mpi_manager.any_true( not non_static_model.empty() ) )
+    {
+      throw KernelException( String::compose(
+        "After Simulate, connectivity can only be saved if all connections use static synapse models%1.",
+        non_static_model.empty() ? "" : ", but " + non_static_model + " is not static" ) );
+    }
+  }
+
+  // thread-local indices identify targets in snapshots
+  kernel().node_manager.ensure_valid_thread_local_ids();
+  const uint64_t checksum = get_connectivity_checksum_();
+
+  std::vector< std::shared_ptr< WrappedThreadException > > exceptions_raised( kernel().vp_manager.get_num_threads() );
+  std::vector< size_t > num_device_connections( kernel().vp_manager.get_num_threads(), 0 );
+
+#pragma omp parallel
+  {
+    const size_t tid = kernel().vp_manager.get_thread_id();
+    try
+    {
+      const std::string thread_filename = get_connectivity_filename_( filename, tid );
+      std::ofstream out( thread_filename, std::ios::binary );
+      if ( not out.good() )
+      {
+        LOG( M_ERROR,
+          "ConnectionManager::save_connectivity",
+          String::compose( "I/O error while opening file '%1'.", thread_filename ) );
+        throw IOError();
+      }
+
+      const DelayChecker& delay_checker = get_delay_checker();
+      const size_t num_syn_ids = connections_[ tid ].size();
+
+      out.write( connectivity_magic, sizeof( connectivity_magic ) );
+      write_snapshot_value< uint64_t >( out, connectivity_format_version );
+      write_snapshot_value< uint64_t >( out, kernel().mpi_manager.get_rank() );
+      write_snapshot_value< uint64_t >( out, tid );
+      write_snapshot_value< uint64_t >( out, checksum );
+      write_snapshot_value< int64_t >( out, delay_checker.get_min_delay().get_steps() );
+      write_snapshot_value< int64_t >( out, delay_checker.get_max_delay().get_steps() );
+      write_snapshot_value< uint64_t >( out, num_syn_ids );
+
+      for ( synindex syn_id = 0; syn_id < num_syn_ids; ++syn_id )
+      {
+        const ConnectorBase* connector = connections_[ tid ][ syn_id ];
+        const size_t num_connections = connector ? connector->size() : 0;
+        write_snapshot_value< uint64_t >( out, num_connections );
+        if ( num_connections == 0 )
+        {
+          continue;
+        }
+
+        connector->write_connections( out, tid );
+
+        const BlockVector< Source >& sources = source_table_.get_thread_local_sources( tid )[ syn_id ];
+        assert( sources.size() == num_connections );
+        for ( const Source& source : sources )
+        {
+          out.write( reinterpret_cast< const char* >( &source ), sizeof( Source ) );
+        }
+      }
+
+      if ( not out.good() )
+      {
+        LOG( M_ERROR,
+          "ConnectionManager::save_connectivity",
+          String::compose( "I/O error while writing file '%1'.", thread_filename ) );
+        throw IOError();
+      }
+
+      for ( synindex syn_id = 0; syn_id < num_connections_[ tid ].size(); ++syn_id )
+      {
+        const size_t num_connector_connections =
+          syn_id < num_syn_ids and connections_[ tid ][ syn_id ] ? connections_[ tid ][ syn_id ]->size() : 0;
+        num_device_connections[ tid ] += num_connections_[ tid ][ syn_id ] - num_connector_connections;
+      }
+    }
+    catch ( std::exception& err )
+    {
+      // We must create a new exception here, err's lifetime ends at the end of the catch block.
+      exceptions_raised.at( tid ) = std::shared_ptr< WrappedThreadException >( new WrappedThreadException( err ) );
+    }
+  }
+
+  for ( size_t tid = 0; tid < kernel().vp_manager.get_num_threads(); ++tid )
+  {
+    if ( exceptions_raised.at( tid ).get() )
+    {
+      throw WrappedThreadException( *( exceptions_raised.at( tid ) ) );
+    }
+  }
+
+  if ( std::accumulate( num_device_connections.begin(), num_device_connections.end(), size_t( 0 ) ) > 0 )
+  {
+    LOG( M_WARNING,
+      "ConnectionManager::save_connectivity",
+      "Connections from and to devices are not included in the connectivity snapshot." );
+  }
+}
+
+void
+nest::ConnectionManager::load_connectivity( const std::string& filename )
+{
+  if ( get_num_connections() > 0 )
+  {
+    throw KernelException( "Connectivity can only be loaded before any connections are created." );
+  }
+
+  kernel().node_manager.ensure_valid_thread_local_ids();
+  const uint64_t checksum = get_connectivity_checksum_();
+
+  // Set flag before entering parallel section in case an exception is thrown after some connections have been
+  // restored.
+  set_connections_have_changed();
+
+  std::vector< std::shared_ptr< WrappedThreadException > > exceptions_raised( kernel().vp_manager.get_num_threads() );
+
+#pragma omp parallel
+  {
+    const size_t tid = kernel().vp_manager.get_thread_id();
+    try
+    {
+      const std::string thread_filename = get_connectivity_filename_( filename, tid );
+      std::ifstream in( thread_filename, std::ios::binary );
+      if ( not in.good() )
+      {
+        LOG( M_ERROR,
+          "ConnectionManager::load_connectivity",
+          String::compose( "I/O error while opening file '%1'.", thread_filename ) );
+        throw IOError();
+      }
+
+      char magic[ sizeof( connectivity_magic ) ];
+      in.read( magic, sizeof( magic ) );
+      if ( not in.good() or not std::equal( magic, magic + sizeof( magic ), connectivity_magic ) )
+      {
+        throw KernelException( String::compose( "File '%1' is not a connectivity snapshot.", thread_filename ) );
+      }
+      if ( read_snapshot_value< uint64_t >( in ) != connectivity_format_version )
+      {
+        throw KernelException(
+          String::compose( "Connectivity snapshot '%1' has unsupported format version.", thread_filename ) );
+      }
+      const uint64_t rank = read_snapshot_value< uint64_t >( in );
+      const uint64_t thread = read_snapshot_value< uint64_t >( in );
+      if ( rank != static_cast< uint64_t >( kernel().mpi_manager.get_rank() ) or thread != tid
+        or read_snapshot_value< uint64_t >( in ) != checksum )
+      {
+        throw KernelException( String::compose(
+          "Connectivity snapshot '%1' does not match the network. Number of ranks and threads, "
+          "resolution, nodes and synapse models must be the same as when the snapshot was saved.",
+          thread_filename ) );
+      }
+      const long min_delay = read_snapshot_value< int64_t >( in );
+      const long max_delay = read_snapshot_value< int64_t >( in );
+      const size_t num_syn_ids = read_snapshot_value< uint64_t >( in );
+      assert( num_syn_ids <= kernel().model_manager.get_num_connection_models() );
+
+      size_t num_restored_connections = 0;
+      for ( synindex syn_id = 0; syn_id < num_syn_ids; ++syn_id )
+      {
+        const size_t num_connections = read_snapshot_value< uint64_t >( in );
+        if ( not in.good() )
+        {
+          break;
+        }
+        if ( num_connections == 0 )
+        {
+          continue;
+        }
+        if ( num_connections > MAX_LCID )
+        {
+          throw KernelException( String::compose( "Connectivity snapshot '%1' is corrupted.", thread_filename ) );
+        }
+
+        reserve_connections( tid, syn_id, num_connections );
+        connections_[ tid ][ syn_id ]->read_connections( in, num_connections, tid );
+
+        BlockVector< Source >& sources = source_table_.get_thread_local_sources( tid )[ syn_id ];
+        for ( size_t i = 0; i < num_connections; ++i )
+        {
+          sources.push_back( read_snapshot_value< Source >( in ) );
+        }
+
+        if ( num_connections_[ tid ].size() <= syn_id )
+        {
+          num_connections_[ tid ].resize( syn_id + 1 );
+        }
+        num_connections_[ tid ][ syn_id ] = num_connections;
+        num_restored_connections += num_connections;
+
+        if ( kernel().model_manager.get_connection_model( syn_id, tid ).has_property(
+               ConnectionModelProperties::IS_PRIMARY ) )
+        {
+#pragma omp atomic write
+          has_primary_connections_ = true;
+          check_primary_connections_.set_true( tid );
+        }
+        else
+        {
+#pragma omp atomic write
+          secondary_connections_exist_ = true;
+          check_secondary_connections_.set_true( tid );
+        }
+      }
+
+      if ( not in.good() )
+      {
+        LOG( M_ERROR,
+          "ConnectionManager::load_connectivity",
+          String::compose( "I/O error while reading file '%1'.", thread_filename ) );
+        throw IOError();
+      }
+
+      if ( num_restored_connections > 0 )
+      {
+        get_delay_checker().assert_two_valid_delays_steps( min_delay, max_delay );
+      }
+    }
+    catch ( std::exception& err )
+    {
+      // We must create a new exception here, err's lifetime ends at the end of the catch block.
+      exceptions_raised.at( tid ) = std::shared_ptr< WrappedThreadException >( new WrappedThreadException( err ) );
+    }
+  }
+
+  for ( size_t tid = 0; tid < kernel().vp_manager.get_num_threads(); ++tid )
+  {
+    if ( exceptions_raised.at( tid ).get() )
+    {
+      throw WrappedThreadException( *( exceptions_raised.at( tid ) ) );
+    }
+  }
+}
+
 void
 nest::ConnectionManager::connect_tripartite( NodeCollectionPTR sources,
   NodeCollectionPTR targets,
@@ -894,7 +1329,33 @@ nest::ConnectionManager::connect_( Node& source,
   const double weight )
 {
   ConnectorModel& conn_model = kernel().model_manager.get_connection_model( syn_id, tid );
+  check_archiving_( conn_model, target );
+
+  conn_model.add_connection( source, target, connections_[ tid ], syn_id, params, delay, weight );
+  register_connection_( conn_model, s_node_id, tid, syn_id );
+}
+
+void
+nest::ConnectionManager::connect_( Node& source,
+  Node& target,
+  const size_t s_node_id,
+  const size_t tid,
+  const synindex syn_id,
+  const BoundParameterColumns& params,
+  const size_t index,
+  const double delay,
+  const double weight )
+{
+  ConnectorModel& conn_model = kernel().model_manager.get_connection_model( syn_id, tid );
+  check_archiving_( conn_model, target );
 
+  conn_model.add_connection( source, target, connections_[ tid ], syn_id, params, index, delay, weight );
+  register_connection_( conn_model, s_node_id, tid, syn_id );
+}
+
+void
+nest::ConnectionManager::check_archiving_( const ConnectorModel& conn_model, Node& target ) const
+{
   const bool clopath_archiving = conn_model.has_property( ConnectionModelProperties::REQUIRES_CLOPATH_ARCHIVING );
   if ( clopath_archiving and not dynamic_cast< ClopathArchivingNode* >( &target ) )
   {
@@ -914,9 +1375,15 @@ nest::ConnectionManager::connect_( Node& source,
   {
     throw NotImplemented( "This synapse model is not supported by the neuron model of at least one connection." );
   }
+}
 
+void
+nest::ConnectionManager::register_connection_( const ConnectorModel& conn_model,
+  const size_t s_node_id,
+  const size_t tid,
+  const synindex syn_id )
+{
   const bool is_primary = conn_model.has_property( ConnectionModelProperties::IS_PRIMARY );
-  conn_model.add_connection( source, target, connections_[ tid ], syn_id, params, delay, weight );
   source_table_.add_source( tid, syn_id, s_node_id, is_primary );
 
   increase_connection_count( tid, syn_id );
@@ -1030,6 +1497,12 @@ nest::ConnectionManager::disconnect( const size_t tid,
   connections_[ tid ][ syn_id ]->disable_connection( lcid );
   source_table_.disable_connection( tid, syn_id, lcid );
 
+  // targets on the presynaptic side refer to positions of connections,
+  // which change when disabled connections are removed; disconnect() is
+  // called by all threads in parallel
+#pragma omp atomic write
+  connection_infrastructure_extendable_ = false;
+
   --num_connections_[ tid ][ syn_id ];
 }
 
@@ -1095,31 +1568,33 @@ nest::ConnectionManager::get_num_connections( const synindex syn_id ) const
   return num_connections;
 }
 
-ArrayDatum
-nest::ConnectionManager::get_connections( const DictionaryDatum& params )
+std::vector< nest::synindex >
+nest::ConnectionManager::prepare_connection_query_( const DictionaryDatum& params,
+  NodeCollectionPTR& source,
+  NodeCollectionPTR& target,
+  long& synapse_label )
 {
-  std::deque< ConnectionID > connectome;
   const Token& source_t = params->lookup( names::source );
   const Token& target_t = params->lookup( names::target );
   const Token& syn_model_t = params->lookup( names::synapse_model );
-  NodeCollectionPTR source_a = NodeCollectionPTR( nullptr );
-  NodeCollectionPTR target_a = NodeCollectionPTR( nullptr );
+  source = NodeCollectionPTR( nullptr );
+  target = NodeCollectionPTR( nullptr );
 
-  long synapse_label = UNLABELED_CONNECTION;
+  synapse_label = UNLABELED_CONNECTION;
   updateValue< long >( params, names::synapse_label, synapse_label );
 
   if ( not source_t.empty() )
   {
-    source_a = getValue< NodeCollectionDatum >( source_t );
-    if ( not source_a->valid() )
+    source = getValue< NodeCollectionDatum >( source_t );
+    if ( not source->valid() )
     {
       throw KernelException( "GetConnection requires valid source NodeCollection." );
     }
   }
   if ( not target_t.empty() )
   {
-    target_a = getValue< NodeCollectionDatum >( target_t );
-    if ( not target_a->valid() )
+    target = getValue< NodeCollectionDatum >( target_t );
+    if ( not target->valid() )
     {
       throw KernelException( "GetConnection requires valid target NodeCollection." );
     }
@@ -1146,21 +1621,37 @@ nest::ConnectionManager::get_connections( const DictionaryDatum& params )
   }
 
   // We check, whether a synapse model is given. If not, we will iterate all.
-  size_t syn_id = 0;
+  std::vector< synindex > syn_ids;
   if ( not syn_model_t.empty() )
   {
     const std::string synmodel_name = getValue< std::string >( syn_model_t );
     // The following throws UnknownSynapseType for invalid synmodel_name
-    syn_id = kernel().model_manager.get_synapse_model_id( synmodel_name );
-    get_connections( connectome, source_a, target_a, syn_id, synapse_label );
+    syn_ids.push_back( kernel().model_manager.get_synapse_model_id( synmodel_name ) );
   }
   else
   {
-    for ( syn_id = 0; syn_id < kernel().model_manager.get_num_connection_models(); ++syn_id )
+    for ( synindex syn_id = 0; syn_id < kernel().model_manager.get_num_connection_models(); ++syn_id )
     {
-      get_connections( connectome, source_a, target_a, syn_id, synapse_label );
+      syn_ids.push_back( syn_id );
     }
   }
+
+  return syn_ids;
+}
+
+ArrayDatum
+nest::ConnectionManager::get_connections( const DictionaryDatum& params )
+{
+  std::deque< ConnectionID > connectome;
+  NodeCollectionPTR source_a;
+  NodeCollectionPTR target_a;
+  long synapse_label;
+
+  const std::vector< synindex > syn_ids = prepare_connection_query_( params, source_a, target_a, synapse_label );
+  for ( const synindex syn_id : syn_ids )
+  {
+    get_connections( connectome, source_a, target_a, syn_id, synapse_label );
+  }
   printf("Rank %ld, INSIDE GetConnection size %zu. nestkernel/connection_manager.cpp\n", kernel().mpi_manager.get_rank(), connectome.size());
 
   ArrayDatum result;
@@ -1245,6 +1736,177 @@ nest::ConnectionManager::get_connections( const DictionaryDatum& params )
   return result;
 }
 
+DictionaryDatum
+nest::ConnectionManager::get_connection_columns( const DictionaryDatum& params, const std::vector< Name >& parameters )
+{
+  const std::vector< Name > id_columns = {
+    names::source, names::target, names::target_thread, names::synapse_modelid, names::port
+  };
+  for ( const Name& parameter : parameters )
+  {
+    if ( std::find( id_columns.begin(), id_columns.end(), parameter ) != id_columns.end() )
+    {
+      throw BadProperty(
+        String::compose( "'%1' is always returned and cannot be requested as synapse parameter.", parameter ) );
+    }
+  }
+
+  NodeCollectionPTR source;
+  NodeCollectionPTR target;
+  long synapse_label;
+  const std::vector< synindex > syn_ids = prepare_connection_query_( params, source, target, synapse_label );
+
+  if ( is_source_table_cleared() )
+  {
+    throw KernelException(
+      "Invalid attempt to access connection information: source table was "
+      "cleared." );
+  }
+
+  // Parameters must be known to all synapse models with connections to search
+  for ( const synindex syn_id : syn_ids )
+  {
+    if ( parameters.empty() or get_num_connections( syn_id ) == 0 )
+    {
+      continue;
+    }
+
+    const DictionaryDatum defaults = kernel().model_manager.get_connector_defaults( syn_id );
+    for ( const Name& parameter : parameters )
+    {
+      if ( not defaults->known( parameter ) )
+      {
+        throw BadProperty( String::compose( "Synapse model '%1' has no parameter '%2'.",
+          kernel().model_manager.get_connection_model( syn_id, 0 ).get_name(),
+          parameter ) );
+      }
+    }
+  }
+
+  // Each thread collects the connections it owns into thread-local columns,
+  // which are concatenated in thread order below.
+  const size_t num_threads = kernel().vp_manager.get_num_threads();
+  std::vector< ConnectionColumns > thread_columns( num_threads, ConnectionColumns( parameters ) );
+  std::vector< std::vector< long > > thread_target_threads( num_threads );
+  std::vector< std::vector< long > > thread_synapse_ids( num_threads );
+  std::vector< std::shared_ptr< WrappedThreadException > > exceptions_raised( num_threads );
+
+#pragma omp parallel
+  {
+    const size_t tid = kernel().vp_manager.get_thread_id();
+    try
+    {
+      ConnectionColumns& columns = thread_columns[ tid ];
+
+      std::deque< ConnectionID > device_conns;
+      for ( const synindex syn_id : syn_ids )
+      {
+        if ( get_num_connections( syn_id ) == 0 )
+        {
+          continue;
+        }
+
+        get_connection_columns_in_thread_( tid, columns, device_conns, source, target, syn_id, synapse_label );
+
+        // Connections from and to devices are few, so their parameters are
+        // read from their status dictionaries
+        while ( not device_conns.empty() )
+        {
+          const ConnectionID& conn = device_conns.front();
+          columns.sources.push_back( conn.get_source_node_id() );
+          columns.targets.push_back( conn.get_target_node_id() );
+          columns.ports.push_back( conn.get_port() );
+
+          if ( not parameters.empty() )
+          {
+            const DictionaryDatum status = get_synapse_status(
+              conn.get_source_node_id(), conn.get_target_node_id(), tid, syn_id, conn.get_port() );
+            for ( size_t i = 0; i < parameters.size(); ++i )
+            {
+              const Token& value = status->lookup( parameters[ i ] );
+              if ( value.empty() )
+              {
+                throw BadProperty( String::compose( "Synapse model '%1' has no parameter '%2'.",
+                  kernel().model_manager.get_connection_model( syn_id, tid ).get_name(),
+                  parameters[ i ] ) );
+              }
+              columns.values[ i ].push_back( getValue< double >( value ) );
+            }
+          }
+
+          device_conns.pop_front();
+        }
+
+        thread_target_threads[ tid ].resize( columns.size(), tid );
+        thread_synapse_ids[ tid ].resize( columns.size(), syn_id );
+      }
+    }
+    catch ( std::exception& err )
+    {
+      // We must create a new exception here, err's lifetime ends at the end of the catch block.
+      exceptions_raised.at( tid ) = std::shared_ptr< WrappedThreadException >( new WrappedThreadException( err ) );
+    }
+  } // of omp parallel
+
+  for ( size_t tid = 0; tid < num_threads; ++tid )
+  {
+    if ( exceptions_raised.at( tid ).get() )
+    {
+      throw WrappedThreadException( *( exceptions_raised.at( tid ) ) );
+    }
+  }
+
+  std::vector< size_t > offsets( num_threads + 1, 0 );
+  for ( size_t tid = 0; tid < num_threads; ++tid )
+  {
+    offsets[ tid + 1 ] = offsets[ tid ] + thread_columns[ tid ].size();
+  }
+  const size_t num_connections = offsets[ num_threads ];
+
+  // The result dictionary owns the columns, which are then filled in place.
+  DictionaryDatum result( new Dictionary );
+  std::vector< std::vector< long >* > id_result( id_columns.size() );
+  for ( size_t i = 0; i < id_columns.size(); ++i )
+  {
+    id_result[ i ] = new std::vector< long >( num_connections );
+    ( *result )[ id_columns[ i ] ] = IntVectorDatum( id_result[ i ] );
+  }
+  std::vector< std::vector< double >* > parameter_result( parameters.size() );
+  for ( size_t i = 0; i < parameters.size(); ++i )
+  {
+    parameter_result[ i ] = new std::vector< double >( num_connections );
+    ( *result )[ parameters[ i ] ] = DoubleVectorDatum( parameter_result[ i ] );
+  }
+
+#pragma omp parallel
+  {
+    const size_t tid = kernel().vp_manager.get_thread_id();
+    ConnectionColumns& columns = thread_columns[ tid ];
+
+    // in the order of id_columns
+    const std::vector< std::vector< long >* > id_cols = {
+      &columns.sources, &columns.targets, &thread_target_threads[ tid ], &thread_synapse_ids[ tid ], &columns.ports
+    };
+    for ( size_t i = 0; i < id_columns.size(); ++i )
+    {
+      std::vector< long >& col = *id_cols[ i ];
+      std::copy( col.begin(), col.end(), id_result[ i ]->begin() + offsets[ tid ] );
+      std::vector< long >().swap( col );
+    }
+    for ( size_t i = 0; i < parameters.size(); ++i )
+    {
+      std::vector< double >& col = columns.values[ i ];
+      std::copy( col.begin(), col.end(), parameter_result[ i ]->begin() + offsets[ tid ] );
+      std::vector< double >().swap( col );
+    }
+  } // of omp parallel
+
+  // Columns contain connection descriptors that are invalidated by new connections.
+  get_connections_has_been_called_ = true;
+
+  return result;
+}
+
 // Helper method which removes ConnectionIDs from input deque and
 // appends them to output deque.
 static inline std::deque< nest::ConnectionID >&
@@ -1305,168 +1967,169 @@ nest::ConnectionManager::get_connections( std::deque< ConnectionID >& connectome
     return;
   }
 
-  if ( not source.get() and not target.get() )
-  {
 #pragma omp parallel
-    {
-      size_t tid = kernel().vp_manager.get_thread_id();
+  {
+    const size_t tid = kernel().vp_manager.get_thread_id();
 
-      std::deque< ConnectionID > conns_in_thread;
+    std::deque< ConnectionID > conns_in_thread;
+    get_connections_in_thread_( tid, conns_in_thread, source, target, syn_id, synapse_label );
 
-      ConnectorBase* connections = connections_[ tid ][ syn_id ];
-      if ( connections )
+    if ( conns_in_thread.size() > 0 )
+    {
+#pragma omp critical( get_connections )
       {
-        // Passing target_node_id = 0 ignores target_node_id while getting connections.
-        const size_t num_connections_in_thread = connections->size();
-        for ( size_t lcid = 0; lcid < num_connections_in_thread; ++lcid )
-        {
-          const size_t source_node_id = source_table_.get_node_id( tid, syn_id, lcid );
-          connections->get_connection( source_node_id, 0, tid, lcid, synapse_label, conns_in_thread );
-        }
+        extend_connectome( connectome, conns_in_thread );
       }
+    }
+  } // of omp parallel
+}
 
-      target_table_devices_.get_connections( 0, 0, tid, syn_id, synapse_label, conns_in_thread );
+void
+nest::ConnectionManager::get_connections_in_thread_( const size_t tid,
+  std::deque< ConnectionID >& conns_in_thread,
+  NodeCollectionPTR source,
+  NodeCollectionPTR target,
+  const synindex syn_id,
+  const long synapse_label ) const
+{
+  // Split targets into neuron- and device-vectors.
+  std::vector< size_t > target_neuron_node_ids;
+  std::vector< size_t > target_device_node_ids;
+  if ( target.get() )
+  {
+    split_to_neuron_device_vectors_( tid, target, target_neuron_node_ids, target_device_node_ids );
+  }
 
-      if ( conns_in_thread.size() > 0 )
-      {
-#pragma omp critical( get_connections )
-        {
-          extend_connectome( connectome, conns_in_thread );
-        }
-      }
-    } // of omp parallel
-    return;
-  } // if
-  else if ( not source.get() and target.get() )
+  const ConnectorBase* connections = connections_[ tid ][ syn_id ];
+  if ( connections )
   {
-#pragma omp parallel
+    const size_t num_connections_in_thread = connections->size();
+    for ( size_t lcid = 0; lcid < num_connections_in_thread; ++lcid )
     {
-      size_t tid = kernel().vp_manager.get_thread_id();
-
-      std::deque< ConnectionID > conns_in_thread;
-
-      // Split targets into neuron- and device-vectors.
-      std::vector< size_t > target_neuron_node_ids;
-      std::vector< size_t > target_device_node_ids;
-      split_to_neuron_device_vectors_( tid, target, target_neuron_node_ids, target_device_node_ids );
-
-      // Getting regular connections, if they exist.
-      ConnectorBase* connections = connections_[ tid ][ syn_id ];
-      if ( connections )
+      const size_t source_node_id = source_table_.get_node_id( tid, syn_id, lcid );
+      if ( source.get() and not source->contains( source_node_id ) )
       {
-        const size_t num_connections_in_thread = connections->size();
-        for ( size_t lcid = 0; lcid < num_connections_in_thread; ++lcid )
-        {
-          const size_t source_node_id = source_table_.get_node_id( tid, syn_id, lcid );
-          connections->get_connection_with_specified_targets(
-            source_node_id, target_neuron_node_ids, tid, lcid, synapse_label, conns_in_thread );
-        }
+        continue;
       }
 
-      // Getting connections from devices.
-      for ( auto t_node_id : target_neuron_node_ids )
+      if ( not target.get() )
       {
-        target_table_devices_.get_connections_from_devices_(
-          0, t_node_id, tid, syn_id, synapse_label, conns_in_thread );
+        // Passing target_node_id = 0 ignores target_node_id while getting
+        // connections.
+        connections->get_connection( source_node_id, 0, tid, lcid, synapse_label, conns_in_thread );
       }
-
-      // Getting connections to devices.
-      for ( auto t_device_id : target_device_node_ids )
+      else
       {
-        target_table_devices_.get_connections_to_devices_(
-          0, t_device_id, tid, syn_id, synapse_label, conns_in_thread );
+        connections->get_connection_with_specified_targets(
+          source_node_id, target_neuron_node_ids, tid, lcid, synapse_label, conns_in_thread );
       }
+    }
+  }
 
-      if ( conns_in_thread.size() > 0 )
-      {
-#pragma omp critical( get_connections )
-        {
-          extend_connectome( connectome, conns_in_thread );
-        }
-      }
-    } // of omp parallel
-    return;
-  } // else if
-  else if ( source.get() )
+  get_device_connections_in_thread_(
+    tid, conns_in_thread, source, target, target_neuron_node_ids, target_device_node_ids, syn_id, synapse_label );
+}
+
+void
+nest::ConnectionManager::get_device_connections_in_thread_( const size_t tid,
+  std::deque< ConnectionID >& conns_in_thread,
+  NodeCollectionPTR source,
+  NodeCollectionPTR target,
+  const std::vector< size_t >& target_neuron_node_ids,
+  const std::vector< size_t >& target_device_node_ids,
+  const synindex syn_id,
+  const long synapse_label ) const
+{
+  if ( not source.get() and not target.get() )
   {
-#pragma omp parallel
+    target_table_devices_.get_connections( 0, 0, tid, syn_id, synapse_label, conns_in_thread );
+  }
+  else if ( not source.get() and target.get() )
+  {
+    // Getting connections from devices.
+    for ( auto t_node_id : target_neuron_node_ids )
     {
-      size_t tid = kernel().vp_manager.get_thread_id();
-
-      std::deque< ConnectionID > conns_in_thread;
+      target_table_devices_.get_connections_from_devices_( 0, t_node_id, tid, syn_id, synapse_label, conns_in_thread );
+    }
 
-      // Split targets into neuron- and device-vectors.
-      std::vector< size_t > target_neuron_node_ids;
-      std::vector< size_t > target_device_node_ids;
-      if ( target.get() )
+    // Getting connections to devices.
+    for ( auto t_device_id : target_device_node_ids )
+    {
+      target_table_devices_.get_connections_to_devices_( 0, t_device_id, tid, syn_id, synapse_label, conns_in_thread );
+    }
+  }
+  else if ( source.get() )
+  {
+    NodeCollection::const_iterator s_id = source->begin();
+    for ( ; s_id < source->end(); ++s_id )
+    {
+      const size_t source_node_id = ( *s_id ).node_id;
+      if ( not target.get() )
       {
-        split_to_neuron_device_vectors_( tid, target, target_neuron_node_ids, target_device_node_ids );
+        target_table_devices_.get_connections( source_node_id, 0, tid, syn_id, synapse_label, conns_in_thread );
       }
-
-      const ConnectorBase* connections = connections_[ tid ][ syn_id ];
-      if ( connections )
-      {
-        const size_t num_connections_in_thread = connections->size();
-        for ( size_t lcid = 0; lcid < num_connections_in_thread; ++lcid )
-        {
-          const size_t source_node_id = source_table_.get_node_id( tid, syn_id, lcid );
-          if ( source->contains( source_node_id ) )
-          {
-            if ( not target.get() )
-            {
-              // Passing target_node_id = 0 ignores target_node_id while getting
-              // connections.
-              connections->get_connection( source_node_id, 0, tid, lcid, synapse_label, conns_in_thread );
-            }
-            else
-            {
-              connections->get_connection_with_specified_targets(
-                source_node_id, target_neuron_node_ids, tid, lcid, synapse_label, conns_in_thread );
-            }
-          }
-        }
-      }
-
-      NodeCollection::const_iterator s_id = source->begin();
-      for ( ; s_id < source->end(); ++s_id )
+      else
       {
-        const size_t source_node_id = ( *s_id ).node_id;
-        if ( not target.get() )
+        for ( std::vector< size_t >::const_iterator t_node_id = target_neuron_node_ids.begin();
+              t_node_id != target_neuron_node_ids.end();
+              ++t_node_id )
         {
-          target_table_devices_.get_connections( source_node_id, 0, tid, syn_id, synapse_label, conns_in_thread );
+          // target_table_devices_ contains connections both to and from
+          // devices. First we get connections from devices.
+          target_table_devices_.get_connections_from_devices_(
+            source_node_id, *t_node_id, tid, syn_id, synapse_label, conns_in_thread );
         }
-        else
+        for ( std::vector< size_t >::const_iterator t_node_id = target_device_node_ids.begin();
+              t_node_id != target_device_node_ids.end();
+              ++t_node_id )
         {
-          for ( std::vector< size_t >::const_iterator t_node_id = target_neuron_node_ids.begin();
-                t_node_id != target_neuron_node_ids.end();
-                ++t_node_id )
-          {
-            // target_table_devices_ contains connections both to and from
-            // devices. First we get connections from devices.
-            target_table_devices_.get_connections_from_devices_(
-              source_node_id, *t_node_id, tid, syn_id, synapse_label, conns_in_thread );
-          }
-          for ( std::vector< size_t >::const_iterator t_node_id = target_device_node_ids.begin();
-                t_node_id != target_device_node_ids.end();
-                ++t_node_id )
-          {
-            // Then, we get connections to devices.
-            target_table_devices_.get_connections_to_devices_(
-              source_node_id, *t_node_id, tid, syn_id, synapse_label, conns_in_thread );
-          }
+          // Then, we get connections to devices.
+          target_table_devices_.get_connections_to_devices_(
+            source_node_id, *t_node_id, tid, syn_id, synapse_label, conns_in_thread );
         }
       }
+    }
+  }
+}
 
-      if ( conns_in_thread.size() > 0 )
+void
+nest::ConnectionManager::get_connection_columns_in_thread_( const size_t tid,
+  ConnectionColumns& columns,
+  std::deque< ConnectionID >& device_conns,
+  NodeCollectionPTR source,
+  NodeCollectionPTR target,
+  const synindex syn_id,
+  const long synapse_label ) const
+{
+  // Split targets into neuron- and device-vectors.
+  std::vector< size_t > target_neuron_node_ids;
+  std::vector< size_t > target_device_node_ids;
+  if ( target.get() )
+  {
+    split_to_neuron_device_vectors_( tid, target, target_neuron_node_ids, target_device_node_ids );
+  }
+
+  const ConnectorBase* connections = connections_[ tid ][ syn_id ];
+  if ( connections )
+  {
+    const std::vector< size_t >* target_node_ids = target.get() ? &target_neuron_node_ids : nullptr;
+    connections->bind_connection_columns( columns );
+
+    const size_t num_connections_in_thread = connections->size();
+    for ( size_t lcid = 0; lcid < num_connections_in_thread; ++lcid )
+    {
+      const size_t source_node_id = source_table_.get_node_id( tid, syn_id, lcid );
+      if ( source.get() and not source->contains( source_node_id ) )
       {
-#pragma omp critical( get_connections )
-        {
-          extend_connectome( connectome, conns_in_thread );
-        }
+        continue;
       }
-    } // of omp parallel
-    return;
-  } // else if
+
+      connections->get_connection_columns( source_node_id, target_node_ids, tid, lcid, synapse_label, columns );
+    }
+  }
+
+  get_device_connections_in_thread_(
+    tid, device_conns, source, target, target_neuron_node_ids, target_device_node_ids, syn_id, synapse_label );
 }
 
 void
@@ -1538,7 +2201,8 @@ nest::ConnectionManager::sort_connections( const size_t tid )
     {
       if ( connections_[ tid ][ syn_id ] )
       {
-        connections_[ tid ][ syn_id ]->sort_connections( source_table_.get_thread_local_sources( tid )[ syn_id ] );
+        connections_[ tid ][ syn_id ]->sort_connections(
+          source_table_.get_thread_local_sources( tid )[ syn_id ], use_radix_sort_ );
       }
     }
     remove_disabled_connections( tid );
@@ -1548,6 +2212,12 @@ nest::ConnectionManager::sort_connections( const size_t tid )
 void
 nest::ConnectionManager::compute_target_data_buffer_size()
 {
+  if ( kernel().event_delivery_manager.use_pipelined_target_data_exchange() )
+  {
+    compute_target_data_buffer_size_per_rank_();
+    return;
+  }
+
   // Determine number of target data on this rank. Since each thread
   // has its own data structures, we need to count connections on every
   // thread separately to compute the total number of sources.
@@ -1571,6 +2241,39 @@ nest::ConnectionManager::compute_target_data_buffer_size()
   kernel().mpi_manager.set_buffer_size_target_data( std::max( min_num_target_data, max_num_target_data ) );
 }
 
+void
+nest::ConnectionManager::compute_target_data_buffer_size_per_rank_()
+{
+  // Each round of communication exchanges equally sized sections between
+  // all pairs of ranks. Determine the number of target data sent from this
+  // rank to each rank, such that a single round suffices if sections can
+  // hold the largest of these numbers.
+  const size_t num_processes = kernel().mpi_manager.get_num_processes();
+  std::vector< size_t > num_target_data_per_rank( num_processes, 0 );
+  for ( size_t tid = 0; tid < kernel().vp_manager.get_num_threads(); ++tid )
+  {
+    for ( synindex syn_id = 0; syn_id < connections_[ tid ].size(); ++syn_id )
+    {
+      if ( connections_[ tid ][ syn_id ] )
+      {
+        source_table_.count_unique_sources_per_rank( tid, syn_id, num_target_data_per_rank );
+      }
+    }
+  }
+
+  std::vector< long > global_max_num_target_data_per_rank( num_processes );
+  global_max_num_target_data_per_rank[ kernel().mpi_manager.get_rank() ] =
+    *std::max_element( num_target_data_per_rank.begin(), num_target_data_per_rank.end() );
+  kernel().mpi_manager.communicate( global_max_num_target_data_per_rank );
+  const size_t max_num_target_data_per_rank =
+    *std::max_element( global_max_num_target_data_per_rank.begin(), global_max_num_target_data_per_rank.end() );
+
+  // MPI buffers should have at least two entries per process; the size is
+  // limited by max_buffer_size_target_data
+  kernel().mpi_manager.set_buffer_size_target_data(
+    num_processes * std::max( static_cast< size_t >( 2 ), max_num_target_data_per_rank ) );
+}
+
 void
 nest::ConnectionManager::compute_compressed_secondary_recv_buffer_positions( const size_t tid )
 {
@@ -1856,7 +2559,21 @@ nest::ConnectionManager::set_connections_have_changed()
 void
 nest::ConnectionManager::unset_connections_have_changed()
 {
+  // called once the connection infrastructure reflects all connections
   connections_have_changed_ = false;
+  connection_infrastructure_extendable_ = true;
+}
+
+void
+nest::ConnectionManager::determine_incremental_update()
+{
+  // the source table is only cleared if it is not kept
+  const bool incremental_update = use_incremental_connection_update_ and connection_infrastructure_extendable_
+    and keep_source_table_ and not secondary_connections_exist_
+    and not kernel().sp_manager.is_structural_plasticity_enabled();
+
+  // all ranks need to take part in the same kind of update
+  incremental_update_ = not kernel().mpi_manager.any_true( not incremental_update );
 }
 
 
@@ -1877,7 +2594,7 @@ nest::ConnectionManager::collect_compressed_spike_data( const size_t tid )
     kernel().get_omp_synchronization_construction_stopwatch().stop();
 #pragma omp single
     {
-      source_table_.fill_compressed_spike_data( compressed_spike_data_ );
+      source_table_.fill_compressed_spike_data( compressed_spike_data_, incremental_update_ );
     } // of omp single; implicit barrier
   }
 }
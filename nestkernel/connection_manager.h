@@ -170,12 +170,23 @@ public:
    */
   bool connect( const size_t snode_id, const size_t target, const DictionaryDatum& params, const synindex syn_id );
 
+  /**
+   * Allocate memory for n further connections of the given synapse model
+   * on thread tid.
+   *
+   * Connection builders call this before creating connections whose number
+   * is known in advance, so that connectors and source table are filled
+   * without repeated allocations. Reserving memory for connections that are
+   * not created subsequently wastes memory, but is otherwise harmless.
+   */
+  void reserve_connections( const size_t tid, const synindex syn_id, const size_t n );
+
   void connect_arrays( long* sources,
     long* targets,
     double* weights,
     double* delays,
     std::vector< std::string >& p_keys,
-    double* p_values,
+    std::vector< double* >& p_values,
     size_t n,
     std::string syn_model );
 
@@ -190,6 +201,37 @@ public:
    */
   void connect_sonata( const DictionaryDatum& graph_specs, const long hyberslab_size );
 
+  /**
+   * @brief Write connectivity snapshot.
+   *
+   * Each thread of each rank writes the connections stored in its
+   * connectors, together with the corresponding sources and delay extrema,
+   * to the binary file `<filename>-<rank>-<thread>.conn`.
+   *
+   * Each file starts with a header (magic string, format version, rank,
+   * thread, topology checksum, delay extrema, number of synapse types),
+   * followed by one section per synapse type holding the number of
+   * connections, the thread-local indices of their targets, the memory
+   * image of the connections and their sources. All entries are aligned
+   * to eight bytes.
+   *
+   * Connections from and to devices are not included, nor is the state
+   * of the nodes. After Simulate, only connections of static synapse
+   * models can be saved, since the time-dependent state of other synapse
+   * models, such as the time of the last presynaptic spike, refers to the
+   * clock of the current simulation. Throws KernelException otherwise.
+   */
+  void save_connectivity( const std::string& filename );
+
+  /**
+   * @brief Restore connections from a connectivity snapshot.
+   *
+   * Nodes must have been created exactly as when the snapshot was written,
+   * with the same number of ranks and threads, and no connections may exist.
+   * This is checked against the topology checksum in the snapshot.
+   */
+  void load_connectivity( const std::string& filename );
+
   /**
    * @brief Create tripartite connections
    *
@@ -254,6 +296,17 @@ public:
     synindex syn_id,
     long synapse_label ) const;
 
+  /**
+   * Return connections as columns instead of individual connection IDs.
+   *
+   * Connections are selected by the same params dictionary as for
+   * get_connections(). The result contains the integer vectors 'source',
+   * 'target', 'target_thread', 'synapse_modelid' and 'port', and one double
+   * vector for each of the given synapse parameters. Columns are filled in
+   * parallel by all threads and ordered by thread and synapse model.
+   */
+  DictionaryDatum get_connection_columns( const DictionaryDatum& params, const std::vector< Name >& parameters );
+
   /**
    * Returns the number of connections in the network.
    */
@@ -307,6 +360,18 @@ public:
     const std::vector< ConnectorModel* >& cm,
     Event& e );
 
+  /**
+   * Send spikes to connections of synapse type syn_id on thread tid.
+   *
+   * @see ConnectorBase::send_batch()
+   */
+  void send_batch( const size_t tid,
+    const synindex syn_id,
+    const BatchedSpike* spikes,
+    const size_t num_spikes,
+    const std::vector< ConnectorModel* >& cm,
+    SpikeEvent& e );
+
   /**
    * Send event e to all device targets of source source_node_id
    */
@@ -343,6 +408,9 @@ public:
   //! Clears all entries in source table
   void clear_source_table( const size_t tid );
 
+  //! Compresses sorted entries in source table if compress_source_table is set
+  void compress_source_table( const size_t tid );
+
   //! Returns true if source table is kept after building network
   bool get_keep_source_table() const;
 
@@ -421,9 +489,32 @@ public:
    * created after connections have been communicated previously. It
    * basically restores the connection infrastructure to a state where
    * all information only exists on the postsynaptic side.
+   *
+   * Does nothing during incremental updates, which keep the TargetTable.
    */
   void restructure_connection_tables( const size_t tid );
 
+  /**
+   * Determines on all ranks whether the following update of the
+   * connection infrastructure can be incremental.
+   *
+   * An incremental update only communicates connections created since
+   * the last update and appends them to the TargetTable. This requires
+   * that no connections have been deleted, that the source table has
+   * been kept and that no secondary connections or structural plasticity
+   * are used. Otherwise, the connection infrastructure is rebuilt.
+   */
+  void determine_incremental_update();
+
+  //! Returns true if the current update of the connection infrastructure is incremental.
+  bool is_incremental_update() const;
+
+  /**
+   * Marks all connections of thread as communicated to the presynaptic
+   * side.
+   */
+  void set_connections_communicated( const size_t tid );
+
   void
   set_source_has_more_targets( const size_t tid, const synindex syn_id, const size_t lcid, const bool more_targets );
 
@@ -487,6 +578,57 @@ private:
     std::vector< size_t >& neuron_node_ids,
     std::vector< size_t >& device_node_ids ) const;
 
+  /**
+   * Parse the selection in the params dictionary of get_connections() and
+   * update the connection infrastructure if necessary.
+   *
+   * Returns the IDs of all synapse models to search.
+   */
+  std::vector< synindex > prepare_connection_query_( const DictionaryDatum& params,
+    NodeCollectionPTR& source,
+    NodeCollectionPTR& target,
+    long& synapse_label );
+
+  /**
+   * Append all connections of thread tid and synapse model syn_id matching
+   * the selection to conns_in_thread.
+   */
+  void get_connections_in_thread_( const size_t tid,
+    std::deque< ConnectionID >& conns_in_thread,
+    NodeCollectionPTR source,
+    NodeCollectionPTR target,
+    const synindex syn_id,
+    const long synapse_label ) const;
+
+  /**
+   * Append all connections from and to devices of thread tid and synapse
+   * model syn_id matching the selection to conns_in_thread. If target is
+   * given, target_neuron_node_ids and target_device_node_ids hold the
+   * targets of thread tid as split by split_to_neuron_device_vectors_().
+   */
+  void get_device_connections_in_thread_( const size_t tid,
+    std::deque< ConnectionID >& conns_in_thread,
+    NodeCollectionPTR source,
+    NodeCollectionPTR target,
+    const std::vector< size_t >& target_neuron_node_ids,
+    const std::vector< size_t >& target_device_node_ids,
+    const synindex syn_id,
+    const long synapse_label ) const;
+
+  /**
+   * Append all connections of thread tid and synapse model syn_id matching
+   * the selection to columns. Connections between neurons are read
+   * directly from the connector, connections from and to devices are
+   * appended to device_conns instead.
+   */
+  void get_connection_columns_in_thread_( const size_t tid,
+    ConnectionColumns& columns,
+    std::deque< ConnectionID >& device_conns,
+    NodeCollectionPTR source,
+    NodeCollectionPTR target,
+    const synindex syn_id,
+    const long synapse_label ) const;
+
   /**
    * Update delay extrema to current values.
    *
@@ -494,6 +636,21 @@ private:
    */
   void update_delay_extrema_();
 
+  /**
+   * Sizes MPI buffers for communication of connections such that each
+   * section can hold the largest number of target data sent from one rank
+   * to another, used with pipelined target data exchange.
+   *
+   * @note This entails MPI communication.
+   */
+  void compute_target_data_buffer_size_per_rank_();
+
+  //! Checksum over all properties of the kernel that a connectivity snapshot depends on
+  uint64_t get_connectivity_checksum_() const;
+
+  //! Name of the snapshot file of the calling rank and thread
+  std::string get_connectivity_filename_( const std::string& filename, const size_t tid ) const;
+
   /**
    * This method queries and finds the minimum delay
    * of all local connections
@@ -539,6 +696,39 @@ private:
     const double delay = numerics::nan,
     const double weight = numerics::nan );
 
+  /**
+   * Version of connect_() taking the parameters of the connection from
+   * columns bound to typed setters of the connection model, which is
+   * used by connect_arrays() to avoid parameter dictionaries.
+   *
+   * \param params The bound parameter columns.
+   * \param index The index of the connection in the columns.
+   */
+  void connect_( Node& source,
+    Node& target,
+    const size_t s_node_id,
+    const size_t tid,
+    const synindex syn_id,
+    const BoundParameterColumns& params,
+    const size_t index,
+    const double delay,
+    const double weight );
+
+  /**
+   * Throw NotImplemented if the target does not provide the archiving
+   * required by the connection model.
+   */
+  void check_archiving_( const ConnectorModel& conn_model, Node& target ) const;
+
+  /**
+   * Register a connection added to connections_ with the source table
+   * and the connection counters.
+   */
+  void register_connection_( const ConnectorModel& conn_model,
+    const size_t s_node_id,
+    const size_t tid,
+    const synindex syn_id );
+
   /**
    * connect_to_device_ is used to establish a connection between a sender and
    * receiving node if the sender has proxies, and the receiver does not.
@@ -661,6 +851,9 @@ private:
   //! Whether to keep source table after connection setup is complete.
   bool keep_source_table_;
 
+  //! Whether to compress the source table until it is cleared after connection setup.
+  bool compress_source_table_;
+
   //! True if new connections have been created since startup or last call to
   //! simulate.
   bool connections_have_changed_;
@@ -678,6 +871,27 @@ private:
    */
   bool use_compressed_spikes_;
 
+  /**
+   * Whether to sort connections by source with radix_sort(), which is
+   * faster for many connections per thread and synapse type but needs
+   * temporary memory, instead of the in-place sort().
+   */
+  bool use_radix_sort_;
+
+  //! Whether connections created after the first update of the connection
+  //! infrastructure may be added by incremental updates.
+  bool use_incremental_connection_update_;
+
+  /**
+   * Whether the presynaptic connection infrastructure contains all
+   * connections except those created since its last update, such that it
+   * can be extended instead of being rebuilt.
+   */
+  bool connection_infrastructure_extendable_;
+
+  //! Whether the current update of the connection infrastructure is incremental.
+  bool incremental_update_;
+
   //! Whether primary connections (spikes) exist.
   bool has_primary_connections_;
 
@@ -735,6 +949,16 @@ ConnectionManager::clear_source_table( const size_t tid )
   }
 }
 
+inline void
+ConnectionManager::compress_source_table( const size_t tid )
+{
+  if ( compress_source_table_ )
+  {
+    assert( not keep_source_table_ );
+    source_table_.compress( tid );
+  }
+}
+
 inline bool
 ConnectionManager::get_keep_source_table() const
 {
@@ -897,12 +1121,43 @@ ConnectionManager::send( const size_t tid,
   connections_[ tid ][ syn_id ]->send( tid, lcid, cm, e );
 }
 
+inline void
+ConnectionManager::send_batch( const size_t tid,
+  const synindex syn_id,
+  const BatchedSpike* spikes,
+  const size_t num_spikes,
+  const std::vector< ConnectorModel* >& cm,
+  SpikeEvent& e )
+{
+  connections_[ tid ][ syn_id ]->send_batch( tid, spikes, num_spikes, cm, e );
+}
+
 inline void
 ConnectionManager::restructure_connection_tables( const size_t tid )
 {
   assert( not source_table_.is_cleared() );
+  if ( incremental_update_ )
+  {
+    return;
+  }
   target_table_.clear( tid );
   source_table_.reset_processed_flags( tid );
+  source_table_.reset_communicated_sources( tid );
+}
+
+inline bool
+ConnectionManager::is_incremental_update() const
+{
+  return incremental_update_;
+}
+
+inline void
+ConnectionManager::set_connections_communicated( const size_t tid )
+{
+  if ( keep_source_table_ )
+  {
+    source_table_.set_sources_communicated( tid );
+  }
 }
 
 inline void
@@ -27,6 +27,7 @@
 #include "config.h"
 
 // C++ includes:
+#include <algorithm>
 #include <cstdlib>
 #include <vector>
 
@@ -42,6 +43,7 @@
 #include "event.h"
 #include "nest_datums.h"
 #include "nest_names.h"
+#include "nest_time.h"
 #include "node.h"
 #include "source.h"
 #include "spikecounter.h"
@@ -53,6 +55,54 @@
 namespace nest
 {
 
+/**
+ * Spike to be delivered by ConnectorBase::send_batch().
+ */
+struct BatchedSpike
+{
+  size_t lcid;   //!< local connection index of first connection of the sending node
+  Time stamp;    //!< time stamp of the spike
+  double offset; //!< offset of precise spike time
+};
+
+/**
+ * Columns of connections filled by ConnectorBase::get_connection_columns().
+ *
+ * The parameters to read are set on construction. Before connections of
+ * a Connector are added, ConnectorBase::bind_connection_columns() binds
+ * each parameter to a typed getter of the connection model.
+ */
+struct ConnectionColumns
+{
+  //! Parameter is read with get_delay()
+  static constexpr long DELAY_GETTER = -1;
+
+  //! Parameter is read from the status dictionary of the connection
+  static constexpr long STATUS_GETTER = -2;
+
+  explicit ConnectionColumns( const std::vector< Name >& parameters )
+    : parameters( parameters )
+    , getter_ids( parameters.size(), STATUS_GETTER )
+    , needs_status( not parameters.empty() )
+    , values( parameters.size() )
+  {
+  }
+
+  size_t
+  size() const
+  {
+    return sources.size();
+  }
+
+  std::vector< long > sources;                 //!< Node IDs of the sources
+  std::vector< long > targets;                 //!< Node IDs of the targets
+  std::vector< long > ports;                   //!< Local connection IDs
+  const std::vector< Name > parameters;        //!< Names of the parameters to read
+  std::vector< long > getter_ids;              //!< Index of the getter of each parameter, or one of the above
+  bool needs_status;                           //!< Whether a parameter is read from the status dictionary
+  std::vector< std::vector< double > > values; //!< One column per parameter
+};
+
 /**
  * Base class to allow storing Connectors for different synapse types
  * in vectors. We define the interface here to avoid casting.
@@ -117,6 +167,25 @@ public:
     const long synapse_label,
     std::deque< ConnectionID >& conns ) const = 0;
 
+  /**
+   * Bind the parameters of columns to the typed getters of the connection
+   * model of this Connector.
+   */
+  virtual void bind_connection_columns( ConnectionColumns& columns ) const = 0;
+
+  /**
+   * Append the connection at position lcid to columns, reading its
+   * parameters with the getters bound by bind_connection_columns(). If
+   * target_node_ids is given, only append the connection if
+   * target_node_ids contains the node ID of its target.
+   */
+  virtual void get_connection_columns( const size_t source_node_id,
+    const std::vector< size_t >* target_node_ids,
+    const size_t tid,
+    const size_t lcid,
+    const long synapse_label,
+    ConnectionColumns& columns ) const = 0;
+
   /**
    * Add ConnectionIDs with given source_node_id to conns, looping over
    * all lcids. If target_node_id is given, only add connection if
@@ -161,6 +230,19 @@ public:
    */
   virtual size_t send( const size_t tid, const size_t lcid, const std::vector< ConnectorModel* >& cm, Event& e ) = 0;
 
+  /**
+   * Send num_spikes spikes to all targets of their sending nodes.
+   *
+   * Equivalent to calling send() for each spike in turn, with stamp, offset
+   * and sender information of e set from the spike. Connections for spikes
+   * further ahead are prefetched while delivering the current spike.
+   */
+  virtual void send_batch( const size_t tid,
+    const BatchedSpike* spikes,
+    const size_t num_spikes,
+    const std::vector< ConnectorModel* >& cm,
+    SpikeEvent& e ) = 0;
+
   virtual void
   send_weight_event( const size_t tid, const unsigned int lcid, Event& e, const CommonSynapseProperties& cp ) = 0;
 
@@ -174,9 +256,10 @@ public:
     const std::vector< ConnectorModel* >& cm ) = 0;
 
   /**
-   * Sort connections according to source node IDs.
+   * Sort connections according to source node IDs, using radix_sort() if
+   * use_radix_sort is true.
    */
-  virtual void sort_connections( BlockVector< Source >& ) = 0;
+  virtual void sort_connections( BlockVector< Source >&, const bool use_radix_sort ) = 0;
 
   /**
    * Set a flag in the connection indicating whether the following
@@ -212,6 +295,20 @@ public:
    */
   virtual void remove_disabled_connections( const size_t first_disabled_index ) = 0;
 
+  /**
+   * Write all connections in binary form to out.
+   *
+   * The thread-local indices of all targets are written first, followed by
+   * the memory image of all connections. Throws NotImplemented for
+   * connection types that cannot be copied bytewise.
+   */
+  virtual void write_connections( std::ostream& out, const size_t tid ) const = 0;
+
+  /**
+   * Append n connections written by write_connections() from in.
+   */
+  virtual void read_connections( std::istream& in, const size_t n, const size_t tid ) = 0;
+
 #ifdef HAVE_SIONLIB
   virtual void dump_connections( const int sionlib_file_id,
     const size_t chunk_size,
@@ -287,6 +384,13 @@ public:
     C_.push_back( std::move( c ) );
   }
 
+  //! Allocate memory for n further connections
+  void
+  reserve( const size_t n )
+  {
+    C_.reserve( C_.size() + n );
+  }
+
   void
   get_connection( const size_t source_node_id,
     const size_t target_node_id,
@@ -332,6 +436,95 @@ public:
     }
   }
 
+  void
+  bind_connection_columns( ConnectionColumns& columns ) const override
+  {
+    columns.needs_status = false;
+    for ( size_t i = 0; i < columns.parameters.size(); ++i )
+    {
+      columns.getter_ids[ i ] = ConnectionColumns::STATUS_GETTER;
+      if ( columns.parameters[ i ] == names::delay )
+      {
+        columns.getter_ids[ i ] = ConnectionColumns::DELAY_GETTER;
+      }
+      else if constexpr ( has_parameter_getters< ConnectionT >::value )
+      {
+        const auto& getters = ConnectionT::get_parameter_getters();
+        for ( size_t k = 0; k < getters.size(); ++k )
+        {
+          if ( getters[ k ].first == columns.parameters[ i ] )
+          {
+            columns.getter_ids[ i ] = k;
+            break;
+          }
+        }
+      }
+      columns.needs_status = columns.needs_status or columns.getter_ids[ i ] == ConnectionColumns::STATUS_GETTER;
+    }
+  }
+
+  void
+  get_connection_columns( const size_t source_node_id,
+    const std::vector< size_t >* target_node_ids,
+    const size_t tid,
+    const size_t lcid,
+    const long synapse_label,
+    ConnectionColumns& columns ) const override
+  {
+    const ConnectionT& conn = C_[ lcid ];
+    if ( conn.is_disabled() or not( synapse_label == UNLABELED_CONNECTION or conn.get_label() == synapse_label ) )
+    {
+      return;
+    }
+
+    const size_t target_node_id = conn.get_target( tid )->get_node_id();
+    if ( target_node_ids
+      and std::find( target_node_ids->begin(), target_node_ids->end(), target_node_id ) == target_node_ids->end() )
+    {
+      return;
+    }
+
+    columns.sources.push_back( source_node_id );
+    columns.targets.push_back( target_node_id );
+    columns.ports.push_back( lcid );
+
+    for ( size_t i = 0; i < columns.parameters.size(); ++i )
+    {
+      const long getter_id = columns.getter_ids[ i ];
+      if ( getter_id == ConnectionColumns::DELAY_GETTER )
+      {
+        columns.values[ i ].push_back( conn.get_delay() );
+      }
+      else if constexpr ( has_parameter_getters< ConnectionT >::value )
+      {
+        if ( getter_id >= 0 )
+        {
+          columns.values[ i ].push_back( ConnectionT::get_parameter_getters()[ getter_id ].second( conn ) );
+        }
+      }
+    }
+
+    if ( columns.needs_status )
+    {
+      // parameters without typed getter are read from the status dictionary of the connection
+      DictionaryDatum status( new Dictionary );
+      conn.get_status( status );
+      for ( size_t i = 0; i < columns.parameters.size(); ++i )
+      {
+        if ( columns.getter_ids[ i ] == ConnectionColumns::STATUS_GETTER )
+        {
+          const Token& token = status->lookup( columns.parameters[ i ] );
+          if ( token.empty() )
+          {
+            throw BadProperty(
+              String::compose( "Synapse has no parameter '%1' of its own.", columns.parameters[ i ] ) );
+          }
+          columns.values[ i ].push_back( getValue< double >( token ) );
+        }
+      }
+    }
+  }
+
   void
   get_all_connections( const size_t source_node_id,
     const size_t target_node_id,
@@ -407,33 +600,16 @@ public:
     typename ConnectionT::CommonPropertiesType const& cp =
       static_cast< GenericConnectorModel< ConnectionT >* >( cm[ syn_id_ ] )->get_common_properties();
 
-    size_t lcid_offset = 0;
-
-    while ( true )
-    {
-      assert( lcid + lcid_offset < C_.size() );
-      ConnectionT& conn = C_[ lcid + lcid_offset ];
-
-      e.set_port( lcid + lcid_offset );
-      if ( not conn.is_disabled() )
-      {
-        // Some synapses, e.g., bernoulli_synapse, may not send an event after all
-        const bool event_sent = conn.send( e, tid, cp );
-        if ( event_sent )
-        {
-          send_weight_event( tid, lcid + lcid_offset, e, cp );
-        }
-      }
-      if ( not conn.source_has_more_targets() )
-      {
-        break;
-      }
-      ++lcid_offset;
-    }
-
-    return 1 + lcid_offset; // event was delivered to at least one target
+    return send_( tid, lcid, cp, e );
   }
 
+  // Implemented in connector_base_impl.h
+  void send_batch( const size_t tid,
+    const BatchedSpike* spikes,
+    const size_t num_spikes,
+    const std::vector< ConnectorModel* >& cm,
+    SpikeEvent& e ) override;
+
   // Implemented in connector_base_impl.h
   void
   send_weight_event( const size_t tid, const unsigned int lcid, Event& e, const CommonSynapseProperties& cp ) override;
@@ -461,9 +637,16 @@ public:
   }
 
   void
-  sort_connections( BlockVector< Source >& sources ) override
+  sort_connections( BlockVector< Source >& sources, const bool use_radix_sort ) override
   {
-    nest::sort( sources, C_ );
+    if ( use_radix_sort )
+    {
+      nest::radix_sort( sources, C_ );
+    }
+    else
+    {
+      nest::sort( sources, C_ );
+    }
   }
 
   void
@@ -522,6 +705,10 @@ public:
     C_.erase( C_.begin() + first_disabled_index, C_.end() );
   }
 
+  void write_connections( std::ostream& out, const size_t tid ) const override;
+
+  void read_connections( std::istream& in, const size_t n, const size_t tid ) override;
+
 #ifdef HAVE_SIONLIB
   void dump_connections( const int sionlib_file_id,
     const size_t chunk_size,
@@ -530,6 +717,59 @@ public:
 #else
   void dump_connections( std::ostream& connections_out, const size_t tid ) override;
 #endif
+
+private:
+  //! Send e to all targets of the sending node of connection lcid
+  size_t
+  send_( const size_t tid, const size_t lcid, typename ConnectionT::CommonPropertiesType const& cp, Event& e )
+  {
+    size_t lcid_offset = 0;
+
+    while ( true )
+    {
+      assert( lcid + lcid_offset < C_.size() );
+      ConnectionT& conn = C_[ lcid + lcid_offset ];
+
+      e.set_port( lcid + lcid_offset );
+      if ( not conn.is_disabled() )
+      {
+        // Some synapses, e.g., bernoulli_synapse, may not send an event after all
+        const bool event_sent = conn.send( e, tid, cp );
+        if ( event_sent )
+        {
+          send_weight_event( tid, lcid + lcid_offset, e, cp );
+        }
+      }
+      if ( not conn.source_has_more_targets() )
+      {
+        break;
+      }
+      ++lcid_offset;
+    }
+
+    return 1 + lcid_offset; // event was delivered to at least one target
+  }
+
+  /**
+   * Variant of send_batch() for static connections if weights are not recorded.
+   *
+   * Weights are added directly to the spike input buffers of targets which
+   * provide one, see Node::get_spike_input_buffer().
+   */
+  void send_batch_static_( const size_t tid,
+    const BatchedSpike* spikes,
+    const size_t num_spikes,
+    typename ConnectionT::CommonPropertiesType const& cp,
+    SpikeEvent& e );
+
+  //! Hint to the processor that connection lcid will be accessed soon
+  void
+  prefetch_( const size_t lcid ) const
+  {
+#ifdef __GNUC__
+    __builtin_prefetch( &C_[ lcid ] );
+#endif
+  }
 };
 
 } // of namespace nest
@@ -22,6 +22,11 @@
 
 #include "connector_base.h"
 
+// C++ includes:
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
 // Includes from nestkernel:
 #include "kernel_manager.h"
 
@@ -65,6 +70,192 @@ Connector< ConnectionT >::send_weight_event( const size_t tid,
   }
 }
 
+template < typename ConnectionT >
+void
+Connector< ConnectionT >::send_batch( const size_t tid,
+  const BatchedSpike* spikes,
+  const size_t num_spikes,
+  const std::vector< ConnectorModel* >& cm,
+  SpikeEvent& e )
+{
+  typename ConnectionT::CommonPropertiesType const& cp =
+    static_cast< GenericConnectorModel< ConnectionT >* >( cm[ syn_id_ ] )->get_common_properties();
+
+  // Static connections always transmit the event and do not change their
+  // state, so there is nothing to do after sending unless weights are recorded.
+  if constexpr ( flag_is_set( ConnectionT::properties, ConnectionModelProperties::IS_STATIC ) )
+  {
+    if ( not cp.get_weight_recorder() )
+    {
+      send_batch_static_( tid, spikes, num_spikes, cp, e );
+      return;
+    }
+  }
+
+  // Number of spikes by which prefetching runs ahead of delivery
+  constexpr size_t PREFETCH_DISTANCE = 4;
+
+  for ( size_t i = 0; i < std::min( PREFETCH_DISTANCE, num_spikes ); ++i )
+  {
+    prefetch_( spikes[ i ].lcid );
+  }
+
+  for ( size_t i = 0; i < num_spikes; ++i )
+  {
+    if ( i + PREFETCH_DISTANCE < num_spikes )
+    {
+      prefetch_( spikes[ i + PREFETCH_DISTANCE ].lcid );
+    }
+
+    e.set_stamp( spikes[ i ].stamp );
+    e.set_offset( spikes[ i ].offset );
+    e.set_sender_node_id_info( tid, syn_id_, spikes[ i ].lcid );
+    send_( tid, spikes[ i ].lcid, cp, e );
+  }
+}
+
+template < typename ConnectionT >
+void
+Connector< ConnectionT >::send_batch_static_( const size_t tid,
+  const BatchedSpike* spikes,
+  const size_t num_spikes,
+  typename ConnectionT::CommonPropertiesType const& cp,
+  SpikeEvent& e )
+{
+  const std::vector< SpikeInputBuffer >& input_buffers =
+    kernel().event_delivery_manager.get_spike_input_buffers( tid );
+
+  // A spike with time stamp t arrives after delay d in ring buffer slot
+  // get_modulo( t + d - 1 - slice origin ), see Event::get_rel_delivery_steps().
+  // Since both terms are less than the number of slots, a single wrap-around
+  // replaces the lookup of the modulo.
+  const long num_slots = kernel().event_delivery_manager.get_num_ring_buffer_slots();
+  const long slot_offset =
+    kernel().event_delivery_manager.get_modulo( 0 ) - 1 - kernel().simulation_manager.get_slice_origin().get_steps();
+  const double multiplicity = e.get_multiplicity();
+
+  constexpr size_t PREFETCH_DISTANCE = 4;
+
+  for ( size_t i = 0; i < std::min( PREFETCH_DISTANCE, num_spikes ); ++i )
+  {
+    prefetch_( spikes[ i ].lcid );
+  }
+
+  for ( size_t i = 0; i < num_spikes; ++i )
+  {
+    if ( i + PREFETCH_DISTANCE < num_spikes )
+    {
+      prefetch_( spikes[ i + PREFETCH_DISTANCE ].lcid );
+    }
+
+    e.set_stamp( spikes[ i ].stamp );
+    e.set_offset( spikes[ i ].offset );
+    e.set_sender_node_id_info( tid, syn_id_, spikes[ i ].lcid );
+    const long slot_base = slot_offset + spikes[ i ].stamp.get_steps();
+
+    size_t lcid = spikes[ i ].lcid;
+    while ( true )
+    {
+      ConnectionT& conn = C_[ lcid ];
+      if ( not conn.is_disabled() )
+      {
+        Node* target = conn.get_target( tid );
+        assert( target->get_thread_lid() < input_buffers.size() );
+        const SpikeInputBuffer& input_buffer = input_buffers[ target->get_thread_lid() ];
+
+        if ( input_buffer.bins )
+        {
+          long slot = slot_base + conn.get_delay_steps();
+          if ( slot >= num_slots )
+          {
+            slot -= num_slots;
+          }
+          assert( 0 <= slot and slot < num_slots );
+
+          const double s = conn.get_transmitted_weight( cp ) * multiplicity;
+          const size_t channel = s > 0 ? input_buffer.excitatory_channel : input_buffer.inhibitory_channel;
+          input_buffer.bins[ slot * input_buffer.stride + channel ] += s;
+        }
+        else
+        {
+          e.set_port( lcid );
+          conn.send( e, tid, cp );
+        }
+      }
+      if ( not conn.source_has_more_targets() )
+      {
+        break;
+      }
+      ++lcid;
+    }
+  }
+}
+
+template < typename ConnectionT >
+void
+Connector< ConnectionT >::write_connections( std::ostream& out, const size_t tid ) const
+{
+  if constexpr ( std::is_trivially_copyable< ConnectionT >::value )
+  {
+    for ( const ConnectionT& conn : C_ )
+    {
+      const size_t thread_lid = conn.get_target( tid )->get_thread_lid();
+      if ( thread_lid > std::numeric_limits< uint32_t >::max() )
+      {
+        throw KernelException( "Too many nodes per thread for connectivity snapshot." );
+      }
+      const uint32_t target_lid = thread_lid;
+      out.write( reinterpret_cast< const char* >( &target_lid ), sizeof( target_lid ) );
+    }
+    // pad to multiple of eight bytes so that connections are aligned
+    const uint32_t padding = 0;
+    if ( C_.size() % 2 == 1 )
+    {
+      out.write( reinterpret_cast< const char* >( &padding ), sizeof( padding ) );
+    }
+
+    for ( const ConnectionT& conn : C_ )
+    {
+      out.write( reinterpret_cast< const char* >( &conn ), sizeof( ConnectionT ) );
+    }
+  }
+  else
+  {
+    throw NotImplemented( String::compose( "Synapse model %1 does not support connectivity snapshots.",
+      kernel().model_manager.get_connection_model( syn_id_, tid ).get_name() ) );
+  }
+}
+
+template < typename ConnectionT >
+void
+Connector< ConnectionT >::read_connections( std::istream& in, const size_t n, const size_t tid )
+{
+  if constexpr ( std::is_trivially_copyable< ConnectionT >::value )
+  {
+    std::vector< uint32_t > target_lids( n + n % 2 );
+    in.read( reinterpret_cast< char* >( target_lids.data() ), target_lids.size() * sizeof( uint32_t ) );
+
+    const SparseNodeArray& local_nodes = kernel().node_manager.get_local_nodes( tid );
+    C_.reserve( C_.size() + n );
+    ConnectionT conn;
+    for ( size_t i = 0; i < n; ++i )
+    {
+      in.read( reinterpret_cast< char* >( &conn ), sizeof( ConnectionT ) );
+      if ( target_lids[ i ] >= local_nodes.size() )
+      {
+        throw KernelException( "Connectivity snapshot refers to unknown target node." );
+      }
+      conn.set_target( *local_nodes.get_node_by_index( target_lids[ i ] ) );
+      C_.push_back( conn );
+    }
+  }
+  else
+  {
+    throw NotImplemented( String::compose( "Synapse model %1 does not support connectivity snapshots.",
+      kernel().model_manager.get_connection_model( syn_id_, tid ).get_name() ) );
+  }
+}
+
 #if defined( HAVE_SIONLIB ) && defined( HAVE_MPI )
 template < typename ConnectionT >
 void
@@ -123,7 +314,7 @@ Connector< ConnectionT >::dump_connections( std::ostream& connections_out, const
     connections_out.write( reinterpret_cast< const char* >( &thread_lid ), sizeof( thread_lid ) );
 
     double weight = conn.get_weight();
-    double delay = conn.get_delay_ms();
+    double delay = conn.get_delay();
   }
 }
 
@@ -26,6 +26,9 @@
 // C++ includes:
 #include <cmath>
 #include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 // Includes from libnestutil:
 #include "numerics.h"
@@ -58,7 +61,18 @@ enum class ConnectionModelProperties : unsigned
   REQUIRES_SYMMETRIC = 1 << 5,
   REQUIRES_CLOPATH_ARCHIVING = 1 << 6,
   REQUIRES_URBANCZIK_ARCHIVING = 1 << 7,
-  REQUIRES_EPROP_ARCHIVING = 1 << 8
+  REQUIRES_EPROP_ARCHIVING = 1 << 8,
+  /**
+   * send() always transmits the event with the weight returned by
+   * get_transmitted_weight() and does not change the state of the connection
+   */
+  IS_STATIC = 1 << 9,
+  /**
+   * Connection model with reduced memory footprint, registered only with
+   * TargetIdentifierIndex. The model must define size_of_full_synapse, the
+   * size of the connection it replaces.
+   */
+  IS_COMPACT = 1 << 10
 };
 
 template <>
@@ -67,6 +81,71 @@ struct EnableBitMaskOperators< ConnectionModelProperties >
   static const bool enable = true;
 };
 
+/**
+ * Typed setter for a parameter of a connection of type ConnectionT.
+ *
+ * Connection models can provide a table of setters for their parameters
+ * in a static member function
+ *
+ *   static const std::vector< std::pair< Name, ParameterSetter< ConnectionT > > >& get_parameter_setters();
+ *
+ * and a member function check_parameters(), which throws BadProperty if
+ * the parameters of a connection are inconsistent. This allows
+ * connect_arrays() to set the parameters of new connections directly
+ * from columns of values, without passing them through dictionaries.
+ */
+template < typename ConnectionT >
+using ParameterSetter = void ( * )( ConnectionT&, double );
+
+/**
+ * Typed getter for a parameter of a connection of type ConnectionT.
+ *
+ * Connection models can provide a table of getters in a static member
+ * function get_parameter_getters(), analogous to get_parameter_setters().
+ * This allows get_connection_columns() to read parameters directly from
+ * the connections, without building a status dictionary per connection.
+ */
+template < typename ConnectionT >
+using ParameterGetter = double ( * )( const ConnectionT& );
+
+template < typename ConnectionT, typename = void >
+struct has_parameter_setters : std::false_type
+{
+};
+
+template < typename ConnectionT >
+struct has_parameter_setters< ConnectionT, std::void_t< decltype( ConnectionT::get_parameter_setters() ) > >
+  : std::true_type
+{
+};
+
+template < typename ConnectionT, typename = void >
+struct has_parameter_getters : std::false_type
+{
+};
+
+template < typename ConnectionT >
+struct has_parameter_getters< ConnectionT, std::void_t< decltype( ConnectionT::get_parameter_getters() ) > >
+  : std::true_type
+{
+};
+
+/**
+ * Columns of connection parameters bound to typed setters of a connection
+ * model by ConnectorModel::bind_parameter_columns().
+ */
+struct BoundParameterColumns
+{
+  BoundParameterColumns()
+    : receptor_types( nullptr )
+  {
+  }
+
+  std::vector< size_t > setter_ids;     //!< Index of the setter of each column in the table of the model
+  std::vector< const double* > columns; //!< Values of each column, indexed by connection
+  const double* receptor_types;         //!< Receptor types of the connections, nullptr for the default
+};
+
 class ConnectorModel
 {
 
@@ -101,6 +180,45 @@ public:
     const double delay = NAN,
     const double weight = NAN ) = 0;
 
+  /**
+   * Adds a connection with parameters taken from bound columns.
+   *
+   * @param src Source node
+   * @param tgt Target node
+   * @param hetconn Connector vector
+   * @param syn_id Synapse id
+   * @param params Parameter columns bound by bind_parameter_columns()
+   * @param index Index of the connection in the columns
+   * @param delay Delay of the connection, NAN for the default
+   * @param weight Weight of the connection, NAN for the default
+   */
+  virtual void add_connection( Node& src,
+    Node& tgt,
+    std::vector< ConnectorBase* >& hetconn,
+    const synindex syn_id,
+    const BoundParameterColumns& params,
+    const size_t index,
+    const double delay,
+    const double weight ) = 0;
+
+  /**
+   * Bind columns of parameter values to the typed setters of this model.
+   *
+   * Returns false if the model cannot set one of the parameters without
+   * a parameter dictionary. Connections must then be added with the
+   * dictionary version of add_connection().
+   */
+  virtual bool bind_parameter_columns( const std::vector< Name >& names,
+    const std::vector< const double* >& columns,
+    BoundParameterColumns& params ) const = 0;
+
+  /**
+   * Allocate memory for n further connections of this model.
+   *
+   * Creates the Connector for syn_id in hetconn if it does not exist yet.
+   */
+  virtual void reserve_connections( std::vector< ConnectorBase* >& hetconn, const synindex syn_id, const size_t n ) = 0;
+
   virtual ConnectorModel* clone( std::string, synindex syn_id ) const = 0;
 
   virtual void calibrate( const TimeConverter& tc ) = 0;
@@ -124,6 +242,13 @@ public:
   virtual size_t get_syn_id() const = 0;
   virtual void set_syn_id( synindex syn_id ) = 0;
 
+  /**
+   * Return number of bytes saved per connection compared to the full synapse model.
+   *
+   * This is zero except for models with property IS_COMPACT.
+   */
+  virtual size_t get_memory_saved_per_connection() const = 0;
+
   std::string
   get_name() const
   {
@@ -181,6 +306,21 @@ public:
     const double delay,
     const double weight ) override;
 
+  void add_connection( Node& src,
+    Node& tgt,
+    std::vector< ConnectorBase* >& hetconn,
+    const synindex syn_id,
+    const BoundParameterColumns& params,
+    const size_t index,
+    const double delay,
+    const double weight ) override;
+
+  bool bind_parameter_columns( const std::vector< Name >& names,
+    const std::vector< const double* >& columns,
+    BoundParameterColumns& params ) const override;
+
+  void reserve_connections( std::vector< ConnectorBase* >& hetconn, const synindex syn_id, const size_t n ) override;
+
   ConnectorModel* clone( std::string, synindex ) const override;
 
   void calibrate( const TimeConverter& tc ) override;
@@ -197,6 +337,16 @@ public:
   size_t get_syn_id() const override;
   void set_syn_id( synindex syn_id ) override;
 
+  size_t
+  get_memory_saved_per_connection() const override
+  {
+    if constexpr ( flag_is_set( ConnectionT::properties, ConnectionModelProperties::IS_COMPACT ) )
+    {
+      return ConnectionT::size_of_full_synapse - sizeof( ConnectionT );
+    }
+    return 0;
+  }
+
   void check_synapse_params( const DictionaryDatum& syn_spec ) const override;
 
   SecondaryEvent*
@@ -292,6 +292,118 @@ GenericConnectorModel< ConnectionT >::add_connection( Node& src,
   add_connection_( src, tgt, thread_local_connectors, syn_id, connection, actual_receptor_type );
 }
 
+template < typename ConnectionT >
+void
+GenericConnectorModel< ConnectionT >::add_connection( Node& src,
+  Node& tgt,
+  std::vector< ConnectorBase* >& thread_local_connectors,
+  const synindex syn_id,
+  const BoundParameterColumns& params,
+  const size_t index,
+  const double delay,
+  const double weight )
+{
+  if ( not numerics::is_nan( delay ) )
+  {
+    if ( has_property( ConnectionModelProperties::HAS_DELAY ) )
+    {
+      kernel().connection_manager.get_delay_checker().assert_valid_delay_ms( delay );
+    }
+  }
+  else
+  {
+    used_default_delay();
+  }
+
+  // create a new instance of the default connection
+  ConnectionT connection = ConnectionT( default_connection_ );
+
+  if ( not numerics::is_nan( weight ) )
+  {
+    connection.set_weight( weight );
+  }
+
+  if ( not numerics::is_nan( delay ) )
+  {
+    connection.set_delay( delay );
+  }
+
+  if constexpr ( has_parameter_setters< ConnectionT >::value )
+  {
+    if ( not params.setter_ids.empty() )
+    {
+      const auto& setters = ConnectionT::get_parameter_setters();
+      for ( size_t k = 0; k < params.setter_ids.size(); ++k )
+      {
+        setters[ params.setter_ids[ k ] ].second( connection, params.columns[ k ][ index ] );
+      }
+      connection.check_parameters();
+    }
+  }
+
+  const size_t actual_receptor_type =
+    params.receptor_types ? static_cast< size_t >( static_cast< long >( params.receptor_types[ index ] ) ) : receptor_type_;
+
+  add_connection_( src, tgt, thread_local_connectors, syn_id, connection, actual_receptor_type );
+}
+
+template < typename ConnectionT >
+bool
+GenericConnectorModel< ConnectionT >::bind_parameter_columns( const std::vector< Name >& names,
+  const std::vector< const double* >& columns,
+  BoundParameterColumns& params ) const
+{
+  assert( names.size() == columns.size() );
+
+  params = BoundParameterColumns();
+  for ( size_t k = 0; k < names.size(); ++k )
+  {
+    if ( names[ k ] == names::receptor_type )
+    {
+      params.receptor_types = columns[ k ];
+      continue;
+    }
+
+    bool bound = false;
+    if constexpr ( has_parameter_setters< ConnectionT >::value )
+    {
+      const auto& setters = ConnectionT::get_parameter_setters();
+      for ( size_t i = 0; i < setters.size(); ++i )
+      {
+        if ( setters[ i ].first == names[ k ] )
+        {
+          params.setter_ids.push_back( i );
+          params.columns.push_back( columns[ k ] );
+          bound = true;
+          break;
+        }
+      }
+    }
+
+    if ( not bound )
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+template < typename ConnectionT >
+void
+GenericConnectorModel< ConnectionT >::reserve_connections( std::vector< ConnectorBase* >& thread_local_connectors,
+  const synindex syn_id,
+  const size_t n )
+{
+  assert( syn_id != invalid_synindex );
+
+  if ( not thread_local_connectors[ syn_id ] )
+  {
+    thread_local_connectors[ syn_id ] = new Connector< ConnectionT >( syn_id );
+  }
+
+  static_cast< Connector< ConnectionT >* >( thread_local_connectors[ syn_id ] )->reserve( n );
+}
 
 template < typename ConnectionT >
 void
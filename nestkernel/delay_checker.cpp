@@ -48,6 +48,13 @@ nest::DelayChecker::DelayChecker( const DelayChecker& cr )
   max_delay_.calibrate();
 }
 
+long
+nest::DelayChecker::get_min_delay_steps_in_simulation_() const
+{
+  const long min_delay = kernel().connection_manager.get_min_delay();
+  return kernel().event_delivery_manager.use_pipelined_spike_exchange() ? 2 * min_delay : min_delay;
+}
+
 void
 nest::DelayChecker::calibrate( const TimeConverter& tc )
 {
@@ -157,7 +164,7 @@ nest::DelayChecker::assert_valid_delay_ms( double requested_new_delay )
   // min_delay and the max_delay which have been used during simulation
   if ( kernel().simulation_manager.has_been_simulated() )
   {
-    const bool bad_min_delay = new_delay < kernel().connection_manager.get_min_delay();
+    const bool bad_min_delay = new_delay < get_min_delay_steps_in_simulation_();
     const bool bad_max_delay = new_delay > kernel().connection_manager.get_max_delay();
     if ( bad_min_delay or bad_max_delay )
     {
@@ -218,7 +225,7 @@ nest::DelayChecker::assert_two_valid_delays_steps( long new_delay1, long new_del
 
   if ( kernel().simulation_manager.has_been_simulated() )
   {
-    const bool bad_min_delay = ldelay < kernel().connection_manager.get_min_delay();
+    const bool bad_min_delay = ldelay < get_min_delay_steps_in_simulation_();
     const bool bad_max_delay = hdelay > kernel().connection_manager.get_max_delay();
     if ( bad_min_delay )
     {
@@ -97,6 +97,13 @@ private:
   bool freeze_delay_update_;
 
   void set_min_max_delay_( const double, const double );
+
+  /**
+   * Smallest delay in steps that new synapses may have once Simulate has been called.
+   *
+   * With pipelined spike exchange, this is twice the min_delay used in simulation.
+   */
+  long get_min_delay_steps_in_simulation_() const;
 };
 
 inline const Time&
@@ -47,6 +47,10 @@ namespace nest
 
 EventDeliveryManager::EventDeliveryManager()
   : off_grid_spiking_( false )
+  , use_sorted_spike_delivery_( false )
+  , use_pipelined_spike_exchange_( false )
+  , use_sparse_spike_exchange_( false )
+  , use_pipelined_target_data_exchange_( false )
   , moduli_()
   , slice_moduli_()
   , emitted_spikes_register_()
@@ -56,17 +60,47 @@ EventDeliveryManager::EventDeliveryManager()
   , local_spike_counter_()
   , send_buffer_spike_data_()
   , recv_buffer_spike_data_()
+  , spike_exchange_pending_( false )
+  , spike_exchange_completed_( false )
+  , spike_data_ready_( false )
+  , ready_send_buffer_spike_data_()
+  , ready_recv_buffer_spike_data_()
+  , pending_send_recv_count_spike_data_per_rank_( 0 )
+  , ready_send_recv_count_spike_data_per_rank_( 0 )
+  , pending_emitted_spikes_register_()
   , send_buffer_off_grid_spike_data_()
   , recv_buffer_off_grid_spike_data_()
+  , send_count_info_spike_data_()
+  , recv_count_info_spike_data_()
+  , send_counts_spike_data_in_int_()
+  , send_displacements_spike_data_in_int_()
+  , recv_counts_spike_data_in_int_()
+  , recv_displacements_spike_data_in_int_()
+  , recv_counts_spike_data_()
+  , recv_displacements_spike_data_()
+  , spike_exchange_bytes_sent_( 0 )
+  , spike_exchange_bytes_saved_( 0 )
+  , spike_data_write_positions_()
+  , spike_data_write_end_()
+  , num_spikes_per_rank_()
+  , spike_data_collocated_( false )
+  , spikes_sent_per_slice_histogram_()
   , send_buffer_target_data_()
   , recv_buffer_target_data_()
+  , pending_send_buffer_target_data_()
   , buffer_size_target_data_has_changed_( false )
+  , target_data_exchange_log_()
+  , sw_target_data_exchange_round_()
   , global_max_spikes_per_rank_( 0 )
   , send_recv_buffer_shrink_limit_( 0.2 )
   , send_recv_buffer_shrink_spare_( 0.1 )
   , send_recv_buffer_grow_extra_( 0.5 )
   , send_recv_buffer_resize_log_()
   , gather_completed_checker_()
+  , spikes_for_delivery_()
+  , spikes_for_delivery_scratch_()
+  , spike_batch_for_delivery_()
+  , spike_input_buffers_()
 {
 }
 
@@ -85,11 +119,16 @@ EventDeliveryManager::initialize( const bool adjust_number_of_threads_or_rng_onl
 
     // Ensures that ResetKernel resets off_grid_spiking_
     off_grid_spiking_ = false;
+    use_sorted_spike_delivery_ = false;
+    use_pipelined_spike_exchange_ = false;
+    use_sparse_spike_exchange_ = false;
+    use_pipelined_target_data_exchange_ = false;
     buffer_size_target_data_has_changed_ = false;
     send_recv_buffer_shrink_limit_ = 0.2;
     send_recv_buffer_shrink_spare_ = 0.1;
     send_recv_buffer_grow_extra_ = 0.5;
     send_recv_buffer_resize_log_.clear();
+    target_data_exchange_log_.clear();
   }
 
   const size_t num_threads = kernel().vp_manager.get_num_threads();
@@ -97,7 +136,12 @@ EventDeliveryManager::initialize( const bool adjust_number_of_threads_or_rng_onl
   local_spike_counter_.resize( num_threads, 0 );
   reset_counters();
   emitted_spikes_register_.resize( num_threads );
+  pending_emitted_spikes_register_.resize( num_threads );
   off_grid_emitted_spikes_register_.resize( num_threads );
+  spikes_for_delivery_.resize( num_threads );
+  spikes_for_delivery_scratch_.resize( num_threads );
+  spike_batch_for_delivery_.resize( num_threads );
+  spike_input_buffers_.resize( num_threads );
   gather_completed_checker_.initialize( num_threads, false );
 
 #pragma omp parallel
@@ -109,10 +153,23 @@ EventDeliveryManager::initialize( const bool adjust_number_of_threads_or_rng_onl
       emitted_spikes_register_[ tid ] = new std::vector< SpikeDataWithRank >();
     }
 
+    if ( not pending_emitted_spikes_register_[ tid ] )
+    {
+      pending_emitted_spikes_register_[ tid ] = new std::vector< SpikeDataWithRank >();
+    }
+
     if ( not off_grid_emitted_spikes_register_[ tid ] )
     {
       off_grid_emitted_spikes_register_[ tid ] = new std::vector< OffGridSpikeDataWithRank >();
     }
+
+    if ( not spikes_for_delivery_[ tid ] )
+    {
+      spikes_for_delivery_[ tid ] = new std::vector< SpikeDeliveryEntry >();
+      spikes_for_delivery_scratch_[ tid ] = new std::vector< SpikeDeliveryEntry >();
+      spike_batch_for_delivery_[ tid ] = new std::vector< BatchedSpike >();
+      spike_input_buffers_[ tid ] = new std::vector< SpikeInputBuffer >();
+    }
   } // of omp parallel
 }
 
@@ -126,24 +183,71 @@ EventDeliveryManager::finalize( const bool )
   }
   emitted_spikes_register_.clear(); // remove stale pointers
 
+  for ( auto& vec_spikedata_ptr : pending_emitted_spikes_register_ )
+  {
+    delete vec_spikedata_ptr;
+  }
+  pending_emitted_spikes_register_.clear();
+
   for ( auto& vec_spikedata_ptr : off_grid_emitted_spikes_register_ )
   {
     delete vec_spikedata_ptr;
   }
   off_grid_emitted_spikes_register_.clear();
 
+  for ( size_t tid = 0; tid < spikes_for_delivery_.size(); ++tid )
+  {
+    delete spikes_for_delivery_[ tid ];
+    delete spikes_for_delivery_scratch_[ tid ];
+    delete spike_batch_for_delivery_[ tid ];
+    delete spike_input_buffers_[ tid ];
+  }
+  spikes_for_delivery_.clear();
+  spikes_for_delivery_scratch_.clear();
+  spike_batch_for_delivery_.clear();
+  spike_input_buffers_.clear();
+
   send_buffer_secondary_events_.clear();
   recv_buffer_secondary_events_.clear();
   send_buffer_spike_data_.clear();
   recv_buffer_spike_data_.clear();
+  ready_send_buffer_spike_data_.clear();
+  ready_recv_buffer_spike_data_.clear();
   send_buffer_off_grid_spike_data_.clear();
   recv_buffer_off_grid_spike_data_.clear();
+  recv_counts_spike_data_.clear();
+  recv_displacements_spike_data_.clear();
 }
 
 void
 EventDeliveryManager::set_status( const DictionaryDatum& dict )
 {
   updateValue< bool >( dict, names::off_grid_spiking, off_grid_spiking_ );
+  updateValue< bool >( dict, names::use_sorted_spike_delivery, use_sorted_spike_delivery_ );
+
+  bool use_pipelined_spike_exchange = use_pipelined_spike_exchange_;
+  if ( updateValue< bool >( dict, names::use_pipelined_spike_exchange, use_pipelined_spike_exchange )
+    and use_pipelined_spike_exchange != use_pipelined_spike_exchange_ )
+  {
+    if ( kernel().simulation_manager.has_been_simulated() )
+    {
+      throw KernelException( "Pipelined spike exchange cannot be switched after Simulate has been called." );
+    }
+    use_pipelined_spike_exchange_ = use_pipelined_spike_exchange;
+  }
+
+  bool use_sparse_spike_exchange = use_sparse_spike_exchange_;
+  if ( updateValue< bool >( dict, names::use_sparse_spike_exchange, use_sparse_spike_exchange )
+    and use_sparse_spike_exchange != use_sparse_spike_exchange_ )
+  {
+    if ( kernel().simulation_manager.has_been_simulated() )
+    {
+      throw KernelException( "Sparse spike exchange cannot be switched after Simulate has been called." );
+    }
+    use_sparse_spike_exchange_ = use_sparse_spike_exchange;
+  }
+
+  updateValue< bool >( dict, names::use_pipelined_target_data_exchange, use_pipelined_target_data_exchange_ );
 
   double bsl = send_recv_buffer_shrink_limit_;
   if ( updateValue< double >( dict, names::spike_buffer_shrink_limit, bsl ) )
@@ -180,16 +284,27 @@ void
 EventDeliveryManager::get_status( DictionaryDatum& dict )
 {
   def< bool >( dict, names::off_grid_spiking, off_grid_spiking_ );
+  def< bool >( dict, names::use_sorted_spike_delivery, use_sorted_spike_delivery_ );
+  def< bool >( dict, names::use_pipelined_spike_exchange, use_pipelined_spike_exchange_ );
+  def< bool >( dict, names::use_sparse_spike_exchange, use_sparse_spike_exchange_ );
+  def< bool >( dict, names::use_pipelined_target_data_exchange, use_pipelined_target_data_exchange_ );
   def< unsigned long >(
     dict, names::local_spike_counter, std::accumulate( local_spike_counter_.begin(), local_spike_counter_.end(), 0 ) );
   def< double >( dict, names::spike_buffer_shrink_limit, send_recv_buffer_shrink_limit_ );
   def< double >( dict, names::spike_buffer_shrink_spare, send_recv_buffer_shrink_spare_ );
   def< double >( dict, names::spike_buffer_grow_extra, send_recv_buffer_grow_extra_ );
+  def< long >( dict, names::spike_exchange_bytes_sent, spike_exchange_bytes_sent_ );
+  def< long >( dict, names::spike_exchange_bytes_saved, spike_exchange_bytes_saved_ );
+  def< std::vector< long > >( dict, names::spikes_sent_per_slice_histogram, spikes_sent_per_slice_histogram_ );
 
   DictionaryDatum log_events = DictionaryDatum( new Dictionary );
   ( *dict )[ names::spike_buffer_resize_log ] = log_events;
   send_recv_buffer_resize_log_.to_dict( log_events );
 
+  DictionaryDatum log_rounds = DictionaryDatum( new Dictionary );
+  ( *dict )[ names::target_data_exchange_log ] = log_rounds;
+  target_data_exchange_log_.to_dict( log_rounds );
+
   sw_collocate_spike_data_.get_status( dict, names::time_collocate_spike_data, names::time_collocate_spike_data_cpu );
   sw_communicate_spike_data_.get_status(
     dict, names::time_communicate_spike_data, names::time_communicate_spike_data_cpu );
@@ -217,6 +332,46 @@ EventDeliveryManager::resize_send_recv_buffers_spike_data_()
   }
 }
 
+void
+EventDeliveryManager::shrink_send_recv_buffers_spike_data_()
+{
+  const size_t old_buff_size_per_rank = kernel().mpi_manager.get_send_recv_count_spike_data_per_rank();
+
+  if ( global_max_spikes_per_rank_ < send_recv_buffer_shrink_limit_ * old_buff_size_per_rank )
+  {
+    const size_t new_buff_size_per_rank =
+      std::max( 2UL, static_cast< size_t >( ( 1 + send_recv_buffer_shrink_spare_ ) * global_max_spikes_per_rank_ ) );
+    kernel().mpi_manager.set_buffer_size_spike_data(
+      kernel().mpi_manager.get_num_processes() * new_buff_size_per_rank );
+    resize_send_recv_buffers_spike_data_();
+    send_recv_buffer_resize_log_.add_entry( global_max_spikes_per_rank_, new_buff_size_per_rank );
+  }
+}
+
+void
+EventDeliveryManager::register_spike_input_buffers()
+{
+#pragma omp parallel
+  {
+    const size_t tid = kernel().vp_manager.get_thread_id();
+    const SparseNodeArray& local_nodes = kernel().node_manager.get_local_nodes( tid );
+
+    std::vector< SpikeInputBuffer >& input_buffers = *spike_input_buffers_[ tid ];
+    input_buffers.assign( local_nodes.size(), { nullptr, 0, 0, 0 } );
+
+    for ( auto node : local_nodes )
+    {
+      Node* n = node.get_node();
+      SpikeInputBuffer input_buffer;
+      if ( n->get_spike_input_buffer( input_buffer ) )
+      {
+        assert( n->get_thread_lid() < input_buffers.size() );
+        input_buffers[ n->get_thread_lid() ] = input_buffer;
+      }
+    }
+  } // of omp parallel
+}
+
 void
 EventDeliveryManager::configure_spike_data_buffers()
 {
@@ -227,6 +382,23 @@ EventDeliveryManager::configure_spike_data_buffers()
   send_buffer_spike_data_.clear();
   send_buffer_off_grid_spike_data_.clear();
 
+  // no exchange is pending between runs, see complete_pending_spike_exchange()
+  spike_exchange_pending_ = false;
+  spike_exchange_completed_ = false;
+  spike_data_ready_ = false;
+  ready_send_buffer_spike_data_.clear();
+  ready_recv_buffer_spike_data_.clear();
+
+  // nothing has been received by a sparse exchange yet
+  const size_t num_ranks = kernel().mpi_manager.get_num_processes();
+  recv_counts_spike_data_.assign( num_ranks, 0 );
+  recv_displacements_spike_data_.assign( num_ranks, 0 );
+
+  spike_data_write_positions_.assign( 2 * kernel().vp_manager.get_num_threads() * num_ranks, 0 );
+  spike_data_write_end_.assign( num_ranks, 0 );
+  num_spikes_per_rank_.assign( num_ranks, 0 );
+  spike_data_collocated_ = false;
+
   resize_send_recv_buffers_spike_data_();
 }
 
@@ -237,6 +409,7 @@ EventDeliveryManager::configure_spike_register()
   {
     const size_t tid = kernel().vp_manager.get_thread_id();
     reset_spike_register_( tid );
+    pending_emitted_spikes_register_[ tid ]->clear();
   }
 }
 
@@ -311,6 +484,9 @@ EventDeliveryManager::reset_counters()
   {
     spike_counter = 0;
   }
+  spike_exchange_bytes_sent_ = 0;
+  spike_exchange_bytes_saved_ = 0;
+  spikes_sent_per_slice_histogram_.clear();
 }
 
 void
@@ -355,7 +531,22 @@ EventDeliveryManager::deliver_secondary_events( const size_t tid, const bool cal
 void
 EventDeliveryManager::gather_spike_data()
 {
-  if ( off_grid_spiking_ )
+  if ( use_pipelined_spike_exchange_ )
+  {
+    gather_spike_data_pipelined_();
+  }
+  else if ( use_sparse_spike_exchange_ )
+  {
+    if ( off_grid_spiking_ )
+    {
+      gather_spike_data_sparse_( send_buffer_off_grid_spike_data_, recv_buffer_off_grid_spike_data_ );
+    }
+    else
+    {
+      gather_spike_data_sparse_( send_buffer_spike_data_, recv_buffer_spike_data_ );
+    }
+  }
+  else if ( off_grid_spiking_ )
   {
     gather_spike_data_( send_buffer_off_grid_spike_data_, recv_buffer_off_grid_spike_data_ );
   }
@@ -373,16 +564,10 @@ EventDeliveryManager::gather_spike_data_( std::vector< SpikeDataT >& send_buffer
   // NOTE: For meaning and logic of SpikeData flags for detecting complete transmission
   //       and information for shrink/grow, see comment in spike_data.h.
 
-  const size_t old_buff_size_per_rank = kernel().mpi_manager.get_send_recv_count_spike_data_per_rank();
-
-  if ( global_max_spikes_per_rank_ < send_recv_buffer_shrink_limit_ * old_buff_size_per_rank )
+  // Buffers have already been shrunk before spikes were collocated in parallel
+  if ( not spike_data_collocated_ )
   {
-    const size_t new_buff_size_per_rank =
-      std::max( 2UL, static_cast< size_t >( ( 1 + send_recv_buffer_shrink_spare_ ) * global_max_spikes_per_rank_ ) );
-    kernel().mpi_manager.set_buffer_size_spike_data(
-      kernel().mpi_manager.get_num_processes() * new_buff_size_per_rank );
-    resize_send_recv_buffers_spike_data_();
-    send_recv_buffer_resize_log_.add_entry( global_max_spikes_per_rank_, new_buff_size_per_rank );
+    shrink_send_recv_buffers_spike_data_();
   }
 
   /* The following do-while loop is executed
@@ -392,32 +577,16 @@ EventDeliveryManager::gather_spike_data_( std::vector< SpikeDataT >& send_buffer
   bool all_spikes_transmitted = false;
   do
   {
-    // Need to get new positions in case buffer size has changed
-    SendBufferPosition send_buffer_position;
-
-    sw_collocate_spike_data_.start();
-
-    // Set marker at end of each chunk to DEFAULT
-    reset_complete_marker_spike_data_( send_buffer_position, send_buffer );
-    std::vector< size_t > num_spikes_per_rank( kernel().mpi_manager.get_num_processes(), 0 );
-
-    // Collocate spikes to send buffer
-    collocate_spike_data_buffers_( send_buffer_position, emitted_spikes_register_, send_buffer, num_spikes_per_rank );
-
-    if ( off_grid_spiking_ )
+    if ( spike_data_collocated_ )
     {
-      collocate_spike_data_buffers_(
-        send_buffer_position, off_grid_emitted_spikes_register_, send_buffer, num_spikes_per_rank );
+      set_end_marker_collocated_( send_buffer );
+      spike_data_collocated_ = false;
+    }
+    else
+    {
+      collocate_spike_data_( emitted_spikes_register_, off_grid_emitted_spikes_register_, send_buffer );
     }
 
-    // Largest number of spikes sent from this rank to any other rank.
-    const auto local_max_spikes_per_rank = *std::max_element( num_spikes_per_rank.begin(), num_spikes_per_rank.end() );
-
-    // At this point, all send_buffer entries with spikes to be transmitted, as well
-    // as all chunk-end entries, have marker DEFAULT.
-    set_end_marker_( send_buffer_position, send_buffer, local_max_spikes_per_rank );
-
-    sw_collocate_spike_data_.stop();
     sw_communicate_spike_data_.start();
 #ifdef MPI_SYNC_TIMER
     // We introduce an explicit barrier at this point to measure how long each process idles until all other processes
@@ -428,43 +597,469 @@ EventDeliveryManager::gather_spike_data_( std::vector< SpikeDataT >& send_buffer
     kernel().get_mpi_synchronization_stopwatch().stop();
 #endif
 
-    // Given that we templatize by plain vs offgrid, this if should not be necessary, but ...
-    if ( off_grid_spiking_ )
-    {
-      kernel().mpi_manager.communicate_off_grid_spike_data_Alltoall( send_buffer, recv_buffer );
-    }
-    else
-    {
-      kernel().mpi_manager.communicate_spike_data_Alltoall( send_buffer, recv_buffer );
-    }
+    // Given that we templatize by plain vs offgrid, this if should not be necessary, but ...
+    if ( off_grid_spiking_ )
+    {
+      kernel().mpi_manager.communicate_off_grid_spike_data_Alltoall( send_buffer, recv_buffer );
+    }
+    else
+    {
+      kernel().mpi_manager.communicate_spike_data_Alltoall( send_buffer, recv_buffer );
+    }
+
+    sw_communicate_spike_data_.stop();
+
+    all_spikes_transmitted = check_spike_data_transmitted_( recv_buffer );
+
+  } while ( not all_spikes_transmitted );
+
+  // We cannot shrink buffers here, because they first need to be read out by
+  // deliver events. Shrinking will happen at beginning of next gather.
+
+  /* emitted_spike_register is cleared by deliver_events in a thread-parallel context.
+     We could in principle clear it here, but since it can conveniently be done thread-parallel,
+     it is best to postpone.
+   */
+}
+
+template < typename SpikeDataT >
+void
+EventDeliveryManager::gather_spike_data_sparse_( std::vector< SpikeDataT >& send_buffer,
+  std::vector< SpikeDataT >& recv_buffer )
+{
+  const size_t num_ranks = kernel().mpi_manager.get_num_processes();
+  constexpr size_t num_int_per_spike = sizeof( SpikeDataT ) / sizeof( unsigned int );
+
+  sw_collocate_spike_data_.start();
+
+  if ( not spike_data_collocated_ )
+  {
+    num_spikes_per_rank_.assign( num_ranks, 0 );
+    count_spikes_per_rank_( emitted_spikes_register_, num_spikes_per_rank_ );
+    if ( off_grid_spiking_ )
+    {
+      count_spikes_per_rank_( off_grid_emitted_spikes_register_, num_spikes_per_rank_ );
+    }
+  }
+  const std::vector< size_t >& num_spikes_per_rank = num_spikes_per_rank_;
+
+  // Spikes for each rank are stored contiguously in the send buffer
+  std::vector< size_t > send_buffer_idx( num_ranks, 0 );
+  std::partial_sum( num_spikes_per_rank.begin(), num_spikes_per_rank.end() - 1, send_buffer_idx.begin() + 1 );
+  const size_t num_spikes_to_send = send_buffer_idx.back() + num_spikes_per_rank.back();
+  if ( send_buffer.size() < num_spikes_to_send )
+  {
+    assert( not spike_data_collocated_ );
+    send_buffer.resize( num_spikes_to_send );
+  }
+
+  send_counts_spike_data_in_int_.resize( num_ranks );
+  send_displacements_spike_data_in_int_.resize( num_ranks );
+  for ( size_t rank = 0; rank < num_ranks; ++rank )
+  {
+    send_counts_spike_data_in_int_[ rank ] = num_spikes_per_rank[ rank ] * num_int_per_spike;
+    send_displacements_spike_data_in_int_[ rank ] = send_buffer_idx[ rank ] * num_int_per_spike;
+  }
+
+  if ( not spike_data_collocated_ )
+  {
+    collocate_spike_data_buffers_sparse_( emitted_spikes_register_, send_buffer, send_buffer_idx );
+    if ( off_grid_spiking_ )
+    {
+      collocate_spike_data_buffers_sparse_( off_grid_emitted_spikes_register_, send_buffer, send_buffer_idx );
+    }
+  }
+  spike_data_collocated_ = false;
+
+  const size_t local_max_spikes_per_rank = *std::max_element( num_spikes_per_rank.begin(), num_spikes_per_rank.end() );
+  send_count_info_spike_data_.resize( 2 * num_ranks );
+  recv_count_info_spike_data_.resize( 2 * num_ranks );
+  for ( size_t rank = 0; rank < num_ranks; ++rank )
+  {
+    send_count_info_spike_data_[ 2 * rank ] = num_spikes_per_rank[ rank ];
+    send_count_info_spike_data_[ 2 * rank + 1 ] = local_max_spikes_per_rank;
+  }
+
+  sw_collocate_spike_data_.stop();
+
+  sw_communicate_spike_data_.start();
+#ifdef MPI_SYNC_TIMER
+  kernel().get_mpi_synchronization_stopwatch().start();
+  kernel().mpi_manager.synchronize();
+  kernel().get_mpi_synchronization_stopwatch().stop();
+#endif
+
+  kernel().mpi_manager.communicate_Alltoall( send_count_info_spike_data_, recv_count_info_spike_data_, 2 );
+
+  recv_counts_spike_data_.resize( num_ranks );
+  recv_displacements_spike_data_.resize( num_ranks );
+  recv_counts_spike_data_in_int_.resize( num_ranks );
+  recv_displacements_spike_data_in_int_.resize( num_ranks );
+  size_t num_spikes_to_receive = 0;
+  global_max_spikes_per_rank_ = 0;
+  for ( size_t rank = 0; rank < num_ranks; ++rank )
+  {
+    recv_counts_spike_data_[ rank ] = recv_count_info_spike_data_[ 2 * rank ];
+    recv_displacements_spike_data_[ rank ] = num_spikes_to_receive;
+    recv_counts_spike_data_in_int_[ rank ] = recv_counts_spike_data_[ rank ] * num_int_per_spike;
+    recv_displacements_spike_data_in_int_[ rank ] = num_spikes_to_receive * num_int_per_spike;
+    num_spikes_to_receive += recv_counts_spike_data_[ rank ];
+    global_max_spikes_per_rank_ =
+      std::max( global_max_spikes_per_rank_, static_cast< size_t >( recv_count_info_spike_data_[ 2 * rank + 1 ] ) );
+  }
+  if ( recv_buffer.size() < num_spikes_to_receive )
+  {
+    recv_buffer.resize( num_spikes_to_receive );
+  }
+
+  kernel().mpi_manager.communicate_Alltoallv( send_buffer,
+    send_counts_spike_data_in_int_,
+    send_displacements_spike_data_in_int_,
+    recv_buffer,
+    recv_counts_spike_data_in_int_,
+    recv_displacements_spike_data_in_int_ );
+
+  sw_communicate_spike_data_.stop();
+
+  // A fixed-size exchange needs at least one entry per rank to transmit markers
+  const long bytes_sent =
+    num_spikes_to_send * sizeof( SpikeDataT ) + send_count_info_spike_data_.size() * sizeof( unsigned int );
+  const long bytes_fixed_size = num_ranks * std::max( global_max_spikes_per_rank_, size_t( 1 ) ) * sizeof( SpikeDataT );
+  spike_exchange_bytes_sent_ += bytes_sent;
+  spike_exchange_bytes_saved_ += bytes_fixed_size - bytes_sent;
+}
+
+template < typename SpikeDataWithRankT >
+void
+EventDeliveryManager::count_spikes_per_rank_(
+  const std::vector< std::vector< SpikeDataWithRankT >* >& spike_register,
+  std::vector< size_t >& num_spikes_per_rank ) const
+{
+  for ( const auto& emitted_spikes_per_thread : spike_register )
+  {
+    for ( const auto& emitted_spike : *emitted_spikes_per_thread )
+    {
+      ++num_spikes_per_rank[ emitted_spike.rank ];
+    }
+  }
+}
+
+template < typename SpikeDataWithRankT, typename SpikeDataT >
+void
+EventDeliveryManager::collocate_spike_data_buffers_sparse_(
+  const std::vector< std::vector< SpikeDataWithRankT >* >& spike_register,
+  std::vector< SpikeDataT >& send_buffer,
+  std::vector< size_t >& send_buffer_idx ) const
+{
+  for ( const auto& emitted_spikes_per_thread : spike_register )
+  {
+    for ( const auto& emitted_spike : *emitted_spikes_per_thread )
+    {
+      send_buffer[ send_buffer_idx[ emitted_spike.rank ]++ ] = emitted_spike.spike_data;
+    }
+  }
+}
+
+void
+EventDeliveryManager::collocate_spike_data( const size_t tid )
+{
+  if ( off_grid_spiking_ )
+  {
+    collocate_spike_data_parallel_( tid, send_buffer_off_grid_spike_data_ );
+  }
+  else
+  {
+    collocate_spike_data_parallel_( tid, send_buffer_spike_data_ );
+  }
+}
+
+template < typename SpikeDataT >
+void
+EventDeliveryManager::collocate_spike_data_parallel_( const size_t tid, std::vector< SpikeDataT >& send_buffer )
+{
+  const size_t num_threads = kernel().vp_manager.get_num_threads();
+  const size_t num_ranks = kernel().mpi_manager.get_num_processes();
+  assert( spike_data_write_positions_.size() == 2 * num_threads * num_ranks );
+
+  size_t* const on_grid_positions = &spike_data_write_positions_[ tid * num_ranks ];
+  size_t* const off_grid_positions = &spike_data_write_positions_[ ( num_threads + tid ) * num_ranks ];
+
+  std::fill( on_grid_positions, on_grid_positions + num_ranks, 0 );
+  std::fill( off_grid_positions, off_grid_positions + num_ranks, 0 );
+  count_thread_spikes_per_rank_( *emitted_spikes_register_[ tid ], on_grid_positions );
+  if ( off_grid_spiking_ )
+  {
+    count_thread_spikes_per_rank_( *off_grid_emitted_spikes_register_[ tid ], off_grid_positions );
+  }
+
+#pragma omp barrier
+#pragma omp master
+  {
+    sw_collocate_spike_data_.start();
+    compute_spike_data_write_positions_( send_buffer );
+  } // of omp master
+#pragma omp barrier
+
+  if ( not use_pipelined_spike_exchange_ )
+  {
+    collocate_thread_spike_data_( *emitted_spikes_register_[ tid ], on_grid_positions, send_buffer );
+    if ( off_grid_spiking_ )
+    {
+      collocate_thread_spike_data_( *off_grid_emitted_spikes_register_[ tid ], off_grid_positions, send_buffer );
+    }
+  }
+
+#pragma omp barrier
+#pragma omp master
+  {
+    spike_data_collocated_ = not use_pipelined_spike_exchange_;
+    sw_collocate_spike_data_.stop();
+  } // of omp master (no barrier)
+}
+
+template < typename SpikeDataWithRankT >
+void
+EventDeliveryManager::count_thread_spikes_per_rank_( const std::vector< SpikeDataWithRankT >& emitted_spikes,
+  size_t* num_spikes_per_rank ) const
+{
+  for ( const auto& emitted_spike : emitted_spikes )
+  {
+    ++num_spikes_per_rank[ emitted_spike.rank ];
+  }
+}
+
+template < typename SpikeDataT >
+void
+EventDeliveryManager::compute_spike_data_write_positions_( std::vector< SpikeDataT >& send_buffer )
+{
+  const size_t num_threads = kernel().vp_manager.get_num_threads();
+  const size_t num_ranks = kernel().mpi_manager.get_num_processes();
+
+  size_t num_spikes_to_send = 0;
+  for ( const auto num_spikes : spike_data_write_positions_ )
+  {
+    num_spikes_to_send += num_spikes;
+  }
+
+  size_t bin = 0;
+  while ( ( num_spikes_to_send >> bin ) > 0 )
+  {
+    ++bin;
+  }
+  if ( spikes_sent_per_slice_histogram_.size() <= bin )
+  {
+    spikes_sent_per_slice_histogram_.resize( bin + 1, 0 );
+  }
+  ++spikes_sent_per_slice_histogram_[ bin ];
+
+  if ( use_pipelined_spike_exchange_ )
+  {
+    return;
+  }
+
+  // Sections for ranks begin at fixed positions for fixed-size exchanges and
+  // are contiguous for sparse exchanges.
+  std::vector< size_t > rank_begin( num_ranks, 0 );
+  if ( use_sparse_spike_exchange_ )
+  {
+    std::vector< size_t > num_spikes_per_rank( num_ranks, 0 );
+    for ( size_t i = 0; i < spike_data_write_positions_.size(); ++i )
+    {
+      num_spikes_per_rank[ i % num_ranks ] += spike_data_write_positions_[ i ];
+    }
+    std::partial_sum( num_spikes_per_rank.begin(), num_spikes_per_rank.end() - 1, rank_begin.begin() + 1 );
+    std::fill( spike_data_write_end_.begin(), spike_data_write_end_.end(), std::numeric_limits< size_t >::max() );
+
+    if ( send_buffer.size() < num_spikes_to_send )
+    {
+      send_buffer.resize( num_spikes_to_send );
+    }
+  }
+  else
+  {
+    shrink_send_recv_buffers_spike_data_();
+
+    SendBufferPosition send_buffer_position;
+    reset_complete_marker_spike_data_( send_buffer_position, send_buffer );
+    for ( size_t rank = 0; rank < num_ranks; ++rank )
+    {
+      rank_begin[ rank ] = send_buffer_position.begin( rank );
+      spike_data_write_end_[ rank ] = send_buffer_position.end( rank );
+    }
+  }
+
+  // Within the section of each rank, on-grid spikes of all threads precede
+  // off-grid spikes, and spikes of lower threads precede those of higher threads.
+  for ( size_t rank = 0; rank < num_ranks; ++rank )
+  {
+    size_t write_position = rank_begin[ rank ];
+    for ( size_t i = 0; i < 2 * num_threads; ++i )
+    {
+      size_t& entry = spike_data_write_positions_[ i * num_ranks + rank ];
+      const size_t num_spikes = entry;
+      entry = write_position;
+      write_position += num_spikes;
+    }
+    num_spikes_per_rank_[ rank ] = write_position - rank_begin[ rank ];
+  }
+}
+
+template < typename SpikeDataWithRankT, typename SpikeDataT >
+void
+EventDeliveryManager::collocate_thread_spike_data_( const std::vector< SpikeDataWithRankT >& emitted_spikes,
+  size_t* write_position,
+  std::vector< SpikeDataT >& send_buffer ) const
+{
+  for ( const auto& emitted_spike : emitted_spikes )
+  {
+    const size_t idx = write_position[ emitted_spike.rank ]++;
+    if ( idx < spike_data_write_end_[ emitted_spike.rank ] )
+    {
+      send_buffer[ idx ] = emitted_spike.spike_data;
+    }
+  }
+}
+
+template < typename SpikeDataT >
+void
+EventDeliveryManager::set_end_marker_collocated_( std::vector< SpikeDataT >& send_buffer )
+{
+  sw_collocate_spike_data_.start();
+
+  SendBufferPosition send_buffer_position;
+  for ( size_t rank = 0; rank < kernel().mpi_manager.get_num_processes(); ++rank )
+  {
+    send_buffer_position.increase( rank, num_spikes_per_rank_[ rank ] );
+  }
+
+  const size_t local_max_spikes_per_rank = *std::max_element( num_spikes_per_rank_.begin(), num_spikes_per_rank_.end() );
+  set_end_marker_( send_buffer_position, send_buffer, local_max_spikes_per_rank );
+
+  sw_collocate_spike_data_.stop();
+}
+
+void
+EventDeliveryManager::gather_spike_data_pipelined_()
+{
+  complete_pending_spike_exchange();
+
+  // Spikes received in the pending exchange are delivered at the beginning of
+  // the next slice. The ready buffers have been delivered at the beginning of
+  // the current slice and are reused for the new exchange.
+  spike_data_ready_ = spike_exchange_pending_;
+  if ( spike_exchange_pending_ )
+  {
+    send_buffer_spike_data_.swap( ready_send_buffer_spike_data_ );
+    recv_buffer_spike_data_.swap( ready_recv_buffer_spike_data_ );
+    ready_send_recv_count_spike_data_per_rank_ = pending_send_recv_count_spike_data_per_rank_;
+    spike_exchange_pending_ = false;
+  }
+
+  // Keep spikes of the current slice until the exchange is completed. The
+  // spikes of the previous exchange are no longer needed and the register is
+  // cleared by deliver_events() before it is written to again.
+  std::swap( emitted_spikes_register_, pending_emitted_spikes_register_ );
+
+  // No exchange is pending now, so buffers can be resized safely; the ready
+  // buffers keep their size.
+  shrink_send_recv_buffers_spike_data_();
+  resize_send_recv_buffers_spike_data_();
+
+  collocate_spike_data_( pending_emitted_spikes_register_, off_grid_emitted_spikes_register_, send_buffer_spike_data_ );
+
+  sw_communicate_spike_data_.start();
+  kernel().mpi_manager.communicate_spike_data_Ialltoall( send_buffer_spike_data_, recv_buffer_spike_data_ );
+  sw_communicate_spike_data_.stop();
+
+  pending_send_recv_count_spike_data_per_rank_ = kernel().mpi_manager.get_send_recv_count_spike_data_per_rank();
+  spike_exchange_pending_ = true;
+  spike_exchange_completed_ = false;
+}
+
+void
+EventDeliveryManager::complete_pending_spike_exchange()
+{
+  if ( not spike_exchange_pending_ or spike_exchange_completed_ )
+  {
+    return;
+  }
+
+  sw_communicate_spike_data_.start();
+  kernel().mpi_manager.wait_spike_data_Ialltoall();
+  sw_communicate_spike_data_.stop();
+
+  // If any rank could not send all spikes, send all spikes of the slice again
+  // with blocking communication.
+  while ( not check_spike_data_transmitted_( recv_buffer_spike_data_ ) )
+  {
+    collocate_spike_data_(
+      pending_emitted_spikes_register_, off_grid_emitted_spikes_register_, send_buffer_spike_data_ );
+
+    sw_communicate_spike_data_.start();
+    kernel().mpi_manager.communicate_spike_data_Alltoall( send_buffer_spike_data_, recv_buffer_spike_data_ );
+    sw_communicate_spike_data_.stop();
+
+    pending_send_recv_count_spike_data_per_rank_ = kernel().mpi_manager.get_send_recv_count_spike_data_per_rank();
+  }
+
+  spike_exchange_completed_ = true;
+}
+
+template < typename SpikeDataT >
+void
+EventDeliveryManager::collocate_spike_data_( std::vector< std::vector< SpikeDataWithRank >* >& spike_register,
+  std::vector< std::vector< OffGridSpikeDataWithRank >* >& off_grid_spike_register,
+  std::vector< SpikeDataT >& send_buffer )
+{
+  // Need to get new positions in case buffer size has changed
+  SendBufferPosition send_buffer_position;
+
+  sw_collocate_spike_data_.start();
+
+  // Set marker at end of each chunk to DEFAULT
+  reset_complete_marker_spike_data_( send_buffer_position, send_buffer );
+  std::vector< size_t > num_spikes_per_rank( kernel().mpi_manager.get_num_processes(), 0 );
 
-    sw_communicate_spike_data_.stop();
+  // Collocate spikes to send buffer
+  collocate_spike_data_buffers_( send_buffer_position, spike_register, send_buffer, num_spikes_per_rank );
 
-    global_max_spikes_per_rank_ = get_global_max_spikes_per_rank_( send_buffer_position, recv_buffer );
+  if ( off_grid_spiking_ )
+  {
+    collocate_spike_data_buffers_( send_buffer_position, off_grid_spike_register, send_buffer, num_spikes_per_rank );
+  }
 
-    all_spikes_transmitted =
-      global_max_spikes_per_rank_ <= kernel().mpi_manager.get_send_recv_count_spike_data_per_rank();
+  // Largest number of spikes sent from this rank to any other rank.
+  const auto local_max_spikes_per_rank = *std::max_element( num_spikes_per_rank.begin(), num_spikes_per_rank.end() );
 
-    if ( not all_spikes_transmitted )
-    {
-      const size_t new_buff_size_per_rank =
-        static_cast< size_t >( ( 1 + send_recv_buffer_grow_extra_ ) * global_max_spikes_per_rank_ );
+  // At this point, all send_buffer entries with spikes to be transmitted, as well
+  // as all chunk-end entries, have marker DEFAULT.
+  set_end_marker_( send_buffer_position, send_buffer, local_max_spikes_per_rank );
 
-      kernel().mpi_manager.set_buffer_size_spike_data(
-        kernel().mpi_manager.get_num_processes() * new_buff_size_per_rank );
-      resize_send_recv_buffers_spike_data_();
-      send_recv_buffer_resize_log_.add_entry( global_max_spikes_per_rank_, new_buff_size_per_rank );
-    }
+  sw_collocate_spike_data_.stop();
+}
 
-  } while ( not all_spikes_transmitted );
+template < typename SpikeDataT >
+bool
+EventDeliveryManager::check_spike_data_transmitted_( std::vector< SpikeDataT >& recv_buffer )
+{
+  SendBufferPosition send_buffer_position;
+  global_max_spikes_per_rank_ = get_global_max_spikes_per_rank_( send_buffer_position, recv_buffer );
 
-  // We cannot shrink buffers here, because they first need to be read out by
-  // deliver events. Shrinking will happen at beginning of next gather.
+  const bool all_spikes_transmitted =
+    global_max_spikes_per_rank_ <= kernel().mpi_manager.get_send_recv_count_spike_data_per_rank();
 
-  /* emitted_spike_register is cleared by deliver_events in a thread-parallel context.
-     We could in principle clear it here, but since it can conveniently be done thread-parallel,
-     it is best to postpone.
-   */
+  if ( not all_spikes_transmitted )
+  {
+    const size_t new_buff_size_per_rank =
+      static_cast< size_t >( ( 1 + send_recv_buffer_grow_extra_ ) * global_max_spikes_per_rank_ );
+
+    kernel().mpi_manager.set_buffer_size_spike_data(
+      kernel().mpi_manager.get_num_processes() * new_buff_size_per_rank );
+    resize_send_recv_buffers_spike_data_();
+    send_recv_buffer_resize_log_.add_entry( global_max_spikes_per_rank_, new_buff_size_per_rank );
+  }
+
+  return all_spikes_transmitted;
 }
 
 template < typename SpikeDataWithRankT, typename SpikeDataT >
@@ -582,23 +1177,67 @@ EventDeliveryManager::get_global_max_spikes_per_rank_( const SendBufferPosition&
   return maximum;
 }
 
+template < typename SpikeDataT >
+size_t
+EventDeliveryManager::get_num_spikes_received_( const size_t rank,
+  const std::vector< SpikeDataT >& recv_buffer,
+  const size_t spike_buffer_size_per_rank,
+  size_t& rank_begin ) const
+{
+  if ( use_sparse_spike_exchange_ )
+  {
+    rank_begin = recv_displacements_spike_data_[ rank ];
+    return recv_counts_spike_data_[ rank ];
+  }
+
+  rank_begin = rank * spike_buffer_size_per_rank;
+
+  // No spikes were sent by rank if the first entry is marked invalid
+  if ( recv_buffer[ rank_begin ].is_invalid_marker() )
+  {
+    return 0;
+  }
+
+  // Find end marker, which is set on the last spike sent by rank
+  for ( size_t i = 0; i < spike_buffer_size_per_rank; ++i )
+  {
+    if ( recv_buffer[ rank_begin + i ].is_end_marker() )
+    {
+      return i + 1;
+    }
+  }
+
+  // If we get here, no spikes were sent by rank
+  return 0;
+}
+
 void
 EventDeliveryManager::deliver_events( const size_t tid )
 {
-  if ( off_grid_spiking_ )
+  if ( use_pipelined_spike_exchange_ )
+  {
+    if ( spike_data_ready_ )
+    {
+      deliver_events_( tid, ready_recv_buffer_spike_data_, ready_send_recv_count_spike_data_per_rank_ );
+    }
+  }
+  else if ( off_grid_spiking_ )
   {
-    deliver_events_( tid, recv_buffer_off_grid_spike_data_ );
+    deliver_events_(
+      tid, recv_buffer_off_grid_spike_data_, kernel().mpi_manager.get_send_recv_count_spike_data_per_rank() );
   }
   else
   {
-    deliver_events_( tid, recv_buffer_spike_data_ );
+    deliver_events_( tid, recv_buffer_spike_data_, kernel().mpi_manager.get_send_recv_count_spike_data_per_rank() );
   }
   reset_spike_register_( tid );
 }
 
 template < typename SpikeDataT >
 void
-EventDeliveryManager::deliver_events_( const size_t tid, const std::vector< SpikeDataT >& recv_buffer )
+EventDeliveryManager::deliver_events_( const size_t tid,
+  const std::vector< SpikeDataT >& recv_buffer,
+  const size_t spike_buffer_size_per_rank )
 {
   // deliver only at beginning of time slice
   if ( kernel().simulation_manager.get_from_step() > 0 )
@@ -606,41 +1245,39 @@ EventDeliveryManager::deliver_events_( const size_t tid, const std::vector< Spik
     return;
   }
 
-  const size_t spike_buffer_size_per_rank = kernel().mpi_manager.get_send_recv_count_spike_data_per_rank();
   const std::vector< ConnectorModel* >& cm = kernel().model_manager.get_connection_models( tid );
 
+  // Spikes were emitted in the previous time slice, or in the slice before if the spike exchange is pipelined.
+  const long min_delay = kernel().connection_manager.get_min_delay();
+  const long slice_offset = use_pipelined_spike_exchange_ ? 2 * min_delay : min_delay;
+
   // prepare Time objects for every possible time stamp within min_delay_
-  std::vector< Time > prepared_timestamps( kernel().connection_manager.get_min_delay() );
-  for ( size_t lag = 0; lag < static_cast< size_t >( kernel().connection_manager.get_min_delay() ); ++lag )
+  std::vector< Time > prepared_timestamps( min_delay );
+  for ( size_t lag = 0; lag < static_cast< size_t >( min_delay ); ++lag )
+  {
+    // Subtract slice offset because we use current clock.
+    prepared_timestamps[ lag ] = kernel().simulation_manager.get_clock() + Time::step( lag + 1 - slice_offset );
+  }
+
+  if ( use_sorted_spike_delivery_ )
   {
-    // Subtract min_delay because spikes were emitted in previous time slice and we use current clock.
-    prepared_timestamps[ lag ] =
-      kernel().simulation_manager.get_clock() + Time::step( lag + 1 - kernel().connection_manager.get_min_delay() );
+    deliver_events_sorted_( tid, recv_buffer, spike_buffer_size_per_rank, prepared_timestamps, cm );
+    return;
   }
 
   // Deliver spikes sent by each rank in order
   for ( size_t rank = 0; rank < kernel().mpi_manager.get_num_processes(); ++rank )
   {
+    size_t rank_begin = 0;
+    const size_t num_spikes_received =
+      get_num_spikes_received_( rank, recv_buffer, spike_buffer_size_per_rank, rank_begin );
+
     // Continue with next rank if no spikes were sent by current rank
-    if ( recv_buffer[ rank * spike_buffer_size_per_rank ].is_invalid_marker() )
+    if ( num_spikes_received == 0 )
     {
       continue;
     }
 
-    // Find number of spikes received from current rank
-    size_t num_spikes_received = 0;
-    for ( size_t i = 0; i < spike_buffer_size_per_rank; ++i )
-    {
-      const SpikeDataT& spike_data = recv_buffer[ rank * spike_buffer_size_per_rank + i ];
-
-      // break if this was the last valid entry from this rank
-      if ( spike_data.is_end_marker() )
-      {
-        num_spikes_received = i + 1;
-        break;
-      }
-    }
-
     // For each batch, extract data first from receive buffer into value-specific arrays, then deliver from these arrays
     constexpr size_t SPIKES_PER_BATCH = 8;
     const size_t num_batches = num_spikes_received / SPIKES_PER_BATCH;
@@ -657,7 +1294,7 @@ EventDeliveryManager::deliver_events_( const size_t tid, const std::vector< Spik
       {
         for ( size_t j = 0; j < SPIKES_PER_BATCH; ++j )
         {
-          const SpikeDataT& spike_data = recv_buffer[ rank * spike_buffer_size_per_rank + i * SPIKES_PER_BATCH + j ];
+          const SpikeDataT& spike_data = recv_buffer[ rank_begin + i * SPIKES_PER_BATCH + j ];
           se_batch[ j ].set_stamp( prepared_timestamps[ spike_data.get_lag() ] );
           se_batch[ j ].set_offset( spike_data.get_offset() );
           tid_batch[ j ] = spike_data.get_tid();
@@ -677,8 +1314,7 @@ EventDeliveryManager::deliver_events_( const size_t tid, const std::vector< Spik
       // Processed all regular-sized batches, now do remainder
       for ( size_t j = 0; j < num_remaining_entries; ++j )
       {
-        const SpikeDataT& spike_data =
-          recv_buffer[ rank * spike_buffer_size_per_rank + num_batches * SPIKES_PER_BATCH + j ];
+        const SpikeDataT& spike_data = recv_buffer[ rank_begin + num_batches * SPIKES_PER_BATCH + j ];
         se_batch[ j ].set_stamp( prepared_timestamps[ spike_data.get_lag() ] );
         se_batch[ j ].set_offset( spike_data.get_offset() );
         tid_batch[ j ] = spike_data.get_tid();
@@ -700,7 +1336,7 @@ EventDeliveryManager::deliver_events_( const size_t tid, const std::vector< Spik
       {
         for ( size_t j = 0; j < SPIKES_PER_BATCH; ++j )
         {
-          const SpikeDataT& spike_data = recv_buffer[ rank * spike_buffer_size_per_rank + i * SPIKES_PER_BATCH + j ];
+          const SpikeDataT& spike_data = recv_buffer[ rank_begin + i * SPIKES_PER_BATCH + j ];
 
           se_batch[ j ].set_stamp( prepared_timestamps[ spike_data.get_lag() ] );
           se_batch[ j ].set_offset( spike_data.get_offset() );
@@ -738,8 +1374,7 @@ EventDeliveryManager::deliver_events_( const size_t tid, const std::vector< Spik
       // Processed all regular-sized batches, now do remainder
       for ( size_t j = 0; j < num_remaining_entries; ++j )
       {
-        const SpikeDataT& spike_data =
-          recv_buffer[ rank * spike_buffer_size_per_rank + num_batches * SPIKES_PER_BATCH + j ];
+        const SpikeDataT& spike_data = recv_buffer[ rank_begin + num_batches * SPIKES_PER_BATCH + j ];
         se_batch[ j ].set_stamp( prepared_timestamps[ spike_data.get_lag() ] );
         se_batch[ j ].set_offset( spike_data.get_offset() );
         syn_id_batch[ j ] = spike_data.get_syn_id();
@@ -774,12 +1409,139 @@ EventDeliveryManager::deliver_events_( const size_t tid, const std::vector< Spik
   }   // for rank
 }
 
+template < typename SpikeDataT >
+void
+EventDeliveryManager::deliver_events_sorted_( const size_t tid,
+  const std::vector< SpikeDataT >& recv_buffer,
+  const size_t spike_buffer_size_per_rank,
+  const std::vector< Time >& prepared_timestamps,
+  const std::vector< ConnectorModel* >& cm )
+{
+  const bool use_compressed_spikes = kernel().connection_manager.use_compressed_spikes();
+
+  std::vector< SpikeDeliveryEntry >& spikes = *spikes_for_delivery_[ tid ];
+  spikes.clear();
+
+  // Collect all spikes for this thread from the receive buffer
+  for ( size_t rank = 0; rank < kernel().mpi_manager.get_num_processes(); ++rank )
+  {
+    size_t rank_begin = 0;
+    const size_t num_spikes_received =
+      get_num_spikes_received_( rank, recv_buffer, spike_buffer_size_per_rank, rank_begin );
+
+    for ( size_t i = 0; i < num_spikes_received; ++i )
+    {
+      const SpikeDataT& spike_data = recv_buffer[ rank_begin + i ];
+
+      const synindex syn_id = spike_data.get_syn_id();
+      size_t lcid = spike_data.get_lcid();
+      bool is_local = true;
+
+      if ( use_compressed_spikes )
+      {
+        // for compressed spikes lcid holds the index in the compressed_spike_data structure
+        lcid = kernel().connection_manager.get_compressed_spike_data( syn_id, lcid )[ tid ].get_lcid();
+        is_local = lcid != invalid_lcid;
+      }
+      else
+      {
+        is_local = spike_data.get_tid() == tid;
+      }
+
+      if ( is_local )
+      {
+        spikes.push_back( { ( static_cast< uint64_t >( syn_id ) << NUM_BITS_LCID ) | lcid,
+          spike_data.get_offset(),
+          spike_data.get_lag() } );
+      }
+    }
+  }
+
+  sort_spikes_for_delivery_( tid );
+
+  constexpr uint64_t lcid_mask = ( uint64_t( 1 ) << NUM_BITS_LCID ) - 1;
+
+  // Deliver spikes for each synapse type in one batch
+  std::vector< BatchedSpike >& batch = *spike_batch_for_delivery_[ tid ];
+  SpikeEvent se;
+  size_t batch_begin = 0;
+  while ( batch_begin < spikes.size() )
+  {
+    const synindex syn_id = static_cast< synindex >( spikes[ batch_begin ].key >> NUM_BITS_LCID );
+
+    batch.clear();
+    size_t i = batch_begin;
+    for ( ; i < spikes.size() and static_cast< synindex >( spikes[ i ].key >> NUM_BITS_LCID ) == syn_id; ++i )
+    {
+      batch.push_back( { static_cast< size_t >( spikes[ i ].key & lcid_mask ),
+        prepared_timestamps[ spikes[ i ].lag ], spikes[ i ].offset } );
+    }
+
+    kernel().connection_manager.send_batch( tid, syn_id, batch.data(), batch.size(), cm, se );
+    batch_begin = i;
+  }
+}
+
+void
+EventDeliveryManager::sort_spikes_for_delivery_( const size_t tid )
+{
+  std::vector< SpikeDeliveryEntry >& spikes = *spikes_for_delivery_[ tid ];
+  std::vector< SpikeDeliveryEntry >& scratch = *spikes_for_delivery_scratch_[ tid ];
+
+  if ( spikes.size() < 2 )
+  {
+    return;
+  }
+
+  uint64_t max_key = 0;
+  for ( const auto& spike : spikes )
+  {
+    max_key = std::max( max_key, spike.key );
+  }
+
+  // Counting sort by one byte of the key per pass, starting with the least
+  // significant byte; only as many passes as required by the largest key.
+  constexpr size_t RADIX_BITS = 8;
+  constexpr size_t RADIX = size_t( 1 ) << RADIX_BITS;
+  scratch.resize( spikes.size() );
+  std::vector< size_t > bucket_begin( RADIX );
+
+  for ( size_t shift = 0; shift < 64 and ( max_key >> shift ) > 0; shift += RADIX_BITS )
+  {
+    std::fill( bucket_begin.begin(), bucket_begin.end(), 0 );
+    for ( const auto& spike : spikes )
+    {
+      ++bucket_begin[ ( spike.key >> shift ) & ( RADIX - 1 ) ];
+    }
+
+    size_t begin = 0;
+    for ( auto& b : bucket_begin )
+    {
+      const size_t count = b;
+      b = begin;
+      begin += count;
+    }
+
+    for ( const auto& spike : spikes )
+    {
+      scratch[ bucket_begin[ ( spike.key >> shift ) & ( RADIX - 1 ) ]++ ] = spike;
+    }
+    spikes.swap( scratch );
+  }
+}
+
 
 void
 EventDeliveryManager::gather_target_data( const size_t tid )
 {
   assert( not kernel().connection_manager.is_source_table_cleared() );
 
+  if ( use_pipelined_target_data_exchange_ )
+  {
+    gather_target_data_pipelined_( tid );
+    return;
+  }
+
   // assume all threads have some work to do
   gather_completed_checker_.set_false( tid );
   assert( gather_completed_checker_.all_false() );
@@ -789,6 +1551,13 @@ EventDeliveryManager::gather_target_data( const size_t tid )
   kernel().connection_manager.prepare_target_table( tid );
   kernel().connection_manager.reset_source_table_entry_point( tid );
 
+#pragma omp master
+  {
+    sw_target_data_exchange_round_.reset();
+    sw_target_data_exchange_round_.start();
+  }
+  size_t round = 0;
+
   while ( gather_completed_checker_.any_false() )
   {
     // assume this is the last gather round and change to false
@@ -832,9 +1601,16 @@ EventDeliveryManager::gather_target_data( const size_t tid )
     } // of omp master (no barriers!)
 #pragma omp barrier
 
-    const bool distribute_completed = distribute_target_data_buffers_( tid );
+    const bool distribute_completed =
+      distribute_target_data_buffers_( tid, kernel().mpi_manager.get_send_recv_count_target_data_per_rank() );
     gather_completed_checker_.logical_and( tid, distribute_completed );
 
+#pragma omp master
+    {
+      log_target_data_exchange_round_( round, kernel().mpi_manager.get_send_recv_count_target_data_per_rank() );
+    }
+    ++round;
+
     // resize mpi buffers, if necessary and allowed
     if ( gather_completed_checker_.any_false() and kernel().mpi_manager.adaptive_target_buffers() )
     {
@@ -854,6 +1630,12 @@ EventDeliveryManager::gather_target_data_compressed( const size_t tid )
 {
   assert( not kernel().connection_manager.is_source_table_cleared() );
 
+  if ( use_pipelined_target_data_exchange_ )
+  {
+    gather_target_data_pipelined_( tid );
+    return;
+  }
+
   // assume all threads have some work to do
   gather_completed_checker_.set_false( tid );
   assert( gather_completed_checker_.all_false() );
@@ -862,6 +1644,13 @@ EventDeliveryManager::gather_target_data_compressed( const size_t tid )
 
   kernel().connection_manager.prepare_target_table( tid );
 
+#pragma omp master
+  {
+    sw_target_data_exchange_round_.reset();
+    sw_target_data_exchange_round_.start();
+  }
+  size_t round = 0;
+
   while ( gather_completed_checker_.any_false() )
   {
     // assume this is the last gather round and change to false otherwise
@@ -906,9 +1695,16 @@ EventDeliveryManager::gather_target_data_compressed( const size_t tid )
     // Up to here, gather_completed_checker_ just has local info: has this thread been able to write
     // all data it is responsible for to buffers. Now combine with information on whether other ranks
     // have sent all their data. Note: All threads will return the same value for distribute_completed.
-    const bool distribute_completed = distribute_target_data_buffers_( tid );
+    const bool distribute_completed =
+      distribute_target_data_buffers_( tid, kernel().mpi_manager.get_send_recv_count_target_data_per_rank() );
     gather_completed_checker_.logical_and( tid, distribute_completed );
 
+#pragma omp master
+    {
+      log_target_data_exchange_round_( round, kernel().mpi_manager.get_send_recv_count_target_data_per_rank() );
+    }
+    ++round;
+
     // resize mpi buffers, if necessary and allowed
     if ( gather_completed_checker_.any_false() and kernel().mpi_manager.adaptive_target_buffers() )
     {
@@ -926,6 +1722,178 @@ EventDeliveryManager::gather_target_data_compressed( const size_t tid )
   kernel().connection_manager.clear_source_table( tid );
 }
 
+void
+EventDeliveryManager::gather_target_data_pipelined_( const size_t tid )
+{
+  const AssignedRanks assigned_ranks = kernel().vp_manager.get_assigned_ranks( tid );
+
+  kernel().connection_manager.prepare_target_table( tid );
+  if ( not kernel().connection_manager.use_compressed_spikes() )
+  {
+    kernel().connection_manager.reset_source_table_entry_point( tid );
+  }
+
+#pragma omp master
+  {
+    sw_target_data_exchange_round_.reset();
+    sw_target_data_exchange_round_.start();
+  }
+  size_t round = 0;
+
+  // The send buffer of the first round has been sized by resize_send_recv_buffers_target_data().
+  // All threads hold the same value of is_collocation_completed and is_exchange_completed.
+  bool is_collocation_completed = collocate_target_data_round_( tid, assigned_ranks );
+
+  while ( true )
+  {
+    const unsigned int send_recv_count_target_data_per_rank =
+      kernel().mpi_manager.get_send_recv_count_target_data_per_rank();
+
+#pragma omp master
+    {
+      // the collocated buffer becomes pending, the buffer of the previous round is reused for the next
+      send_buffer_target_data_.swap( pending_send_buffer_target_data_ );
+      recv_buffer_target_data_.resize( kernel().mpi_manager.get_buffer_size_target_data() );
+      sw_communicate_target_data_.start();
+      kernel().mpi_manager.communicate_target_data_Ialltoall(
+        pending_send_buffer_target_data_, recv_buffer_target_data_ );
+      sw_communicate_target_data_.stop();
+
+      if ( not is_collocation_completed )
+      {
+        prepare_next_round_target_data_();
+      }
+    } // of omp master
+    kernel().get_omp_synchronization_construction_stopwatch().start();
+#pragma omp barrier
+    kernel().get_omp_synchronization_construction_stopwatch().stop();
+
+    // collocate the next round while the exchange of this round is pending
+    bool is_next_collocation_completed = true;
+    if ( not is_collocation_completed )
+    {
+      is_next_collocation_completed = collocate_target_data_round_( tid, assigned_ranks );
+    }
+
+#pragma omp master
+    {
+      sw_communicate_target_data_.start();
+      kernel().mpi_manager.wait_target_data_Ialltoall();
+      sw_communicate_target_data_.stop();
+    } // of omp master
+    kernel().get_omp_synchronization_construction_stopwatch().start();
+#pragma omp barrier
+    kernel().get_omp_synchronization_construction_stopwatch().stop();
+
+    const bool is_exchange_completed = distribute_target_data_buffers_( tid, send_recv_count_target_data_per_rank );
+
+#pragma omp master
+    {
+      log_target_data_exchange_round_( round, send_recv_count_target_data_per_rank );
+    }
+    ++round;
+
+    if ( is_exchange_completed )
+    {
+      break;
+    }
+
+    if ( is_collocation_completed )
+    {
+      // This rank has sent all its target data, but other ranks have not. It
+      // takes part in the next round with a buffer that only holds markers,
+      // which must have the same size as on all other ranks.
+#pragma omp master
+      {
+        prepare_next_round_target_data_();
+      }
+      kernel().get_omp_synchronization_construction_stopwatch().start();
+#pragma omp barrier
+      kernel().get_omp_synchronization_construction_stopwatch().stop();
+
+      is_next_collocation_completed = collocate_target_data_round_( tid, assigned_ranks );
+    }
+    else
+    {
+      // all threads must have distributed target data before the receive buffer is used again
+      kernel().get_omp_synchronization_construction_stopwatch().start();
+#pragma omp barrier
+      kernel().get_omp_synchronization_construction_stopwatch().stop();
+    }
+
+    is_collocation_completed = is_next_collocation_completed;
+  } // of while
+
+  kernel().connection_manager.clear_source_table( tid );
+}
+
+bool
+EventDeliveryManager::collocate_target_data_round_( const size_t tid, const AssignedRanks& assigned_ranks )
+{
+  TargetSendBufferPosition send_buffer_position(
+    assigned_ranks, kernel().mpi_manager.get_send_recv_count_target_data_per_rank() );
+
+  bool is_collocation_completed;
+  if ( kernel().connection_manager.use_compressed_spikes() )
+  {
+    is_collocation_completed = collocate_target_data_buffers_compressed_( tid, assigned_ranks, send_buffer_position );
+  }
+  else
+  {
+    kernel().connection_manager.restore_source_table_entry_point( tid );
+    is_collocation_completed = collocate_target_data_buffers_( tid, assigned_ranks, send_buffer_position );
+    kernel().connection_manager.save_source_table_entry_point( tid );
+  }
+
+  if ( is_collocation_completed )
+  {
+    gather_completed_checker_.set_true( tid );
+  }
+  else
+  {
+    gather_completed_checker_.set_false( tid );
+  }
+
+  // waits for all threads, such that all entry points have been saved before cleaning the source table
+  is_collocation_completed = gather_completed_checker_.all_true();
+  if ( is_collocation_completed )
+  {
+    set_complete_marker_target_data_( assigned_ranks, send_buffer_position );
+  }
+
+  if ( not kernel().connection_manager.use_compressed_spikes() )
+  {
+    kernel().connection_manager.clean_source_table( tid );
+  }
+
+  kernel().get_omp_synchronization_construction_stopwatch().start();
+#pragma omp barrier
+  kernel().get_omp_synchronization_construction_stopwatch().stop();
+
+  return is_collocation_completed;
+}
+
+void
+EventDeliveryManager::prepare_next_round_target_data_()
+{
+  if ( kernel().mpi_manager.adaptive_target_buffers() )
+  {
+    kernel().mpi_manager.increase_buffer_size_target_data();
+  }
+  send_buffer_target_data_.resize( kernel().mpi_manager.get_buffer_size_target_data() );
+}
+
+void
+EventDeliveryManager::log_target_data_exchange_round_( const size_t round,
+  const unsigned int send_recv_count_target_data_per_rank )
+{
+  const size_t buffer_size = send_recv_count_target_data_per_rank * kernel().mpi_manager.get_num_processes();
+  target_data_exchange_log_.add_entry(
+    round, buffer_size, buffer_size * sizeof( TargetData ), sw_target_data_exchange_round_.elapsed() );
+  sw_target_data_exchange_round_.reset();
+  sw_target_data_exchange_round_.start();
+}
+
 bool
 EventDeliveryManager::collocate_target_data_buffers_( const size_t tid,
   const AssignedRanks& assigned_ranks,
@@ -1047,11 +2015,10 @@ nest::EventDeliveryManager::set_complete_marker_target_data_( const AssignedRank
 }
 
 bool
-nest::EventDeliveryManager::distribute_target_data_buffers_( const size_t tid )
+nest::EventDeliveryManager::distribute_target_data_buffers_( const size_t tid,
+  const unsigned int send_recv_count_target_data_per_rank )
 {
   bool are_others_completed = true;
-  const unsigned int send_recv_count_target_data_per_rank =
-    kernel().mpi_manager.get_send_recv_count_target_data_per_rank();
 
   for ( size_t rank = 0; rank < kernel().mpi_manager.get_num_processes(); ++rank )
   {
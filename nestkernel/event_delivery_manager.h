@@ -42,6 +42,7 @@
 #include "per_thread_bool_indicator.h"
 #include "secondary_event.h"
 #include "spike_data.h"
+#include "target_data_exchange_log.h"
 #include "target_table.h"
 #include "vp_manager.h"
 
@@ -52,6 +53,8 @@ namespace nest
 {
 typedef MPIManager::OffGridSpike OffGridSpike;
 
+struct BatchedSpike;
+class ConnectorModel;
 class TargetData;
 class SendBufferPosition;
 class TargetSendBufferPosition;
@@ -181,6 +184,26 @@ public:
    */
   long get_slice_modulo( long d );
 
+  //! Number of slots of ring buffers, min_delay + max_delay
+  long get_num_ring_buffer_slots() const;
+
+  /**
+   * Collect the spike input buffers of all local nodes.
+   *
+   * Called by SimulationManager::prepare() after nodes are prepared, since
+   * ring buffers may be reallocated then.
+   * @see Node::get_spike_input_buffer()
+   */
+  void register_spike_input_buffers();
+
+  /**
+   * Return spike input buffers of the nodes on thread tid.
+   *
+   * Indexed by thread-local node id; bins is nullptr for nodes which
+   * receive spikes through handle( SpikeEvent& ).
+   */
+  const std::vector< SpikeInputBuffer >& get_spike_input_buffers( const size_t tid ) const;
+
   /**
    * Resize spike_register and comm_buffer to correct dimensions.
    *
@@ -199,12 +222,49 @@ public:
 
   void configure_secondary_buffers();
 
+  /**
+   * Collocate spikes emitted by thread tid to the MPI send buffer.
+   *
+   * Must be called by all threads before gather_spike_data() is called by
+   * the master thread. Each thread counts its spikes per target rank; prefix
+   * sums over these counts give each thread its own positions in the send
+   * buffer, so that threads write their spikes without synchronization. The
+   * resulting buffer is identical to that of serial collocation. For
+   * pipelined spike exchange, spikes are only counted and collocated by
+   * gather_spike_data().
+   */
+  void collocate_spike_data( const size_t tid );
+
   /**
    * Collocates spikes from register to MPI buffers, communicates via
    * MPI and delivers events to targets.
+   *
+   * If use_pipelined_spike_exchange is set, the exchange of spikes is only
+   * started here and completed at the end of the following slice, so that
+   * communication overlaps with the update of that slice. The spikes are
+   * delivered one slice later than usual, which is why
+   * ConnectionManager::update_delay_extrema_() halves min_delay in this
+   * case.
    */
   void gather_spike_data();
 
+  /**
+   * Wait for completion of a pipelined spike exchange, if one is pending.
+   *
+   * Called at the end of each run, so that no exchange is pending while
+   * the kernel is not simulating.
+   */
+  void complete_pending_spike_exchange();
+
+  //! Whether the exchange of spikes overlaps with the update of the next slice
+  bool use_pipelined_spike_exchange() const;
+
+  //! Whether spikes are exchanged with MPI_Alltoallv instead of fixed-size buffers
+  bool use_sparse_spike_exchange() const;
+
+  //! Whether collocation of target data overlaps with the exchange of the previous round
+  bool use_pipelined_target_data_exchange() const;
+
   /**
    * Collocates presynaptic connection information, communicates via
    * MPI and creates presynaptic connection infrastructure.
@@ -272,6 +332,93 @@ private:
   template < typename SpikeDataT >
   void gather_spike_data_( std::vector< SpikeDataT >& send_buffer, std::vector< SpikeDataT >& recv_buffer );
 
+  /**
+   * Complete pending exchange, make its spikes ready for delivery and start
+   * exchange of the spikes emitted during the current slice.
+   */
+  void gather_spike_data_pipelined_();
+
+  /**
+   * Exchange spikes with MPI_Alltoallv.
+   *
+   * Ranks first exchange the number of spikes they send to each other rank,
+   * so that each rank sends exactly as many spikes as it has emitted. Used
+   * instead of gather_spike_data_() if use_sparse_spike_exchange is set.
+   */
+  template < typename SpikeDataT >
+  void gather_spike_data_sparse_( std::vector< SpikeDataT >& send_buffer, std::vector< SpikeDataT >& recv_buffer );
+
+  //! Add number of spikes in register to be sent to each rank to num_spikes_per_rank
+  template < typename SpikeDataWithRankT >
+  void count_spikes_per_rank_( const std::vector< std::vector< SpikeDataWithRankT >* >& spike_register,
+    std::vector< size_t >& num_spikes_per_rank ) const;
+
+  /**
+   * Write spikes from register to contiguous sections of the send buffer.
+   *
+   * The position of the next spike for each rank is given by send_buffer_idx
+   * and updated accordingly.
+   */
+  template < typename SpikeDataWithRankT, typename SpikeDataT >
+  void collocate_spike_data_buffers_sparse_( const std::vector< std::vector< SpikeDataWithRankT >* >& spike_register,
+    std::vector< SpikeDataT >& send_buffer,
+    std::vector< size_t >& send_buffer_idx ) const;
+
+  //! Add number of spikes to be sent to each rank to num_spikes_per_rank
+  template < typename SpikeDataWithRankT >
+  void count_thread_spikes_per_rank_( const std::vector< SpikeDataWithRankT >& emitted_spikes,
+    size_t* num_spikes_per_rank ) const;
+
+  //! Collocate spikes emitted by thread tid to send buffer, see collocate_spike_data()
+  template < typename SpikeDataT >
+  void collocate_spike_data_parallel_( const size_t tid, std::vector< SpikeDataT >& send_buffer );
+
+  /**
+   * Turn per-thread spike counts into positions in the send buffer.
+   *
+   * Called by the master thread only. Also prepares the send buffer and
+   * records the number of spikes sent in the histogram.
+   */
+  template < typename SpikeDataT >
+  void compute_spike_data_write_positions_( std::vector< SpikeDataT >& send_buffer );
+
+  /**
+   * Write spikes of one thread to the send buffer, starting at write_position.
+   *
+   * Spikes beyond the end of the section of a rank are counted, but not written.
+   */
+  template < typename SpikeDataWithRankT, typename SpikeDataT >
+  void collocate_thread_spike_data_( const std::vector< SpikeDataWithRankT >& emitted_spikes,
+    size_t* write_position,
+    std::vector< SpikeDataT >& send_buffer ) const;
+
+  //! Set markers after collocate_spike_data(), completing collocation for fixed-size exchanges
+  template < typename SpikeDataT >
+  void set_end_marker_collocated_( std::vector< SpikeDataT >& send_buffer );
+
+  /**
+   * Shrink MPI buffers for spike data if they were mostly empty in the last exchange.
+   */
+  void shrink_send_recv_buffers_spike_data_();
+
+  /**
+   * Collocate spikes from registers to send buffer and set markers.
+   *
+   * Off-grid spikes are only collocated if off-grid spiking is used.
+   */
+  template < typename SpikeDataT >
+  void collocate_spike_data_( std::vector< std::vector< SpikeDataWithRank >* >& spike_register,
+    std::vector< std::vector< OffGridSpikeDataWithRank >* >& off_grid_spike_register,
+    std::vector< SpikeDataT >& send_buffer );
+
+  /**
+   * Check whether all ranks could send all spikes, grow buffers if not.
+   *
+   * @returns true if all spikes were transmitted
+   */
+  template < typename SpikeDataT >
+  bool check_spike_data_transmitted_( std::vector< SpikeDataT >& recv_buffer );
+
   void resize_send_recv_buffers_spike_data_();
 
   /**
@@ -295,6 +442,18 @@ private:
     std::vector< SpikeDataT >& send_buffer,
     size_t local_max_spikes_per_rank );
 
+  /**
+   * Get number of spikes received from rank and position of first spike in receive buffer.
+   *
+   * For fixed-size exchanges, the number of spikes is found from the markers
+   * in the section of the receive buffer for rank.
+   */
+  template < typename SpikeDataT >
+  size_t get_num_spikes_received_( const size_t rank,
+    const std::vector< SpikeDataT >& recv_buffer,
+    const size_t spike_buffer_size_per_rank,
+    size_t& rank_begin ) const;
+
   /**
    * Resets marker in MPI buffer that signals end of communication
    * across MPI ranks.
@@ -318,7 +477,32 @@ private:
    * nodes.
    */
   template < typename SpikeDataT >
-  void deliver_events_( const size_t tid, const std::vector< SpikeDataT >& recv_buffer );
+  void deliver_events_( const size_t tid,
+    const std::vector< SpikeDataT >& recv_buffer,
+    const size_t spike_buffer_size_per_rank );
+
+  /**
+   * Reads spikes for thread tid from MPI buffers, sorts them by synapse type
+   * and local connection index and delivers them in this order.
+   *
+   * Used instead of deliver_events_() if use_sorted_spike_delivery is set.
+   * Connections are thus accessed in the order in which they are stored in
+   * memory, which is prefetched ahead of delivery. Spikes for the same
+   * connection are delivered in the order in which they were received. All
+   * spikes for one synapse type are delivered by a single call to
+   * ConnectionManager::send_batch().
+   */
+  template < typename SpikeDataT >
+  void deliver_events_sorted_( const size_t tid,
+    const std::vector< SpikeDataT >& recv_buffer,
+    const size_t spike_buffer_size_per_rank,
+    const std::vector< Time >& prepared_timestamps,
+    const std::vector< ConnectorModel* >& cm );
+
+  /**
+   * Stable LSD radix sort of spikes_for_delivery_[ tid ] by key.
+   */
+  void sort_spikes_for_delivery_( const size_t tid );
 
   /**
    * Deletes all spikes from spike registers and resets spike
@@ -346,6 +530,43 @@ private:
     const AssignedRanks& assigned_ranks,
     TargetSendBufferPosition& send_buffer_position );
 
+  /**
+   * Gathers target data with pipelined exchange, see
+   * use_pipelined_target_data_exchange.
+   *
+   * While the exchange of one round is pending, the threads collocate the
+   * target data of the next round into a second send buffer, which is sized
+   * by growing the buffer of the pending round. Collocation is only started
+   * ahead of time if this rank has target data left to send; otherwise it
+   * only writes markers once the pending round turns out not to be the last.
+   */
+  void gather_target_data_pipelined_( const size_t tid );
+
+  /**
+   * Collocates target data of one round into send_buffer_target_data_.
+   *
+   * Must be called by all threads. Sets the complete markers if all threads
+   * have collocated all their target data and returns whether this is the
+   * case.
+   */
+  bool collocate_target_data_round_( const size_t tid, const AssignedRanks& assigned_ranks );
+
+  /**
+   * Grows the MPI buffers for communication of connections for the next
+   * round of pipelined exchange, if adaptive, and resizes the send buffer.
+   *
+   * Must only be called by the master thread.
+   */
+  void prepare_next_round_target_data_();
+
+  /**
+   * Adds the round that has just been completed to target_data_exchange_log_
+   * and restarts the round timer.
+   *
+   * Must only be called by the master thread.
+   */
+  void log_target_data_exchange_round_( const size_t round, const unsigned int send_recv_count_target_data_per_rank );
+
   /**
    * Sets marker in MPI buffer that signals end of communication
    * across MPI ranks.
@@ -358,7 +579,7 @@ private:
    * objects on TargetTable (presynaptic part of connection
    * infrastructure).
    */
-  bool distribute_target_data_buffers_( const size_t tid );
+  bool distribute_target_data_buffers_( const size_t tid, const unsigned int send_recv_count_target_data_per_rank );
 
   /**
    * Sends event e to all targets of node source. Delivers events from
@@ -368,11 +589,37 @@ private:
   void send_local_( Node& source, EventT& e, const long lag );
   void send_local_( Node& source, SecondaryEvent& e, const long lag );
 
+  /**
+   * Received spike to be delivered by deliver_events_sorted_().
+   *
+   * The key combines synapse type and local connection index such that
+   * sorting by key orders spikes by synapse type first and by local
+   * connection index second.
+   */
+  struct SpikeDeliveryEntry
+  {
+    uint64_t key;
+    double offset;
+    unsigned int lag;
+  };
+
   //--------------------------------------------------//
 
   bool off_grid_spiking_; //!< indicates whether spikes are not constrained to
                           //!< the grid
 
+  //! whether to deliver received spikes sorted by synapse type and local connection index
+  bool use_sorted_spike_delivery_;
+
+  //! whether the exchange of spikes overlaps with the update of the next slice
+  bool use_pipelined_spike_exchange_;
+
+  //! whether spikes are exchanged with MPI_Alltoallv instead of fixed-size buffers
+  bool use_sparse_spike_exchange_;
+
+  //! whether collocation of target data overlaps with the exchange of the previous round
+  bool use_pipelined_target_data_exchange_;
+
   /**
    * Table of pre-computed modulos.
    *
@@ -436,15 +683,95 @@ private:
 
   std::vector< SpikeData > send_buffer_spike_data_;
   std::vector< SpikeData > recv_buffer_spike_data_;
+
+  /**
+   * State of pipelined spike exchange.
+   *
+   * The exchange started at the end of a slice uses send_buffer_spike_data_
+   * and recv_buffer_spike_data_ and is pending until the end of the next
+   * slice. Then, the buffers are swapped with the ready buffers, from which
+   * spikes are delivered at the beginning of the slice after. Spikes of the
+   * pending exchange are kept in pending_emitted_spikes_register_, so that
+   * they can be sent again if the MPI buffers turn out to be too small.
+   */
+  bool spike_exchange_pending_;   //!< exchange has been started and spikes not yet made ready
+  bool spike_exchange_completed_; //!< pending exchange has been completed
+  bool spike_data_ready_;         //!< ready buffers contain spikes to deliver
+  std::vector< SpikeData > ready_send_buffer_spike_data_;
+  std::vector< SpikeData > ready_recv_buffer_spike_data_;
+  size_t pending_send_recv_count_spike_data_per_rank_;
+  size_t ready_send_recv_count_spike_data_per_rank_;
+  std::vector< std::vector< SpikeDataWithRank >* > pending_emitted_spikes_register_;
   std::vector< OffGridSpikeData > send_buffer_off_grid_spike_data_;
   std::vector< OffGridSpikeData > recv_buffer_off_grid_spike_data_;
 
+  /**
+   * Bookkeeping for sparse spike exchange.
+   *
+   * Before spikes are exchanged, each rank sends to each other rank two
+   * entries: the number of spikes sent to that rank and the largest number of
+   * spikes it sends to any rank. Counts and displacements for MPI are in units
+   * of unsigned int, those for delivery in units of spikes.
+   */
+  std::vector< unsigned int > send_count_info_spike_data_;
+  std::vector< unsigned int > recv_count_info_spike_data_;
+  std::vector< int > send_counts_spike_data_in_int_;
+  std::vector< int > send_displacements_spike_data_in_int_;
+  std::vector< int > recv_counts_spike_data_in_int_;
+  std::vector< int > recv_displacements_spike_data_in_int_;
+  std::vector< size_t > recv_counts_spike_data_;
+  std::vector< size_t > recv_displacements_spike_data_;
+
+  //! bytes sent by this rank in sparse spike exchanges since the last call to reset_counters()
+  long spike_exchange_bytes_sent_;
+
+  //! bytes that fixed-size spike exchanges of minimal size would have sent in addition
+  long spike_exchange_bytes_saved_;
+
+  /**
+   * Bookkeeping for thread-parallel collocation of spikes.
+   *
+   * spike_data_write_positions_ first holds the number of spikes per
+   * register, thread and rank, then the position in the send buffer at which
+   * the thread writes its next spike for that rank. Entries are indexed by
+   * ( register * num_threads + tid ) * num_ranks + rank, where register 0
+   * holds on-grid and register 1 off-grid spikes. This order reproduces the
+   * order of serial collocation.
+   */
+  std::vector< size_t > spike_data_write_positions_;
+  std::vector< size_t > spike_data_write_end_; //!< end of section for each rank
+  std::vector< size_t > num_spikes_per_rank_;  //!< total number of spikes to be sent to each rank
+  bool spike_data_collocated_;                 //!< send buffer has been filled by collocate_spike_data()
+
+  /**
+   * Histogram of the number of spikes this rank sends per slice.
+   *
+   * Bin 0 counts slices without spikes, bin k > 0 slices with 2^(k-1) to
+   * 2^k - 1 spikes. Spikes are counted once per target rank and thread, or
+   * once per target rank if use_compressed_spikes is set. Cleared by
+   * reset_counters() at the start of each call to Run().
+   */
+  std::vector< long > spikes_sent_per_slice_histogram_;
+
   std::vector< TargetData > send_buffer_target_data_;
   std::vector< TargetData > recv_buffer_target_data_;
 
+  //! send buffer of the pending round of pipelined target data exchange
+  std::vector< TargetData > pending_send_buffer_target_data_;
+
   //! whether size of MPI buffer for communication of connections was changed
   bool buffer_size_target_data_has_changed_;
 
+  /**
+   * Log all rounds of target data exchange.
+   *
+   * This is maintained by the main thread, which is responsible for communication and resizing.
+   */
+  TargetDataExchangeLog target_data_exchange_log_;
+
+  //! measures the duration of the current round of target data exchange
+  timers::StopwatchTimer< CLOCK_MONOTONIC > sw_target_data_exchange_round_;
+
   /**
    * Largest number of spikes sent from any rank to any other rank in last spike exchange round.
    *
@@ -466,6 +793,22 @@ private:
 
   PerThreadBoolIndicator gather_completed_checker_;
 
+  /**
+   * Per-thread buffers of spikes to be delivered by deliver_events_sorted_().
+   *
+   * The second buffer is scratch space for sorting. As for the spike
+   * registers, we store pointers so that the vectors are allocated in
+   * thread-local memory.
+   */
+  std::vector< std::vector< SpikeDeliveryEntry >* > spikes_for_delivery_;
+  std::vector< std::vector< SpikeDeliveryEntry >* > spikes_for_delivery_scratch_;
+
+  //! Per-thread buffers of spikes of one synapse type passed to ConnectionManager::send_batch()
+  std::vector< std::vector< BatchedSpike >* > spike_batch_for_delivery_;
+
+  //! Per-thread spike input buffers of local nodes, see register_spike_input_buffers()
+  std::vector< std::vector< SpikeInputBuffer >* > spike_input_buffers_;
+
   // private stop watches for benchmarking purposes
   // (intended for internal core developers, not for use in the public API)
   Stopwatch< StopwatchGranularity::Detailed, StopwatchParallelism::MasterOnly > sw_collocate_spike_data_;
@@ -492,6 +835,24 @@ EventDeliveryManager::send_to_node( Event& e )
   e();
 }
 
+inline bool
+EventDeliveryManager::use_pipelined_spike_exchange() const
+{
+  return use_pipelined_spike_exchange_;
+}
+
+inline bool
+EventDeliveryManager::use_sparse_spike_exchange() const
+{
+  return use_sparse_spike_exchange_;
+}
+
+inline bool
+EventDeliveryManager::use_pipelined_target_data_exchange() const
+{
+  return use_pipelined_target_data_exchange_;
+}
+
 inline bool
 EventDeliveryManager::get_off_grid_communication() const
 {
@@ -531,6 +892,18 @@ EventDeliveryManager::get_slice_modulo( long d )
   return slice_moduli_[ d ];
 }
 
+inline long
+EventDeliveryManager::get_num_ring_buffer_slots() const
+{
+  return moduli_.size();
+}
+
+inline const std::vector< SpikeInputBuffer >&
+EventDeliveryManager::get_spike_input_buffers( const size_t tid ) const
+{
+  return *spike_input_buffers_[ tid ];
+}
+
 } // namespace nest
 
 #endif /* EVENT_DELIVERY_MANAGER_H */
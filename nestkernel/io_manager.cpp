@@ -41,8 +41,10 @@
 #include "io_manager_impl.h"
 #include "kernel_manager.h"
 #include "recording_backend_ascii.h"
+#include "recording_backend_binary.h"
 #include "recording_backend_memory.h"
 #include "recording_backend_screen.h"
+#include "recording_backend_statistics.h"
 #ifdef HAVE_MPI
 #include "recording_backend_mpi.h"
 #include "stimulation_backend_mpi.h"
@@ -50,6 +52,9 @@
 #ifdef HAVE_SIONLIB
 #include "recording_backend_sionlib.h"
 #endif
+#ifdef HAVE_HDF5
+#include "recording_backend_hdf5.h"
+#endif
 
 // Includes from sli:
 #include "dictutils.h"
@@ -75,8 +80,10 @@ IOManager::initialize( const bool adjust_number_of_threads_or_rng_only )
     // Register backends again, since finalize cleans up
     // so backends from external modules are unloaded
     register_recording_backend< RecordingBackendASCII >( "ascii" );
+    register_recording_backend< RecordingBackendBinary >( "binary" );
     register_recording_backend< RecordingBackendMemory >( "memory" );
     register_recording_backend< RecordingBackendScreen >( "screen" );
+    register_recording_backend< RecordingBackendStatistics >( "statistics" );
 #ifdef HAVE_MPI
     register_recording_backend< RecordingBackendMPI >( "mpi" );
     register_stimulation_backend< StimulationBackendMPI >( "mpi" );
@@ -84,6 +91,9 @@ IOManager::initialize( const bool adjust_number_of_threads_or_rng_only )
 #ifdef HAVE_SIONLIB
     register_recording_backend< RecordingBackendSIONlib >( "sionlib" );
 #endif
+#ifdef HAVE_HDF5
+    register_recording_backend< RecordingBackendHDF5 >( "hdf5" );
+#endif
 
     DictionaryDatum dict( new Dictionary );
     // The properties data_path and data_prefix can be set via environment variables
@@ -316,6 +326,16 @@ IOManager::write( const Name backend_name,
   recording_backends_[ backend_name ]->write( device, event, double_values, long_values );
 }
 
+void
+IOManager::write_samples( const Name backend_name,
+  const RecordingDevice& device,
+  const std::vector< Time >& times,
+  const std::vector< size_t >& senders,
+  const std::vector< double >& values )
+{
+  recording_backends_[ backend_name ]->write_samples( device, times, senders, values );
+}
+
 void
 IOManager::enroll_recorder( const Name backend_name, const RecordingDevice& device, const DictionaryDatum& params )
 {
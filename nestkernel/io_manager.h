@@ -136,6 +136,23 @@ public:
     const std::vector< double >& double_values,
     const std::vector< long >& long_values );
 
+  /**
+   * Send a block of samples to a given recording backend.
+   *
+   * \param backend_name the name of the RecordingBackend to write to
+   * \param device a reference to the RecordingDevice that wants to write
+   * \param times the time stamps of the samples
+   * \param senders the node IDs of the sampled nodes
+   * \param values the sampled values in the order time × sender × value
+   *
+   * @see RecordingBackend::write_samples()
+   */
+  void write_samples( const Name backend_name,
+    const RecordingDevice& device,
+    const std::vector< Time >& times,
+    const std::vector< size_t >& senders,
+    const std::vector< double >& values );
+
   void enroll_recorder( const Name, const RecordingDevice&, const DictionaryDatum& );
   void enroll_stimulator( const Name, StimulationDevice&, const DictionaryDatum& );
 
@@ -95,15 +95,61 @@
  local_num_threads                     integertype - The local number of threads, defaults to 1.
  max_buffer_size_target_data           integertype - Maximal size of MPI buffers for communication of connections,
                                                      defaults to 16777216.
+ target_data_exchange_log              dict        - Information on the rounds of communication of connections as
+                                                     dictionary. For each round, it contains the index of the round
+                                                     within its update of the connection infrastructure, starting at 0,
+                                                     the buffer_size, that is, the number of entries exchanged, the
+                                                     bytes sent by this rank and the wall-clock time of the round in
+                                                     seconds (read only).
  num_processes                         integertype - The number of MPI processes (read only).
  off_grid_spiking                      booltype    - Whether to transmit precise spike times in MPI communication (read
                                                      only).
  total_num_virtual_procs               integertype - The total number of virtual processes, defaults to 1.
+ pin_threads                           booltype    - Whether to pin each thread to one of the CPUs available to the
+                                                     process, so that memory a thread allocates stays on its NUMA
+                                                     domain; can only be changed before nodes are created, defaults to
+                                                     false.
+ thread_cpus                           arraytype   - CPU on which each thread ran when the status was read (read only).
+ thread_numa_nodes                     arraytype   - NUMA node on which each thread ran when the status was read (read
+                                                     only).
+ compress_source_table                 booltype    - Whether to store the sorted source table in run-length and delta
+                                                     encoded form while connection information is transferred to the
+                                                     presynaptic side, reducing peak memory during the first call to
+                                                     Simulate(); requires keep_source_table to be false, defaults to
+                                                     false.
  use_compressed_spikes                 booltype    - Whether to use spike compression; if a neuron has targets on
                                                      multiple threads of a process, this switch makes sure that only a
                                                      single packet is sent to the process instead of one packet per
                                                      target thread (implies that connections will be sorted by source),
                                                      defaults to true.
+ use_incremental_connection_update     booltype    - Whether to only communicate connections created since the last
+                                                     update of the connection infrastructure and append them to the
+                                                     presynaptic target table; the infrastructure is rebuilt if
+                                                     connections were deleted, keep_source_table is false, or secondary
+                                                     connections or structural plasticity are used, defaults to true.
+ use_pipelined_spike_exchange          booltype    - Whether to overlap the MPI exchange of spikes with the update of
+                                                     the next time slice; spikes are then delivered one slice later,
+                                                     so min_delay is set to half the minimal delay in the network,
+                                                     cannot be combined with precise spike times or gap junctions,
+                                                     defaults to false.
+ use_pipelined_target_data_exchange    booltype    - Whether to collocate connection information for the next round
+                                                     of communication of connections while the current round is
+                                                     exchanged; the MPI buffers are sized from the largest number of
+                                                     connections sent from one rank to another and, if
+                                                     adaptive_target_buffers is set, grow in each further round up to
+                                                     max_buffer_size_target_data; needs memory for a second send
+                                                     buffer, defaults to false.
+ use_population_update                 booltype    - Whether to update consecutive nodes of models supporting it
+                                                     (iaf_psc_alpha, iaf_psc_exp, iaf_psc_delta) in batched,
+                                                     vectorized population kernels, defaults to false.
+ use_radix_sort                        booltype    - Whether to sort connections by source with a stable radix sort,
+                                                     which can use idle threads for large synapse types, instead of the
+                                                     in-place sort; faster with many connections per thread and
+                                                     synapse type, but needs 16 bytes of temporary memory per
+                                                     connection being sorted, defaults to false.
+ use_sorted_spike_delivery             booltype    - Whether to sort received spikes by synapse type and connection
+                                                     index before delivering them, so that connections are accessed
+                                                     in memory order, defaults to false.
 
  Random number generators
  rng_seed                              integertype - Seed value used as basis of seeding of all random number generators
@@ -122,6 +168,9 @@
  recording_backends                    arraytype   - List of available backends for recording devices (read only).
 
  Network information
+ compact_synapse_memory_saved          integertype - Number of bytes saved on this rank by storing connections in compact
+                                                     synapse models instead of the corresponding full synapse models
+                                                     (read only; local only).
  connection_rules                      arraytype   - The list of available connection rules (read only).
  growth_curves                         arraytype   - The list of the available structural plasticity growth curves
                                                      (read only).
@@ -139,6 +188,24 @@
                                                      (1 + spike_buffer_shrink_spare) * required_buffer_size`.
                                                      See `spike_buffer_shrink_limit` for when buffers shrink.
                                                      Defaults to 0.1.
+ spike_exchange_bytes_sent             integertype - Number of bytes sent by this rank in spike exchanges during the
+                                                     most recent call to Simulate(); only counted if
+                                                     use_sparse_spike_exchange is set (read only).
+ spike_exchange_bytes_saved            integertype - Number of bytes this rank would have sent in addition during the
+                                                     most recent call to Simulate() in a fixed-size exchange just large
+                                                     enough for the largest number of spikes sent between any two ranks;
+                                                     only counted if use_sparse_spike_exchange is set (read only).
+ spikes_sent_per_slice_histogram       arraytype   - Histogram of the number of spikes this rank sent per slice
+                                                     since the start of the most recent call to Run() or Simulate(),
+                                                     which reset it: entry 0 counts slices without spikes, entry k > 0
+                                                     slices with 2^(k-1) to 2^k - 1 spikes; spikes are counted once
+                                                     per target rank and thread, or once per target rank if
+                                                     use_compressed_spikes is set (read only).
+ use_sparse_spike_exchange             booltype    - Whether to exchange spikes with MPI_Alltoallv after exchanging the
+                                                     number of spikes for each pair of ranks, instead of with fixed-size
+                                                     buffers; cannot be combined with use_pipelined_spike_exchange and
+                                                     cannot be changed after Simulate has been called, defaults to
+                                                     false.
  spike_buffer_resize_log               dict        - Information on spike buffer resizing as dictionary. It contains the
                                                      times of the resizings (simulation clock in steps, always multiple
                                                      of min_delay), global_max_spikes_sent, that is, the observed spike
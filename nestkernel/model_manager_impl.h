@@ -61,6 +61,14 @@ ModelManager::register_connection_model( const std::string& name )
   ConnectorModel const* const dummy_model =
     new GenericConnectorModel< ConnectionT< TargetIdentifierPtrRport > >( "dummy" );
 
+  if ( dummy_model->has_property( ConnectionModelProperties::IS_COMPACT ) )
+  {
+    // Compact models exist only in the variant with the smallest target identifier
+    register_specific_connection_model_< ConnectionT< TargetIdentifierIndex > >( name );
+    delete dummy_model;
+    return;
+  }
+
   register_specific_connection_model_< ConnectionT< TargetIdentifierPtrRport > >( name );
   if ( dummy_model->has_property( ConnectionModelProperties::SUPPORTS_HPC ) )
   {
@@ -71,6 +71,8 @@ nest::MPIManager::MPIManager()
   , COMM_OVERFLOW_ERROR( std::numeric_limits< unsigned int >::max() )
   , comm( 0 )
   , MPI_OFFGRID_SPIKE( 0 )
+  , spike_data_request_( MPI_REQUEST_NULL )
+  , target_data_request_( MPI_REQUEST_NULL )
 #endif
 {
 }
@@ -739,6 +741,44 @@ nest::MPIManager::communicate_Allreduce_sum( std::vector< double >& send_buffer,
   MPI_Allreduce( &send_buffer[ 0 ], &recv_buffer[ 0 ], send_buffer.size(), MPI_Type< double >::type, MPI_SUM, comm );
 }
 
+void
+nest::MPIManager::communicate_Reduce_sum_in_place( std::vector< double >& buffer )
+{
+  if ( get_rank() == 0 )
+  {
+    MPI_Reduce( MPI_IN_PLACE, &buffer[ 0 ], buffer.size(), MPI_Type< double >::type, MPI_SUM, 0, comm );
+  }
+  else
+  {
+    MPI_Reduce( &buffer[ 0 ], nullptr, buffer.size(), MPI_Type< double >::type, MPI_SUM, 0, comm );
+  }
+}
+
+void
+nest::MPIManager::communicate_Gatherv( std::vector< double >& send_buffer, std::vector< double >& recv_buffer )
+{
+  int send_count = send_buffer.size();
+  std::vector< int > recv_counts( get_rank() == 0 ? get_num_processes() : 0 );
+  MPI_Gather( &send_count, 1, MPI_INT, recv_counts.data(), 1, MPI_INT, 0, comm );
+
+  std::vector< int > displacements( recv_counts.size(), 0 );
+  for ( size_t i = 1; i < recv_counts.size(); ++i )
+  {
+    displacements[ i ] = displacements[ i - 1 ] + recv_counts[ i - 1 ];
+  }
+  recv_buffer.resize( std::accumulate( recv_counts.begin(), recv_counts.end(), 0 ) );
+
+  MPI_Gatherv( send_buffer.data(),
+    send_count,
+    MPI_Type< double >::type,
+    recv_buffer.data(),
+    recv_counts.data(),
+    displacements.data(),
+    MPI_Type< double >::type,
+    0,
+    comm );
+}
+
 bool
 nest::MPIManager::equal_cross_ranks( const double value )
 {
@@ -764,6 +804,36 @@ nest::MPIManager::communicate_Alltoall_( void* send_buffer, void* recv_buffer, c
   MPI_Alltoall( send_buffer, send_recv_count, MPI_UNSIGNED, recv_buffer, send_recv_count, MPI_UNSIGNED, comm );
 }
 
+void
+nest::MPIManager::communicate_Ialltoall_( void* send_buffer,
+  void* recv_buffer,
+  const unsigned int send_recv_count,
+  MPI_Request& request )
+{
+  MPI_Ialltoall( send_buffer,
+    send_recv_count,
+    MPI_UNSIGNED,
+    recv_buffer,
+    send_recv_count,
+    MPI_UNSIGNED,
+    comm,
+    &request );
+}
+
+void
+nest::MPIManager::wait_spike_data_Ialltoall()
+{
+  // returns immediately if no exchange is pending
+  MPI_Wait( &spike_data_request_, MPI_STATUS_IGNORE );
+}
+
+void
+nest::MPIManager::wait_target_data_Ialltoall()
+{
+  // returns immediately if no exchange is pending
+  MPI_Wait( &target_data_request_, MPI_STATUS_IGNORE );
+}
+
 void
 nest::MPIManager::communicate_Alltoallv_( void* send_buffer,
   const int* send_counts,
@@ -1085,6 +1155,17 @@ nest::MPIManager::communicate_Allreduce_sum( std::vector< double >& send_buffer,
   recv_buffer.swap( send_buffer );
 }
 
+void
+nest::MPIManager::communicate_Reduce_sum_in_place( std::vector< double >& )
+{
+}
+
+void
+nest::MPIManager::communicate_Gatherv( std::vector< double >& send_buffer, std::vector< double >& recv_buffer )
+{
+  recv_buffer.swap( send_buffer );
+}
+
 bool
 nest::MPIManager::equal_cross_ranks( const double )
 {
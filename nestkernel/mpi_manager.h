@@ -159,6 +159,17 @@ public:
   void communicate_Allreduce_sum_in_place( std::vector< int >& buffer );
   void communicate_Allreduce_sum( std::vector< double >& send_buffer, std::vector< double >& recv_buffer );
 
+  //! Sum across all ranks, only rank 0 receives the result
+  void communicate_Reduce_sum_in_place( std::vector< double >& buffer );
+
+  /**
+   * Gather send_buffer vectors of all ranks to recv_buffer on rank 0.
+   *
+   * The send buffers may differ in size. On all other ranks, recv_buffer is
+   * cleared.
+   */
+  void communicate_Gatherv( std::vector< double >& send_buffer, std::vector< double >& recv_buffer );
+
   /**
    * Equal across all ranks.
    *
@@ -206,6 +217,11 @@ public:
 
   void communicate_Alltoall_( void* send_buffer, void* recv_buffer, const unsigned int send_recv_count );
 
+  void communicate_Ialltoall_( void* send_buffer,
+    void* recv_buffer,
+    const unsigned int send_recv_count,
+    MPI_Request& request );
+
   void communicate_Alltoallv_( void* send_buffer,
     const int* send_counts,
     const int* send_displacements,
@@ -225,6 +241,43 @@ public:
   void communicate_spike_data_Alltoall( std::vector< D >& send_buffer, std::vector< D >& recv_buffer );
   template < class D >
   void communicate_off_grid_spike_data_Alltoall( std::vector< D >& send_buffer, std::vector< D >& recv_buffer );
+
+  /**
+   * Exchange different amounts of data between each pair of ranks.
+   *
+   * Counts and displacements are given in units of unsigned int.
+   */
+  template < class D >
+  void communicate_Alltoallv( std::vector< D >& send_buffer,
+    const std::vector< int >& send_counts,
+    const std::vector< int >& send_displacements,
+    std::vector< D >& recv_buffer,
+    const std::vector< int >& recv_counts,
+    const std::vector< int >& recv_displacements );
+
+  /**
+   * Start non-blocking exchange of spike data.
+   *
+   * Neither buffer may be accessed before wait_spike_data_Ialltoall() has
+   * returned. At most one exchange may be pending at any time.
+   */
+  template < class D >
+  void communicate_spike_data_Ialltoall( std::vector< D >& send_buffer, std::vector< D >& recv_buffer );
+
+  //! Wait for completion of the pending non-blocking exchange of spike data, if any
+  void wait_spike_data_Ialltoall();
+
+  /**
+   * Start non-blocking exchange of target data.
+   *
+   * Neither buffer may be accessed before wait_target_data_Ialltoall() has
+   * returned. At most one exchange may be pending at any time.
+   */
+  template < class D >
+  void communicate_target_data_Ialltoall( std::vector< D >& send_buffer, std::vector< D >& recv_buffer );
+
+  //! Wait for completion of the pending non-blocking exchange of target data, if any
+  void wait_target_data_Ialltoall();
   template < class D >
   void communicate_secondary_events_Alltoallv( std::vector< D >& send_buffer, std::vector< D >& recv_buffer );
 
@@ -354,6 +407,12 @@ private:
   MPI_Comm comm;
   MPI_Datatype MPI_OFFGRID_SPIKE;
 
+  //! Request handle of pending non-blocking spike data exchange
+  MPI_Request spike_data_request_;
+
+  //! Request handle of pending non-blocking target data exchange
+  MPI_Request target_data_request_;
+
   void communicate_Allgather( std::vector< unsigned int >& send_buffer,
     std::vector< unsigned int >& recv_buffer,
     std::vector< int >& displacements );
@@ -684,6 +743,16 @@ MPIManager::time_communicate_alltoallv( int, int )
   return 0.0;
 }
 
+inline void
+MPIManager::wait_spike_data_Ialltoall()
+{
+}
+
+inline void
+MPIManager::wait_target_data_Ialltoall()
+{
+}
+
 #endif /* HAVE_MPI */
 
 #ifdef HAVE_MPI
@@ -699,6 +768,51 @@ MPIManager::communicate_Alltoall( std::vector< D >& send_buffer,
   communicate_Alltoall_( send_buffer_int, recv_buffer_int, send_recv_count );
 }
 
+template < class D >
+void
+MPIManager::communicate_Alltoallv( std::vector< D >& send_buffer,
+  const std::vector< int >& send_counts,
+  const std::vector< int >& send_displacements,
+  std::vector< D >& recv_buffer,
+  const std::vector< int >& recv_counts,
+  const std::vector< int >& recv_displacements )
+{
+  communicate_Alltoallv_( static_cast< void* >( send_buffer.data() ),
+    send_counts.data(),
+    send_displacements.data(),
+    static_cast< void* >( recv_buffer.data() ),
+    recv_counts.data(),
+    recv_displacements.data() );
+}
+
+template < class D >
+void
+MPIManager::communicate_spike_data_Ialltoall( std::vector< D >& send_buffer, std::vector< D >& recv_buffer )
+{
+  const size_t send_recv_count_spike_data_in_int_per_rank =
+    sizeof( SpikeData ) / sizeof( unsigned int ) * send_recv_count_spike_data_per_rank_;
+
+  assert( spike_data_request_ == MPI_REQUEST_NULL );
+  communicate_Ialltoall_( static_cast< void* >( &send_buffer[ 0 ] ),
+    static_cast< void* >( &recv_buffer[ 0 ] ),
+    send_recv_count_spike_data_in_int_per_rank,
+    spike_data_request_ );
+}
+
+template < class D >
+void
+MPIManager::communicate_target_data_Ialltoall( std::vector< D >& send_buffer, std::vector< D >& recv_buffer )
+{
+  const size_t send_recv_count_target_data_in_int_per_rank =
+    sizeof( TargetData ) / sizeof( unsigned int ) * send_recv_count_target_data_per_rank_;
+
+  assert( target_data_request_ == MPI_REQUEST_NULL );
+  communicate_Ialltoall_( static_cast< void* >( &send_buffer[ 0 ] ),
+    static_cast< void* >( &recv_buffer[ 0 ] ),
+    send_recv_count_target_data_in_int_per_rank,
+    target_data_request_ );
+}
+
 template < class D >
 void
 MPIManager::communicate_secondary_events_Alltoallv( std::vector< D >& send_buffer, std::vector< D >& recv_buffer )
@@ -731,6 +845,32 @@ MPIManager::communicate_secondary_events_Alltoallv( std::vector< D >& send_buffe
   recv_buffer.swap( send_buffer );
 }
 
+template < class D >
+void
+MPIManager::communicate_Alltoallv( std::vector< D >& send_buffer,
+  const std::vector< int >&,
+  const std::vector< int >&,
+  std::vector< D >& recv_buffer,
+  const std::vector< int >&,
+  const std::vector< int >& )
+{
+  recv_buffer.swap( send_buffer );
+}
+
+template < class D >
+void
+MPIManager::communicate_spike_data_Ialltoall( std::vector< D >& send_buffer, std::vector< D >& recv_buffer )
+{
+  recv_buffer.swap( send_buffer );
+}
+
+template < class D >
+void
+MPIManager::communicate_target_data_Ialltoall( std::vector< D >& send_buffer, std::vector< D >& recv_buffer )
+{
+  recv_buffer.swap( send_buffer );
+}
+
 #endif /* HAVE_MPI */
 
 template < class D >
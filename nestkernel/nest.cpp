@@ -199,13 +199,27 @@ connect_arrays( long* sources,
   double* weights,
   double* delays,
   std::vector< std::string >& p_keys,
-  double* p_values,
+  std::vector< double* >& p_values,
   size_t n,
   std::string syn_model )
 {
   kernel().connection_manager.connect_arrays( sources, targets, weights, delays, p_keys, p_values, n, syn_model );
 }
 
+void
+save_connectivity( const std::string& filename )
+{
+  kernel().connection_manager.save_connectivity( filename );
+}
+
+void
+load_connectivity( const std::string& filename )
+{
+  kernel().connection_manager.sw_construction_connect.start();
+  kernel().connection_manager.load_connectivity( filename );
+  kernel().connection_manager.sw_construction_connect.stop();
+}
+
 ArrayDatum
 get_connections( const DictionaryDatum& dict )
 {
@@ -219,6 +233,19 @@ get_connections( const DictionaryDatum& dict )
   return array;
 }
 
+DictionaryDatum
+get_connection_columns( const DictionaryDatum& dict, const std::vector< std::string >& parameters )
+{
+  dict->clear_access_flags();
+
+  const std::vector< Name > parameter_names( parameters.begin(), parameters.end() );
+  DictionaryDatum columns = kernel().connection_manager.get_connection_columns( dict, parameter_names );
+
+  ALL_ENTRIES_ACCESSED( *dict, "GetConnectionColumns", "Unread dictionary entries: " );
+
+  return columns;
+}
+
 void
 disconnect( const ArrayDatum& conns )
 {
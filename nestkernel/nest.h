@@ -115,21 +115,46 @@ void connect_tripartite( NodeCollectionPTR sources,
  * nullptr.
  *
  * The p_keys vector contains keys of additional synapse parameters, with
- * associated values in the flat array p_values. If there are n sources and targets,
- * and M additional synapse parameters, p_keys has a size of M, and the p_values array
- * has length of M*n.
+ * associated values in the arrays p_values. If there are n sources and targets,
+ * and M additional synapse parameters, p_keys and p_values have a size of M, and
+ * each array in p_values has length n. The arrays are used in place, without
+ * copying.
  */
 void connect_arrays( long* sources,
   long* targets,
   double* weights,
   double* delays,
   std::vector< std::string >& p_keys,
-  double* p_values,
+  std::vector< double* >& p_values,
   size_t n,
   std::string syn_model );
 
+/**
+ * @brief Write connectivity snapshot
+ *
+ * Each thread on each rank writes its connections to the binary file
+ * `<filename>-<rank>-<thread>.conn`, see ConnectionManager::save_connectivity().
+ */
+void save_connectivity( const std::string& filename );
+
+/**
+ * @brief Restore connections from snapshot written by save_connectivity()
+ *
+ * Nodes must be created as when the snapshot was written, with the same
+ * numbers of ranks and threads, and no connections may exist.
+ */
+void load_connectivity( const std::string& filename );
+
 ArrayDatum get_connections( const DictionaryDatum& dict );
 
+/**
+ * @brief Return selected connections as columns
+ *
+ * The selection dictionary is the same as for get_connections(), see
+ * ConnectionManager::get_connection_columns() for the columns returned.
+ */
+DictionaryDatum get_connection_columns( const DictionaryDatum& dict, const std::vector< std::string >& parameters );
+
 void disconnect( const ArrayDatum& conns );
 
 void simulate( const double& t );
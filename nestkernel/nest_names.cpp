@@ -83,7 +83,9 @@ const Name beta( "beta" );
 const Name beta_1( "beta_1" );
 const Name beta_2( "beta_2" );
 const Name beta_Ca( "beta_Ca" );
+const Name bin_width( "bin_width" );
 const Name biological_time( "biological_time" );
+const Name block_size( "block_size" );
 const Name box( "box" );
 const Name buffer_size( "buffer_size" );
 const Name buffer_size_spike_data( "buffer_size_spike_data" );
@@ -100,11 +102,15 @@ const Name c_3( "c_3" );
 const Name c_reg( "c_reg" );
 const Name capacity( "capacity" );
 const Name center( "center" );
+const Name chunk_size( "chunk_size" );
 const Name circular( "circular" );
 const Name clear( "clear" );
 const Name comp_idx( "comp_idx" );
+const Name compact_synapse_memory_saved( "compact_synapse_memory_saved" );
 const Name comparator( "comparator" );
 const Name compartments( "compartments" );
+const Name compress_source_table( "compress_source_table" );
+const Name compression_level( "compression_level" );
 const Name conc_Mg2( "conc_Mg2" );
 const Name configbit_0( "configbit_0" );
 const Name configbit_1( "configbit_1" );
@@ -147,6 +153,8 @@ const Name dimension( "dimension" );
 const Name distal_curr( "distal_curr" );
 const Name distal_exc( "distal_exc" );
 const Name distal_inh( "distal_inh" );
+const Name downsampling( "downsampling" );
+const Name downsampling_factor( "downsampling_factor" );
 const Name drift_factor( "drift_factor" );
 const Name driver_readout_time( "driver_readout_time" );
 const Name dt( "dt" );
@@ -191,6 +199,7 @@ const Name f_target( "f_target" );
 const Name file_extension( "file_extension" );
 const Name filename( "filename" );
 const Name filenames( "filenames" );
+const Name first_spike_times( "first_spike_times" );
 const Name frequency( "frequency" );
 const Name frozen( "frozen" );
 
@@ -276,6 +285,8 @@ const Name instant_unblock_NMDA( "instant_unblock_NMDA" );
 const Name instantiations( "instantiations" );
 const Name interval( "interval" );
 const Name is_refractory( "is_refractory" );
+const Name isi_cv( "isi_cv" );
+const Name isi_mean( "isi_mean" );
 
 const Name Kd_act( "Kd_act" );
 const Name Kd_IP3_1( "Kd_IP3_1" );
@@ -291,6 +302,7 @@ const Name kernel( "kernel" );
 const Name label( "label" );
 const Name lambda( "lambda" );
 const Name lambda_0( "lambda_0" );
+const Name last_spike_times( "last_spike_times" );
 const Name learning_signal( "learning_signal" );
 const Name len_kernel( "len_kernel" );
 const Name linear( "linear" );
@@ -379,6 +391,7 @@ const Name parent_idx( "parent_idx" );
 const Name phase( "phase" );
 const Name phi_max( "phi_max" );
 const Name pairwise_poisson( "pairwise_poisson" );
+const Name pin_threads( "pin_threads" );
 const Name polar_angle( "polar_angle" );
 const Name polar_axis( "polar_axis" );
 const Name pool_size( "pool_size" );
@@ -472,14 +485,19 @@ const Name source( "source" );
 const Name spherical( "spherical" );
 const Name spike_buffer_grow_extra( "spike_buffer_grow_extra" );
 const Name spike_buffer_resize_log( "spike_buffer_resize_log" );
+const Name spike_counts( "spike_counts" );
 const Name spike_buffer_shrink_limit( "spike_buffer_shrink_limit" );
 const Name spike_buffer_shrink_spare( "spike_buffer_shrink_spare" );
 const Name spike_dependent_threshold( "spike_dependent_threshold" );
+const Name spike_exchange_bytes_saved( "spike_exchange_bytes_saved" );
+const Name spike_exchange_bytes_sent( "spike_exchange_bytes_sent" );
 const Name spike_multiplicities( "spike_multiplicities" );
 const Name spike_times( "spike_times" );
 const Name spike_weights( "spike_weights" );
+const Name spikes_sent_per_slice_histogram( "spikes_sent_per_slice_histogram" );
 const Name start( "start" );
 const Name state( "state" );
+const Name statistics( "statistics" );
 const Name std( "std" );
 const Name std_mod( "std_mod" );
 const Name stimulation_backends( "stimulation_backends" );
@@ -512,6 +530,7 @@ const Name t_ref_remaining( "t_ref_remaining" );
 const Name t_ref_tot( "t_ref_tot" );
 const Name t_spike( "t_spike" );
 const Name target( "target" );
+const Name target_data_exchange_log( "target_data_exchange_log" );
 const Name target_signal( "target_signal" );
 const Name target_thread( "target_thread" );
 const Name targets( "targets" );
@@ -589,7 +608,9 @@ const Name theta_plus( "theta_plus" );
 const Name third_in( "third_in" );
 const Name third_out( "third_out" );
 const Name thread( "thread" );
+const Name thread_cpus( "thread_cpus" );
 const Name thread_local_id( "thread_local_id" );
+const Name thread_numa_nodes( "thread_numa_nodes" );
 const Name threshold( "threshold" );
 const Name threshold_spike( "threshold_spike" );
 const Name threshold_voltage( "threshold_voltage" );
@@ -644,6 +665,13 @@ const Name u_ref_squared( "u_ref_squared" );
 const Name update_time_limit( "update_time_limit" );
 const Name upper_right( "upper_right" );
 const Name use_compressed_spikes( "use_compressed_spikes" );
+const Name use_incremental_connection_update( "use_incremental_connection_update" );
+const Name use_pipelined_spike_exchange( "use_pipelined_spike_exchange" );
+const Name use_pipelined_target_data_exchange( "use_pipelined_target_data_exchange" );
+const Name use_population_update( "use_population_update" );
+const Name use_radix_sort( "use_radix_sort" );
+const Name use_sorted_spike_delivery( "use_sorted_spike_delivery" );
+const Name use_sparse_spike_exchange( "use_sparse_spike_exchange" );
 const Name use_wfr( "use_wfr" );
 
 const Name v( "v" );
@@ -677,6 +705,7 @@ const Name w( "w" );
 const Name weight( "weight" );
 const Name weight_per_lut_entry( "weight_per_lut_entry" );
 const Name weight_recorder( "weight_recorder" );
+const Name weight_scale( "weight_scale" );
 const Name weights( "weights" );
 const Name wfr_comm_interval( "wfr_comm_interval" );
 const Name wfr_interpolation_order( "wfr_interpolation_order" );
@@ -110,7 +110,9 @@ extern const Name beta_1;
 extern const Name beta_2;
 
 extern const Name beta_Ca;
+extern const Name bin_width;
 extern const Name biological_time;
+extern const Name block_size;
 extern const Name box;
 extern const Name buffer_size;
 extern const Name buffer_size_spike_data;
@@ -127,11 +129,15 @@ extern const Name c_3;
 extern const Name c_reg;
 extern const Name capacity;
 extern const Name center;
+extern const Name chunk_size;
 extern const Name circular;
 extern const Name clear;
 extern const Name comp_idx;
+extern const Name compact_synapse_memory_saved;
 extern const Name comparator;
 extern const Name compartments;
+extern const Name compress_source_table;
+extern const Name compression_level;
 extern const Name conc_Mg2;
 extern const Name configbit_0;
 extern const Name configbit_1;
@@ -174,6 +180,8 @@ extern const Name dimension;
 extern const Name distal_curr;
 extern const Name distal_exc;
 extern const Name distal_inh;
+extern const Name downsampling;
+extern const Name downsampling_factor;
 extern const Name drift_factor;
 extern const Name driver_readout_time;
 extern const Name dt;
@@ -219,6 +227,7 @@ extern const Name f_target;
 extern const Name file_extension;
 extern const Name filename;
 extern const Name filenames;
+extern const Name first_spike_times;
 extern const Name frequency;
 extern const Name frozen;
 
@@ -304,6 +313,8 @@ extern const Name instant_unblock_NMDA;
 extern const Name instantiations;
 extern const Name interval;
 extern const Name is_refractory;
+extern const Name isi_cv;
+extern const Name isi_mean;
 
 extern const Name Kd_act;
 extern const Name Kd_IP3_1;
@@ -319,6 +330,7 @@ extern const Name kernel;
 extern const Name label;
 extern const Name lambda;
 extern const Name lambda_0;
+extern const Name last_spike_times;
 extern const Name learning_signal;
 extern const Name len_kernel;
 extern const Name linear;
@@ -407,6 +419,7 @@ extern const Name parent_idx;
 extern const Name phase;
 extern const Name phi_max;
 extern const Name pairwise_poisson;
+extern const Name pin_threads;
 extern const Name polar_angle;
 extern const Name polar_axis;
 extern const Name pool_size;
@@ -500,14 +513,19 @@ extern const Name source;
 extern const Name spherical;
 extern const Name spike_buffer_grow_extra;
 extern const Name spike_buffer_resize_log;
+extern const Name spike_counts;
 extern const Name spike_buffer_shrink_limit;
 extern const Name spike_buffer_shrink_spare;
 extern const Name spike_dependent_threshold;
+extern const Name spike_exchange_bytes_saved;
+extern const Name spike_exchange_bytes_sent;
 extern const Name spike_multiplicities;
 extern const Name spike_times;
 extern const Name spike_weights;
+extern const Name spikes_sent_per_slice_histogram;
 extern const Name start;
 extern const Name state;
+extern const Name statistics;
 extern const Name std;
 extern const Name std_mod;
 extern const Name stimulation_backends;
@@ -540,6 +558,7 @@ extern const Name t_ref_remaining;
 extern const Name t_ref_tot;
 extern const Name t_spike;
 extern const Name target;
+extern const Name target_data_exchange_log;
 extern const Name target_signal;
 extern const Name target_thread;
 extern const Name targets;
@@ -617,7 +636,9 @@ extern const Name theta_plus;
 extern const Name third_in;
 extern const Name third_out;
 extern const Name thread;
+extern const Name thread_cpus;
 extern const Name thread_local_id;
+extern const Name thread_numa_nodes;
 extern const Name threshold;
 extern const Name threshold_spike;
 extern const Name threshold_voltage;
@@ -672,6 +693,13 @@ extern const Name u_ref_squared;
 extern const Name update_time_limit;
 extern const Name upper_right;
 extern const Name use_compressed_spikes;
+extern const Name use_incremental_connection_update;
+extern const Name use_pipelined_spike_exchange;
+extern const Name use_pipelined_target_data_exchange;
+extern const Name use_population_update;
+extern const Name use_radix_sort;
+extern const Name use_sorted_spike_delivery;
+extern const Name use_sparse_spike_exchange;
 extern const Name use_wfr;
 
 extern const Name v;
@@ -705,6 +733,7 @@ extern const Name w;
 extern const Name weight;
 extern const Name weight_per_lut_entry;
 extern const Name weight_recorder;
+extern const Name weight_scale;
 extern const Name weights;
 extern const Name wfr_comm_interval;
 extern const Name wfr_interpolation_order;
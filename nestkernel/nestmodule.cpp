@@ -583,6 +583,40 @@ NestModule::GetConnections_DFunction::execute( SLIInterpreter* i ) const
   i->EStack.pop();
 }
 
+/** @BeginDocumentation
+   Name: GetConnectionColumns - Return connections as columns.
+   Description:
+   Selects connections with the same dictionary as GetConnections, but
+   returns a dictionary of vectors instead of an array of connection IDs.
+   The vectors source, target, target_thread, synapse_modelid and port are
+   always included, and one double vector is added for each of the synapse
+   parameters given in the array. Only connections with targets on the
+   local MPI process are returned.
+   Synopsis:
+   dict [/weight /delay] GetConnectionColumns -> dict
+   SeeAlso: GetConnections
+*/
+void
+NestModule::GetConnectionColumns_D_aFunction::execute( SLIInterpreter* i ) const
+{
+  i->assert_stack_load( 2 );
+
+  DictionaryDatum dict = getValue< DictionaryDatum >( i->OStack.pick( 1 ) );
+  const ArrayDatum parameter_array = getValue< ArrayDatum >( i->OStack.pick( 0 ) );
+
+  std::vector< std::string > parameters;
+  for ( size_t n = 0; n < parameter_array.size(); ++n )
+  {
+    parameters.push_back( getValue< std::string >( parameter_array.get( n ) ) );
+  }
+
+  DictionaryDatum columns = get_connection_columns( dict, parameters );
+
+  i->OStack.pop( 2 );
+  i->OStack.push( columns );
+  i->EStack.pop();
+}
+
 void
 NestModule::SimulateFunction::execute( SLIInterpreter* i ) const
 {
@@ -826,6 +860,54 @@ NestModule::ConnectSonata_D_Function::execute( SLIInterpreter* i ) const
   kernel().connection_manager.sw_construction_connect.stop();
 }
 
+/** @BeginDocumentation
+   Name: SaveConnectivity - Write connectivity snapshot.
+   Description:
+   Each thread on each rank writes the connections it stores to the binary
+   file filename-rank-thread.conn. Connections from and to devices are not
+   included. The source table must still be available, i.e., connectivity
+   can only be saved after simulating if keep_source_table is true. After
+   simulating, all connections must use static synapse models, since the
+   state of other synapse models, e.g. t_lastspike, refers to the simulation
+   time. The state of the nodes is not saved.
+   Synopsis:
+   (filename) SaveConnectivity -> -
+   SeeAlso: LoadConnectivity
+*/
+void
+NestModule::SaveConnectivity_sFunction::execute( SLIInterpreter* i ) const
+{
+  i->assert_stack_load( 1 );
+
+  const std::string filename = getValue< std::string >( i->OStack.pick( 0 ) );
+  save_connectivity( filename );
+
+  i->OStack.pop();
+  i->EStack.pop();
+}
+
+/** @BeginDocumentation
+   Name: LoadConnectivity - Restore connections from connectivity snapshot.
+   Description:
+   Restores the connections written by SaveConnectivity. Nodes must have been
+   created exactly as when the snapshot was written, with the same numbers of
+   ranks and threads and the same resolution, and no connections may exist.
+   Synopsis:
+   (filename) LoadConnectivity -> -
+   SeeAlso: SaveConnectivity
+*/
+void
+NestModule::LoadConnectivity_sFunction::execute( SLIInterpreter* i ) const
+{
+  i->assert_stack_load( 1 );
+
+  const std::string filename = getValue< std::string >( i->OStack.pick( 0 ) );
+  load_connectivity( filename );
+
+  i->OStack.pop();
+  i->EStack.pop();
+}
+
 /** @BeginDocumentation
    Name: MemoryInfo - Report current memory usage.
    Description:
@@ -2070,6 +2152,7 @@ NestModule::init( SLIInterpreter* i )
   i->createcommand( "GetKernelStatus", &getkernelstatus_function );
 
   i->createcommand( "GetConnections_D", &getconnections_Dfunction );
+  i->createcommand( "GetConnectionColumns", &getconnectioncolumns_D_afunction );
   i->createcommand( "cva_C", &cva_cfunction );
 
   i->createcommand( "Simulate_d", &simulatefunction );
@@ -2118,6 +2201,8 @@ NestModule::init( SLIInterpreter* i )
   i->createcommand( "Connect_g_g_D_a", &connect_g_g_D_afunction );
   i->createcommand( "ConnectSonata_D", &ConnectSonata_D_Function );
   i->createcommand( "ConnectTripartite_g_g_g_D_D_D", &connect_tripartite_g_g_g_D_D_Dfunction );
+  i->createcommand( "SaveConnectivity", &saveconnectivity_sfunction );
+  i->createcommand( "LoadConnectivity", &loadconnectivity_sfunction );
 
   i->createcommand( "ResetKernel", &resetkernelfunction );
 
@@ -404,6 +404,12 @@ public:
     void execute( SLIInterpreter* ) const override;
   } getconnections_Dfunction;
 
+  class GetConnectionColumns_D_aFunction : public SLIFunction
+  {
+  public:
+    void execute( SLIInterpreter* ) const override;
+  } getconnectioncolumns_D_afunction;
+
   /** @BeginDocumentation
    *   Name: Simulate - simulate n milliseconds
    *
@@ -560,6 +566,18 @@ public:
     void execute( SLIInterpreter* ) const override;
   } connect_tripartite_g_g_g_D_D_Dfunction;
 
+  class SaveConnectivity_sFunction : public SLIFunction
+  {
+  public:
+    void execute( SLIInterpreter* ) const override;
+  } saveconnectivity_sfunction;
+
+  class LoadConnectivity_sFunction : public SLIFunction
+  {
+  public:
+    void execute( SLIInterpreter* ) const override;
+  } loadconnectivity_sfunction;
+
   class ResetKernelFunction : public SLIFunction
   {
   public:
@@ -29,6 +29,7 @@
 // Includes from nestkernel:
 #include "exceptions.h"
 #include "kernel_manager.h"
+#include "population_kernel.h"
 
 // Includes from sli:
 #include "arraydatum.h"
@@ -197,6 +198,18 @@ Node::wfr_update( Time const&, const long, const long )
   throw UnexpectedEvent( "Waveform relaxation not supported." );
 }
 
+std::unique_ptr< PopulationKernel >
+Node::create_population_kernel() const
+{
+  return nullptr;
+}
+
+bool
+Node::get_spike_input_buffer( SpikeInputBuffer& )
+{
+  return false;
+}
+
 /**
  * Default implementation of check_connection just throws IllegalConnection
  */
@@ -26,6 +26,7 @@
 // C++ includes:
 #include <bitset>
 #include <deque>
+#include <memory>
 #include <sstream>
 #include <string>
 #include <utility>
@@ -51,8 +52,26 @@ namespace nest
 {
 class Model;
 class ArchivingNode;
+class PopulationKernel;
 class TimeConverter;
 
+/**
+ * Location of the spike input of a node in its ring buffer.
+ *
+ * Spikes arriving in ring buffer slot s are added to bins[ s * stride +
+ * channel ], where the channel is the excitatory channel for positive weights
+ * and the inhibitory channel otherwise. Static synapses write directly into
+ * this memory instead of calling Node::handle( SpikeEvent& ).
+ *
+ * @see Node::get_spike_input_buffer()
+ */
+struct SpikeInputBuffer
+{
+  double* bins;
+  size_t stride;
+  size_t excitatory_channel;
+  size_t inhibitory_channel;
+};
 
 /**
  * @defgroup user_interface Model developer interface.
@@ -295,6 +314,32 @@ public:
    */
   virtual void update( Time const&, const long, const long ) = 0;
 
+  /**
+   * Create a kernel updating a run of consecutive nodes of this model in
+   * a single batched call.
+   *
+   * Only used if the kernel property use_population_update is set. The
+   * returned kernel is empty; the node must be added to it explicitly.
+   *
+   * @returns nullptr if the model does not support population updates
+   * @see PopulationKernel
+   */
+  virtual std::unique_ptr< PopulationKernel > create_population_kernel() const;
+
+  /**
+   * Describe the ring buffer into which handle( SpikeEvent& ) adds spikes.
+   *
+   * Models may only provide their buffer if handle( SpikeEvent& ) does
+   * nothing but add weight times multiplicity to the ring buffer slot of
+   * the arrival time. The buffer is registered with the kernel in
+   * SimulationManager::prepare() and must not be reallocated before the
+   * next call to prepare().
+   *
+   * @returns false if spikes must be delivered by handle( SpikeEvent& )
+   * @see SpikeInputBuffer
+   */
+  virtual bool get_spike_input_buffer( SpikeInputBuffer& );
+
   /**
    * Bring the node from state $t$ to $t+n*dt$, sends SecondaryEvents
    * (e.g. GapJunctionEvent) and resets state variables to values at $t$.
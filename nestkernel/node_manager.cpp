@@ -72,6 +72,10 @@ NodeManager::initialize( const bool adjust_number_of_threads_or_rng_only )
   wfr_network_size_ = 0;
   local_nodes_.resize( kernel().vp_manager.get_num_threads() );
   num_thread_local_devices_.resize( kernel().vp_manager.get_num_threads(), 0 );
+  population_kernels_.clear();
+  population_kernels_.resize( kernel().vp_manager.get_num_threads() );
+  update_schedules_.clear();
+  update_schedules_.resize( kernel().vp_manager.get_num_threads() );
   ensure_valid_thread_local_ids();
 
   if ( not adjust_number_of_threads_or_rng_only )
@@ -83,6 +87,8 @@ NodeManager::initialize( const bool adjust_number_of_threads_or_rng_only )
 void
 NodeManager::finalize( const bool )
 {
+  population_kernels_.clear();
+  update_schedules_.clear();
   destruct_nodes_();
   clear_node_collection_container();
 }
@@ -697,6 +703,79 @@ NodeManager::prepare_nodes()
   LOG( M_INFO, "NodeManager::prepare_nodes", os.str() );
 }
 
+void
+NodeManager::prepare_population_update()
+{
+  size_t num_population_nodes = 0;
+  size_t num_population_kernels = 0;
+
+#pragma omp parallel reduction( + : num_population_nodes, num_population_kernels )
+  {
+    const size_t t = kernel().vp_manager.get_thread_id();
+
+    population_kernels_[ t ].clear();
+    update_schedules_[ t ].clear();
+
+    // Consecutive nodes are collected into the same kernel until a node is
+    // rejected; each rejected node starts a new kernel if its model provides
+    // one. The schedule thus preserves the order of thread-local nodes.
+    PopulationKernel* current = nullptr;
+    for ( SparseNodeArray::const_iterator it = local_nodes_[ t ].begin(); it != local_nodes_[ t ].end(); ++it )
+    {
+      Node* node = it->get_node();
+      if ( node->is_frozen() )
+      {
+        continue;
+      }
+
+      if ( current and current->add_node( *node ) )
+      {
+        continue;
+      }
+
+      std::unique_ptr< PopulationKernel > population = node->create_population_kernel();
+      if ( population and population->add_node( *node ) )
+      {
+        current = population.get();
+        population_kernels_[ t ].push_back( std::move( population ) );
+        update_schedules_[ t ].push_back( { current, nullptr } );
+      }
+      else
+      {
+        current = nullptr;
+        update_schedules_[ t ].push_back( { nullptr, node } );
+      }
+    }
+
+    for ( auto& population : population_kernels_[ t ] )
+    {
+      population->load_state();
+      num_population_nodes += population->size();
+    }
+    num_population_kernels += population_kernels_[ t ].size();
+  } // omp parallel
+
+  LOG( M_INFO,
+    "NodeManager::prepare_population_update",
+    String::compose(
+      "Updating %1 nodes in %2 population kernels.", num_population_nodes, num_population_kernels ) );
+}
+
+void
+NodeManager::finalize_population_update()
+{
+#pragma omp parallel
+  {
+    const size_t t = kernel().vp_manager.get_thread_id();
+    for ( auto& population : population_kernels_[ t ] )
+    {
+      population->store_state();
+    }
+    population_kernels_[ t ].clear();
+    update_schedules_[ t ].clear();
+  } // omp parallel
+}
+
 void
 NodeManager::post_run_cleanup()
 {
@@ -24,6 +24,7 @@
 #define NODE_MANAGER_H
 
 // C++ includes:
+#include <memory>
 #include <vector>
 
 // Includes from libnestutil:
@@ -34,6 +35,7 @@
 #include "conn_builder.h"
 #include "nest_types.h"
 #include "node_collection.h"
+#include "population_kernel.h"
 #include "sparse_node_array.h"
 
 // Includes from sli:
@@ -221,6 +223,28 @@ public:
    */
   void finalize_nodes();
 
+  /**
+   * Group thread-local nodes into population kernels and load their state.
+   *
+   * Builds the per-thread update schedule used by the SimulationManager if
+   * the kernel property use_population_update is set. Must be called at the
+   * beginning of each run.
+   */
+  void prepare_population_update();
+
+  /**
+   * Write state from population kernels back to nodes and release kernels.
+   *
+   * Must be called at the end of each run prepared by
+   * prepare_population_update().
+   */
+  void finalize_population_update();
+
+  /**
+   * Return update schedule of thread t built by prepare_population_update().
+   */
+  const std::vector< UpdateScheduleEntry >& get_update_schedule( size_t t ) const;
+
   /**
    * Returns whether any node uses waveform relaxation
    */
@@ -349,6 +373,12 @@ private:
 
   std::vector< size_t > num_thread_local_devices_; //!< stores number of thread local devices
 
+  //! Population kernels per thread, only populated during a run
+  std::vector< std::vector< std::unique_ptr< PopulationKernel > > > population_kernels_;
+
+  //! Order in which population kernels and individual nodes are updated, per thread
+  std::vector< std::vector< UpdateScheduleEntry > > update_schedules_;
+
   bool have_nodes_changed_; //!< true if new nodes have been created
                             //!< since startup or last call to simulate
 
@@ -377,6 +407,12 @@ NodeManager::get_wfr_nodes_on_thread( size_t t ) const
   return wfr_nodes_vec_.at( t );
 }
 
+inline const std::vector< UpdateScheduleEntry >&
+NodeManager::get_update_schedule( size_t t ) const
+{
+  return update_schedules_[ t ];
+}
+
 inline bool
 NodeManager::wfr_is_used() const
 {
@@ -0,0 +1,144 @@
+/*
+ *  population_kernel.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef POPULATION_KERNEL_H
+#define POPULATION_KERNEL_H
+
+// C++ includes:
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+// Includes from nestkernel:
+#include "nest_time.h"
+#include "nest_types.h"
+
+namespace nest
+{
+class Node;
+
+/**
+ * Batched update of a run of consecutive thread-local nodes of one model.
+ *
+ * If the kernel property use_population_update is set, the NodeManager
+ * groups the thread-local nodes of each thread into population kernels
+ * at the beginning of every call to SimulationManager::run(). A kernel
+ * copies the state of its member nodes into structure-of-arrays storage in
+ * load_state(), advances all members in one call to update() per time
+ * slice and writes the state back to the nodes in store_state() at the
+ * end of the run. Between runs, nodes thus always hold their current
+ * state, so that GetStatus and SetStatus work as usual.
+ *
+ * Models support population kernels by overriding
+ * Node::create_population_kernel(). A kernel may reject nodes in
+ * add_node() whose configuration it cannot handle (e.g., nodes connected
+ * to a multimeter); these nodes are updated individually.
+ */
+class PopulationKernel
+{
+public:
+  virtual ~PopulationKernel() = default;
+
+  /**
+   * Append node to the population.
+   *
+   * @returns false if the node cannot be updated by this kernel, in which
+   * case the kernel is left unchanged.
+   */
+  virtual bool add_node( Node& ) = 0;
+
+  //! Number of nodes updated by the kernel
+  virtual size_t size() const = 0;
+
+  //! Copy state, parameters and internal variables from the member nodes
+  virtual void load_state() = 0;
+
+  //! Write state back to the member nodes
+  virtual void store_state() = 0;
+
+  /**
+   * Bring all member nodes from time origin+from to origin+to.
+   *
+   * Semantics are those of Node::update(); in particular, spikes are sent
+   * in the same order as if member nodes were updated one after the other.
+   */
+  virtual void update( Time const& origin, const long from, const long to ) = 0;
+};
+
+/**
+ * Entry in the per-thread update schedule.
+ *
+ * Exactly one of the two pointers is set: either the entry updates a
+ * population kernel or a single node.
+ */
+struct UpdateScheduleEntry
+{
+  PopulationKernel* population;
+  Node* node;
+};
+
+/**
+ * Base class for population kernels of a concrete node type.
+ *
+ * Provides storage of member nodes and collects spikes emitted during
+ * update() so that they can be sent in node-major order afterwards.
+ */
+template < typename NodeT >
+class GenericPopulationKernel : public PopulationKernel
+{
+public:
+  size_t
+  size() const override
+  {
+    return nodes_.size();
+  }
+
+protected:
+  /**
+   * Mark spike emitted by member node at index idx in step lag.
+   */
+  void
+  register_spike_( const size_t idx, const long lag )
+  {
+    spikes_.emplace_back( idx, lag );
+  }
+
+  /**
+   * Send all spikes registered during the current update().
+   *
+   * Spikes are registered step by step, but a node updated individually
+   * emits all spikes of a slice before the next node is updated. To
+   * preserve the order of spike events, spikes are sorted by node
+   * before they are sent.
+   */
+  void send_spikes_( Time const& origin );
+
+  std::vector< NodeT* > nodes_;
+
+private:
+  //! Index of spiking node and lag of spike
+  std::vector< std::pair< size_t, long > > spikes_;
+};
+
+} // namespace nest
+
+#endif /* POPULATION_KERNEL_H */
@@ -0,0 +1,64 @@
+/*
+ *  population_kernel_impl.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef POPULATION_KERNEL_IMPL_H
+#define POPULATION_KERNEL_IMPL_H
+
+#include "population_kernel.h"
+
+// C++ includes:
+#include <algorithm>
+
+// Includes from nestkernel:
+#include "event_delivery_manager_impl.h"
+#include "kernel_manager.h"
+
+namespace nest
+{
+
+template < typename NodeT >
+void
+GenericPopulationKernel< NodeT >::send_spikes_( Time const& origin )
+{
+  if ( spikes_.empty() )
+  {
+    return;
+  }
+
+  // pairs are ordered by node index first and by lag second
+  std::sort( spikes_.begin(), spikes_.end() );
+
+  for ( const auto& spike : spikes_ )
+  {
+    NodeT& node = *nodes_[ spike.first ];
+    const long lag = spike.second;
+
+    node.set_spiketime( Time::step( origin.get_steps() + lag + 1 ) );
+    SpikeEvent se;
+    kernel().event_delivery_manager.send( node, se, lag );
+  }
+  spikes_.clear();
+}
+
+} // namespace nest
+
+#endif /* POPULATION_KERNEL_IMPL_H */
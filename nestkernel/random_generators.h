@@ -25,6 +25,9 @@
 
 // C++ includes:
 #include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
 #include <initializer_list>
 #include <iterator>
 #include <memory>
@@ -412,6 +415,202 @@ private:
   DistributionT distribution_; //!< Wrapped RandomDistribution
 };
 
+
+/**
+ * @brief Counter-based random number stream.
+ *
+ * The stream is fully determined by its key, so that independent processes
+ * and threads obtain identical numbers for the same key without sharing or
+ * synchronizing state. Creating a stream is cheap, which allows one stream per
+ * source neuron and decision, e.g., in FixedOutDegreeBuilder. The generator is
+ * SplitMix64 (Steele et al, OOPSLA 2014), which passes BigCrush.
+ *
+ * The stream does not provide the C++ RNG engine interface used by
+ * BaseRandomGenerator and must not replace the kernel's generators for
+ * general use.
+ */
+class CounterBasedRandomStream
+{
+public:
+  explicit CounterBasedRandomStream( std::initializer_list< std::uint64_t > key )
+    : state_( 0 )
+  {
+    for ( const auto k : key )
+    {
+      state_ = mix_( state_ ^ mix_( k + GOLDEN_GAMMA_ ) );
+    }
+  }
+
+  //! Next 64-bit random number
+  std::uint64_t
+  next()
+  {
+    state_ += GOLDEN_GAMMA_;
+    return mix_( state_ );
+  }
+
+  //! Random number uniformly distributed in [0, 1)
+  double
+  drand()
+  {
+    return ( next() >> 11 ) * ( 1.0 / 9007199254740992.0 );
+  }
+
+  /**
+   * @brief Number of successes in n Bernoulli trials with success probability p.
+   */
+  size_t binomial( const size_t n, const double p );
+
+  /**
+   * @brief Number of successes when drawing without replacement.
+   *
+   * @param draws Number of items drawn
+   * @param successes Number of items in population counting as success
+   * @param population Number of items in population
+   */
+  size_t hypergeometric( const size_t draws, const size_t successes, const size_t population );
+
+private:
+  static constexpr std::uint64_t GOLDEN_GAMMA_ = 0x9e3779b97f4a7c15ULL;
+
+  static std::uint64_t
+  mix_( std::uint64_t z )
+  {
+    z = ( z ^ ( z >> 30 ) ) * 0xbf58476d1ce4e5b9ULL;
+    z = ( z ^ ( z >> 27 ) ) * 0x94d049bb133111ebULL;
+    return z ^ ( z >> 31 );
+  }
+
+  /**
+   * @brief Sample from discrete distribution by inversion, searching outwards from the mode.
+   *
+   * The expected number of steps is of the order of the standard deviation.
+   *
+   * @param first Smallest value with non-zero probability
+   * @param last Largest value with non-zero probability
+   * @param mode Mode of the distribution
+   * @param p_mode Probability of the mode
+   * @param ratio_up ratio_up( k ) returns P(k+1) / P(k)
+   * @param ratio_down ratio_down( k ) returns P(k-1) / P(k)
+   */
+  template < typename RatioUp, typename RatioDown >
+  size_t invert_from_mode_( const size_t first,
+    const size_t last,
+    const size_t mode,
+    const double p_mode,
+    RatioUp ratio_up,
+    RatioDown ratio_down );
+
+  std::uint64_t state_;
+};
+
+template < typename RatioUp, typename RatioDown >
+inline size_t
+CounterBasedRandomStream::invert_from_mode_( const size_t first,
+  const size_t last,
+  const size_t mode,
+  const double p_mode,
+  RatioUp ratio_up,
+  RatioDown ratio_down )
+{
+  double u = drand();
+  if ( u < p_mode )
+  {
+    return mode;
+  }
+  u -= p_mode;
+
+  size_t up = mode;
+  size_t down = mode;
+  double p_up = p_mode;
+  double p_down = p_mode;
+  while ( up < last or down > first )
+  {
+    if ( up < last )
+    {
+      p_up *= ratio_up( up );
+      ++up;
+      if ( u < p_up )
+      {
+        return up;
+      }
+      u -= p_up;
+    }
+    if ( down > first )
+    {
+      p_down *= ratio_down( down );
+      --down;
+      if ( u < p_down )
+      {
+        return down;
+      }
+      u -= p_down;
+    }
+  }
+
+  // only reached if rounding errors sum up to more than u
+  return mode;
+}
+
+inline size_t
+CounterBasedRandomStream::binomial( const size_t n, const double p )
+{
+  if ( n == 0 or p <= 0 )
+  {
+    return 0;
+  }
+  if ( p >= 1 )
+  {
+    return n;
+  }
+
+  const double q = 1 - p;
+  const size_t mode = std::min( n, static_cast< size_t >( ( n + 1 ) * p ) );
+  const double log_p_mode = std::lgamma( n + 1.0 ) - std::lgamma( mode + 1.0 ) - std::lgamma( n - mode + 1.0 )
+    + mode * std::log( p ) + ( n - mode ) * std::log( q );
+
+  return invert_from_mode_(
+    0,
+    n,
+    mode,
+    std::exp( log_p_mode ),
+    [ n, p, q ]( const size_t k ) { return ( n - k ) * p / ( ( k + 1 ) * q ); },
+    [ n, p, q ]( const size_t k ) { return k * q / ( ( n - k + 1 ) * p ); } );
+}
+
+inline size_t
+CounterBasedRandomStream::hypergeometric( const size_t draws, const size_t successes, const size_t population )
+{
+  assert( draws <= population and successes <= population );
+
+  const size_t failures = population - successes;
+  const size_t first = draws > failures ? draws - failures : 0;
+  const size_t last = std::min( draws, successes );
+  if ( first == last )
+  {
+    return first;
+  }
+
+  const size_t mode = std::min(
+    last, std::max( first, static_cast< size_t >( ( draws + 1.0 ) * ( successes + 1.0 ) / ( population + 2.0 ) ) ) );
+  const auto log_binomial_coefficient = []( const double n, const double k )
+  { return std::lgamma( n + 1 ) - std::lgamma( k + 1 ) - std::lgamma( n - k + 1 ); };
+  const double log_p_mode = log_binomial_coefficient( successes, mode )
+    + log_binomial_coefficient( failures, draws - mode ) - log_binomial_coefficient( population, draws );
+
+  // Compute ratios in double to avoid overflow of size_t products
+  const double n = draws;
+  const double K = successes;
+  const double F = failures;
+  return invert_from_mode_(
+    first,
+    last,
+    mode,
+    std::exp( log_p_mode ),
+    [ n, K, F ]( const double k ) { return ( K - k ) * ( n - k ) / ( ( k + 1 ) * ( F - n + k + 1 ) ); },
+    [ n, K, F ]( const double k ) { return k * ( F - n + k ) / ( ( K - k + 1 ) * ( n - k + 1 ) ); } );
+}
+
 } // namespace nest
 
 #endif /* #ifndef RANDOM_GENERATORS_H */
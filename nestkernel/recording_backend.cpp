@@ -22,7 +22,45 @@
 
 #include "recording_backend.h"
 
+// C++ includes:
+#include <algorithm>
+
+// Includes from nestkernel:
+#include "event.h"
+
 const std::vector< Name > nest::RecordingBackend::NO_DOUBLE_VALUE_NAMES;
 const std::vector< Name > nest::RecordingBackend::NO_LONG_VALUE_NAMES;
 const std::vector< double > nest::RecordingBackend::NO_DOUBLE_VALUES;
 const std::vector< long > nest::RecordingBackend::NO_LONG_VALUES;
+
+void
+nest::RecordingBackend::write_samples( const RecordingDevice& device,
+  const std::vector< Time >& times,
+  const std::vector< size_t >& senders,
+  const std::vector< double >& values )
+{
+  if ( times.empty() or senders.empty() )
+  {
+    return;
+  }
+
+  const size_t num_values = values.size() / ( times.size() * senders.size() );
+
+  // The reply only serves as carrier of sender and time stamp of each sample
+  const DataLoggingReply::Container no_info;
+  DataLoggingReply reply( no_info );
+  std::vector< double > sample( num_values );
+
+  auto value = values.begin();
+  for ( const auto& time : times )
+  {
+    reply.set_stamp( time );
+    for ( const auto sender : senders )
+    {
+      reply.set_sender_node_id( sender );
+      std::copy( value, value + num_values, sample.begin() );
+      value += num_values;
+      write( device, reply, sample, NO_LONG_VALUES );
+    }
+  }
+}
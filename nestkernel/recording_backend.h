@@ -26,6 +26,9 @@
 // C++ includes:
 #include <vector>
 
+// Includes from nestkernel:
+#include "nest_time.h"
+
 // Includes from sli:
 #include "dictdatum.h"
 #include "name.h"
@@ -236,6 +239,32 @@ public:
     const std::vector< double >& double_values,
     const std::vector< long >& long_values ) = 0;
 
+  /**
+   * Write a block of samples taken from several nodes at several times.
+   *
+   * This function is used by the multimeter to hand all samples of a
+   * time slice to the backend at once. The samples are stored in @p
+   * values in the order time × sender × value, i.e., the values
+   * sampled from `senders[ j ]` at `times[ i ]` start at index
+   * `( i * senders.size() + j ) * n`, with `n` being the number of
+   * double value names set for the device by set_value_names().
+   *
+   * The default implementation calls write() for each sample.
+   * Backends can override it to store the block more efficiently.
+   *
+   * @param device the RecordingDevice, backend-specific channel to write to
+   * @param times the time stamps of the samples
+   * @param senders the node IDs of the sampled nodes
+   * @param values the sampled values
+   *
+   * @see write()
+   *
+   */
+  virtual void write_samples( const RecordingDevice& device,
+    const std::vector< Time >& times,
+    const std::vector< size_t >& senders,
+    const std::vector< double >& values );
+
   /**
    * Set the status of the recording backend using the key-value pairs
    * contained in the params dictionary.
@@ -0,0 +1,672 @@
+/*
+ *  recording_backend_binary.cpp
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+// C++ includes:
+#include <cmath>
+#include <iomanip>
+#include <sstream>
+
+// Generated includes:
+#include "config.h"
+
+// Includes from libnestutil:
+#include "compose.hpp"
+
+// Includes from nestkernel:
+#include "recording_device.h"
+#include "vp_manager_impl.h"
+
+// includes from sli:
+#include "dictutils.h"
+
+#include "recording_backend_binary.h"
+
+const unsigned int nest::RecordingBackendBinary::BINARY_REC_BACKEND_VERSION = 1;
+
+namespace
+{
+
+const char binary_magic[ 8 ] = { 'N', 'E', 'S', 'T', 'B', 'I', 'N', '\0' };
+const uint32_t binary_byte_order_mark = 0x01020304;
+
+template < typename T >
+inline void
+write_value( std::ofstream& out, const T value )
+{
+  out.write( reinterpret_cast< const char* >( &value ), sizeof( T ) );
+}
+
+inline void
+write_string( std::ofstream& out, const std::string& s )
+{
+  write_value< uint64_t >( out, s.size() );
+  out.write( s.data(), s.size() );
+}
+
+template < typename T >
+inline void
+write_column( std::ofstream& out, const T* column, const size_t n )
+{
+  out.write( reinterpret_cast< const char* >( column ), n * sizeof( T ) );
+}
+
+} // namespace
+
+nest::RecordingBackendBinary::RecordingBackendBinary()
+  : writer_busy_( false )
+  , stop_writer_( false )
+  , write_error_( false )
+{
+}
+
+nest::RecordingBackendBinary::~RecordingBackendBinary() throw()
+{
+  close_file_();
+}
+
+void
+nest::RecordingBackendBinary::initialize()
+{
+  data_map tmp( kernel().vp_manager.get_num_threads() );
+  device_data_.swap( tmp );
+}
+
+void
+nest::RecordingBackendBinary::finalize()
+{
+  close_file_();
+}
+
+void
+nest::RecordingBackendBinary::enroll( const RecordingDevice& device, const DictionaryDatum& params )
+{
+  const size_t t = device.get_thread();
+  const size_t node_id = device.get_node_id();
+
+  data_map::value_type::iterator device_data = device_data_[ t ].find( node_id );
+  if ( device_data == device_data_[ t ].end() )
+  {
+    auto p = device_data_[ t ].insert( std::make_pair( node_id, DeviceData( device.get_name() ) ) );
+    device_data = p.first;
+  }
+
+  device_data->second.set_status( params );
+}
+
+void
+nest::RecordingBackendBinary::disenroll( const RecordingDevice& device )
+{
+  const size_t t = device.get_thread();
+  const size_t node_id = device.get_node_id();
+
+  data_map::value_type::iterator device_data = device_data_[ t ].find( node_id );
+  if ( device_data != device_data_[ t ].end() )
+  {
+    device_data_[ t ].erase( device_data );
+  }
+}
+
+void
+nest::RecordingBackendBinary::set_value_names( const RecordingDevice& device,
+  const std::vector< Name >& double_value_names,
+  const std::vector< Name >& long_value_names )
+{
+  const size_t t = device.get_thread();
+  const size_t node_id = device.get_node_id();
+
+  data_map::value_type::iterator device_data = device_data_[ t ].find( node_id );
+  assert( device_data != device_data_[ t ].end() );
+  device_data->second.set_value_names( double_value_names, long_value_names );
+}
+
+void
+nest::RecordingBackendBinary::prepare()
+{
+  size_t num_enrolled_devices = 0;
+  for ( const auto& inner : device_data_ )
+  {
+    num_enrolled_devices += inner.size();
+  }
+
+  // Only create a file if devices record to this backend on this rank
+  if ( num_enrolled_devices > 0 )
+  {
+    open_file_();
+  }
+}
+
+void
+nest::RecordingBackendBinary::cleanup()
+{
+  close_file_();
+}
+
+void
+nest::RecordingBackendBinary::pre_run_hook()
+{
+  if ( not file_.is_open() )
+  {
+    return;
+  }
+
+  // The writer thread is idle between runs, so the file can be written here
+  wait_for_writer_();
+
+  for ( auto& inner : device_data_ )
+  {
+    for ( auto& device_data : inner )
+    {
+      if ( not device_data.second.described_ )
+      {
+        device_data.second.write_info( file_, device_data.first );
+        device_data.second.described_ = true;
+      }
+    }
+  }
+}
+
+void
+nest::RecordingBackendBinary::post_run_hook()
+{
+  if ( not file_.is_open() )
+  {
+    return;
+  }
+
+  for ( auto& inner : device_data_ )
+  {
+    for ( auto& device_data : inner )
+    {
+      std::unique_ptr< Block >& block = device_data.second.block_;
+      if ( block and block->size > 0 )
+      {
+        submit_block_( std::move( block ) );
+      }
+    }
+  }
+
+  wait_for_writer_();
+  file_.flush();
+  check_write_error_();
+}
+
+void
+nest::RecordingBackendBinary::post_step_hook()
+{
+  // nothing to do
+}
+
+void
+nest::RecordingBackendBinary::write( const RecordingDevice& device,
+  const Event& event,
+  const std::vector< double >& double_values,
+  const std::vector< long >& long_values )
+{
+  const size_t t = device.get_thread();
+  const size_t node_id = device.get_node_id();
+
+  data_map::value_type::iterator device_data = device_data_[ t ].find( node_id );
+  if ( device_data == device_data_[ t ].end() or not file_.is_open() )
+  {
+    return;
+  }
+
+  std::unique_ptr< Block >& block = device_data->second.block_;
+  if ( not block )
+  {
+    block = get_block_( node_id, device_data->second );
+  }
+
+  block->append( event, double_values, long_values );
+
+  if ( block->full() )
+  {
+    submit_block_( std::move( block ) );
+  }
+}
+
+void
+nest::RecordingBackendBinary::write_samples( const RecordingDevice& device,
+  const std::vector< Time >& times,
+  const std::vector< size_t >& senders,
+  const std::vector< double >& values )
+{
+  const size_t t = device.get_thread();
+  const size_t node_id = device.get_node_id();
+
+  data_map::value_type::iterator device_data = device_data_[ t ].find( node_id );
+  if ( device_data == device_data_[ t ].end() or not file_.is_open() or times.empty() or senders.empty() )
+  {
+    return;
+  }
+
+  std::unique_ptr< Block >& block = device_data->second.block_;
+  const size_t num_values = values.size() / ( times.size() * senders.size() );
+
+  const double* value = values.data();
+  for ( const auto& time : times )
+  {
+    const long step = time.get_steps();
+    for ( const auto sender : senders )
+    {
+      if ( not block )
+      {
+        block = get_block_( node_id, device_data->second );
+      }
+
+      block->append_sample( sender, step, value );
+      value += num_values;
+
+      if ( block->full() )
+      {
+        submit_block_( std::move( block ) );
+      }
+    }
+  }
+}
+
+void
+nest::RecordingBackendBinary::set_status( const DictionaryDatum& d )
+{
+  Parameters_ ptmp = P_; // temporary copy in case of errors
+  ptmp.set( *this, d );  // throws if BadProperty
+
+  // if we get here, temporaries contain consistent set of properties
+  P_ = ptmp;
+}
+
+void
+nest::RecordingBackendBinary::get_status( DictionaryDatum& d ) const
+{
+  P_.get( *this, d );
+}
+
+void
+nest::RecordingBackendBinary::check_device_status( const DictionaryDatum& params ) const
+{
+  DeviceData dd( "" );
+  dd.set_status( params ); // throws if params contains invalid entries
+}
+
+void
+nest::RecordingBackendBinary::get_device_defaults( DictionaryDatum& params ) const
+{
+  DeviceData dd( "" );
+  dd.get_status( params );
+}
+
+void
+nest::RecordingBackendBinary::get_device_status( const nest::RecordingDevice& device, DictionaryDatum& d ) const
+{
+  const size_t t = device.get_thread();
+  const size_t node_id = device.get_node_id();
+
+  data_map::value_type::const_iterator device_data = device_data_[ t ].find( node_id );
+  if ( device_data != device_data_[ t ].end() )
+  {
+    device_data->second.get_status( d );
+    ( *d )[ names::filename ] = compute_filename_();
+  }
+}
+
+std::string
+nest::RecordingBackendBinary::compute_filename_() const
+{
+  std::string data_path = kernel().io_manager.get_data_path();
+  if ( not data_path.empty() and not( data_path[ data_path.size() - 1 ] == '/' ) )
+  {
+    data_path += '/';
+  }
+
+  const double num_processes = kernel().mpi_manager.get_num_processes();
+  const int rank_digits = static_cast< int >( std::floor( std::log10( num_processes ) ) + 1 );
+
+  std::ostringstream rank_string;
+  rank_string << "-" << std::setfill( '0' ) << std::setw( rank_digits ) << kernel().mpi_manager.get_rank();
+
+  return data_path + kernel().io_manager.get_data_prefix() + P_.filename_ + rank_string.str() + ".nestbin";
+}
+
+void
+nest::RecordingBackendBinary::open_file_()
+{
+  const std::string filename = compute_filename_();
+
+  std::ifstream test( filename.c_str() );
+  if ( test.good() and not kernel().io_manager.overwrite_files() )
+  {
+    std::string msg = String::compose(
+      "The file '%1' already exists and overwriting files is disabled. To overwrite files, set "
+      "the kernel property overwrite_files to true. To change the name or location of the file, "
+      "change the kernel properties data_path or data_prefix, or the filename property of the backend.",
+      filename );
+    LOG( M_ERROR, "RecordingBackendBinary::prepare()", msg );
+    throw IOError();
+  }
+  test.close();
+
+  file_.open( filename.c_str(), std::ios::binary | std::ios::trunc );
+  if ( not file_.good() )
+  {
+    std::string msg = String::compose( "I/O error while opening file '%1'.", filename );
+    LOG( M_ERROR, "RecordingBackendBinary::prepare()", msg );
+    throw IOError();
+  }
+  current_filename_ = filename;
+
+  file_.write( binary_magic, sizeof( binary_magic ) );
+  write_value< uint32_t >( file_, BINARY_REC_BACKEND_VERSION );
+  write_value< uint32_t >( file_, binary_byte_order_mark );
+  write_value< uint64_t >( file_, kernel().mpi_manager.get_rank() );
+  write_value< double >( file_, Time::get_resolution().get_ms() );
+  write_string( file_, NEST_VERSION );
+
+  for ( auto& inner : device_data_ )
+  {
+    for ( auto& device_data : inner )
+    {
+      device_data.second.described_ = false;
+      device_data.second.block_.reset();
+    }
+  }
+
+  stop_writer_ = false;
+  write_error_ = false;
+  writer_ = std::thread( &RecordingBackendBinary::writer_loop_, this );
+}
+
+void
+nest::RecordingBackendBinary::close_file_()
+{
+  if ( writer_.joinable() )
+  {
+    {
+      std::lock_guard< std::mutex > lock( mutex_ );
+      stop_writer_ = true;
+    }
+    block_cond_.notify_one();
+    writer_.join();
+  }
+
+  if ( file_.is_open() )
+  {
+    file_.close();
+  }
+
+  pending_blocks_.clear();
+  free_blocks_.clear();
+  for ( auto& inner : device_data_ )
+  {
+    for ( auto& device_data : inner )
+    {
+      device_data.second.block_.reset();
+    }
+  }
+}
+
+std::unique_ptr< nest::RecordingBackendBinary::Block >
+nest::RecordingBackendBinary::get_block_( const size_t node_id, const DeviceData& device_data )
+{
+  std::unique_ptr< Block > block;
+  {
+    std::lock_guard< std::mutex > lock( mutex_ );
+    if ( not free_blocks_.empty() )
+    {
+      block = std::move( free_blocks_.back() );
+      free_blocks_.pop_back();
+    }
+  }
+
+  if ( not block )
+  {
+    block.reset( new Block() );
+  }
+
+  block->reset( node_id,
+    P_.block_size_,
+    device_data.double_value_names_.size(),
+    device_data.long_value_names_.size() );
+  return block;
+}
+
+void
+nest::RecordingBackendBinary::submit_block_( std::unique_ptr< Block > block )
+{
+  {
+    std::lock_guard< std::mutex > lock( mutex_ );
+    pending_blocks_.push_back( std::move( block ) );
+  }
+  block_cond_.notify_one();
+}
+
+void
+nest::RecordingBackendBinary::wait_for_writer_()
+{
+  std::unique_lock< std::mutex > lock( mutex_ );
+  idle_cond_.wait( lock, [ this ] { return pending_blocks_.empty() and not writer_busy_; } );
+}
+
+void
+nest::RecordingBackendBinary::check_write_error_() const
+{
+  if ( write_error_ or not file_.good() )
+  {
+    std::string msg = String::compose( "I/O error while writing file '%1'.", current_filename_ );
+    LOG( M_ERROR, "RecordingBackendBinary::post_run_hook()", msg );
+    throw IOError();
+  }
+}
+
+void
+nest::RecordingBackendBinary::writer_loop_()
+{
+  std::unique_lock< std::mutex > lock( mutex_ );
+  while ( true )
+  {
+    block_cond_.wait( lock, [ this ] { return stop_writer_ or not pending_blocks_.empty(); } );
+    if ( pending_blocks_.empty() )
+    {
+      // stop_writer_ is only honored once all pending blocks are written
+      break;
+    }
+
+    std::unique_ptr< Block > block = std::move( pending_blocks_.front() );
+    pending_blocks_.pop_front();
+    writer_busy_ = true;
+
+    // Write without holding the lock, so that simulation threads can hand over further blocks
+    lock.unlock();
+    block->write( file_ );
+    const bool failed = not file_.good();
+    lock.lock();
+
+    write_error_ = write_error_ or failed;
+    free_blocks_.push_back( std::move( block ) );
+    writer_busy_ = false;
+    if ( pending_blocks_.empty() )
+    {
+      idle_cond_.notify_all();
+    }
+  }
+}
+
+/* ******************* Fixed-size column store class Block ******************* */
+
+void
+nest::RecordingBackendBinary::Block::reset( const size_t node_id,
+  const size_t capacity,
+  const size_t num_double_values,
+  const size_t num_long_values )
+{
+  this->node_id = node_id;
+  this->capacity = capacity;
+  this->num_double_values = num_double_values;
+  this->num_long_values = num_long_values;
+  size = 0;
+
+  senders.resize( capacity );
+  steps.resize( capacity );
+  offsets.resize( capacity );
+  double_values.resize( capacity * num_double_values );
+  long_values.resize( capacity * num_long_values );
+}
+
+void
+nest::RecordingBackendBinary::Block::append( const Event& event,
+  const std::vector< double >& double_values,
+  const std::vector< long >& long_values )
+{
+  assert( size < capacity );
+  assert( double_values.size() == num_double_values );
+  assert( long_values.size() == num_long_values );
+
+  senders[ size ] = event.get_sender_node_id();
+  steps[ size ] = event.get_stamp().get_steps();
+  offsets[ size ] = event.get_offset();
+  for ( size_t i = 0; i < num_double_values; ++i )
+  {
+    this->double_values[ i * capacity + size ] = double_values[ i ];
+  }
+  for ( size_t i = 0; i < num_long_values; ++i )
+  {
+    this->long_values[ i * capacity + size ] = long_values[ i ];
+  }
+  ++size;
+}
+
+void
+nest::RecordingBackendBinary::Block::append_sample( const size_t sender, const long step, const double* values )
+{
+  assert( size < capacity );
+  assert( num_long_values == 0 );
+
+  senders[ size ] = sender;
+  steps[ size ] = step;
+  offsets[ size ] = 0.0;
+  for ( size_t i = 0; i < num_double_values; ++i )
+  {
+    double_values[ i * capacity + size ] = values[ i ];
+  }
+  ++size;
+}
+
+void
+nest::RecordingBackendBinary::Block::write( std::ofstream& out ) const
+{
+  write_value< uint32_t >( out, BLOCK_RECORD );
+  write_value< uint64_t >( out, node_id );
+  write_value< uint64_t >( out, size );
+  write_value< uint64_t >( out, num_double_values );
+  write_value< uint64_t >( out, num_long_values );
+
+  write_column( out, senders.data(), size );
+  write_column( out, steps.data(), size );
+  write_column( out, offsets.data(), size );
+  for ( size_t i = 0; i < num_double_values; ++i )
+  {
+    write_column( out, double_values.data() + i * capacity, size );
+  }
+  for ( size_t i = 0; i < num_long_values; ++i )
+  {
+    write_column( out, long_values.data() + i * capacity, size );
+  }
+}
+
+/* ******************* Device meta data class DeviceData ******************* */
+
+nest::RecordingBackendBinary::DeviceData::DeviceData( std::string modelname )
+  : modelname_( modelname )
+  , label_( "" )
+  , described_( false )
+{
+}
+
+void
+nest::RecordingBackendBinary::DeviceData::set_value_names( const std::vector< Name >& double_value_names,
+  const std::vector< Name >& long_value_names )
+{
+  double_value_names_ = double_value_names;
+  long_value_names_ = long_value_names;
+}
+
+void
+nest::RecordingBackendBinary::DeviceData::write_info( std::ofstream& out, const size_t node_id ) const
+{
+  write_value< uint32_t >( out, DEVICE_RECORD );
+  write_value< uint64_t >( out, node_id );
+  write_string( out, modelname_ );
+  write_string( out, label_ );
+  write_value< uint64_t >( out, double_value_names_.size() );
+  for ( const auto& name : double_value_names_ )
+  {
+    write_string( out, name.toString() );
+  }
+  write_value< uint64_t >( out, long_value_names_.size() );
+  for ( const auto& name : long_value_names_ )
+  {
+    write_string( out, name.toString() );
+  }
+}
+
+void
+nest::RecordingBackendBinary::DeviceData::get_status( DictionaryDatum& d ) const
+{
+  ( *d )[ names::label ] = label_;
+}
+
+void
+nest::RecordingBackendBinary::DeviceData::set_status( const DictionaryDatum& d )
+{
+  updateValue< std::string >( d, names::label, label_ );
+}
+
+/* ******************* Parameters of the backend ******************* */
+
+nest::RecordingBackendBinary::Parameters_::Parameters_()
+  : filename_( "output" )
+  , block_size_( 4096 )
+{
+}
+
+void
+nest::RecordingBackendBinary::Parameters_::get( const RecordingBackendBinary&, DictionaryDatum& d ) const
+{
+  ( *d )[ names::filename ] = filename_;
+  ( *d )[ names::block_size ] = block_size_;
+}
+
+void
+nest::RecordingBackendBinary::Parameters_::set( const RecordingBackendBinary& backend, const DictionaryDatum& d )
+{
+  if ( backend.file_.is_open() and ( d->known( names::filename ) or d->known( names::block_size ) ) )
+  {
+    throw BadProperty( "Parameters of the binary recording backend cannot be changed between Prepare and Cleanup." );
+  }
+
+  updateValue< std::string >( d, names::filename, filename_ );
+  updateValue< long >( d, names::block_size, block_size_ );
+
+  if ( block_size_ < 1 )
+  {
+    throw BadProperty( "block_size > 0 required." );
+  }
+}
@@ -0,0 +1,334 @@
+/*
+ *  recording_backend_binary.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef RECORDING_BACKEND_BINARY_H
+#define RECORDING_BACKEND_BINARY_H
+
+// C++ includes:
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "recording_backend.h"
+
+/* BeginUserDocs: NOINDEX
+
+Recording backend `binary` - Write data to columnar binary files
+----------------------------------------------------------------
+
+Description
+~~~~~~~~~~~
+
+The `binary` recording backend writes collected data persistently to
+one binary file per MPI process. It is meant for simulations that
+record large amounts of data, where formatting every event as text
+(see :doc:`recording backend for ASCII files
+</models/recording_backend_ascii>`) and creating one file per recorder
+and thread would be too costly, and where SIONlib is not available.
+
+Each thread collects the data of each recording device into blocks of
+fixed size, which store the data column by column. Full blocks are
+handed to a background thread that writes them to the file, so that
+the simulation threads do not have to wait for the file system. At the
+end of each call to ``Run``, all partially filled blocks are written
+and the file is flushed, so the data is available for immediate
+inspection.
+
+Files are named according to the following pattern:
+
+::
+
+   <data_path>/<data_prefix><filename>-<rank>.nestbin
+
+The properties ``data_path`` and ``data_prefix`` are global kernel
+properties, ``filename`` is a global property of the backend and
+``rank`` is the zero-padded rank of the MPI process writing the file.
+
+The life of a file starts with the call to ``Prepare`` and ends with
+the call to ``Cleanup``. If the file already exists, the call to
+``Prepare`` will fail with an ``IOError``, unless the kernel property
+``overwrite_files`` is set to ``True``.
+
+Data format
+~~~~~~~~~~~
+
+All numbers are stored in the native byte order of the machine that
+wrote the file. Integers are 64-bit unless noted otherwise, floating
+point numbers are 64-bit IEEE 754 values, and strings are stored as
+their length followed by their characters without terminating zero.
+
+The file starts with a header consisting of
+
+* the magic string ``NESTBIN`` followed by a zero byte (8 bytes)
+* the format version (32-bit unsigned integer)
+* the byte order mark ``0x01020304`` (32-bit unsigned integer)
+* the rank of the MPI process
+* the simulation resolution in ms
+* the NEST version (string)
+
+The header is followed by a sequence of records, each starting with
+its type as a 32-bit unsigned integer. A *device record* (type 1)
+describes a recording device and is written before the first block of
+data of the device. It contains
+
+* the node ID of the device
+* the model name and the label of the device (strings)
+* the number of double valued columns, followed by their names (strings)
+* the number of integer valued columns, followed by their names (strings)
+
+A *block record* (type 2) contains the data recorded by a device on
+one thread. It contains the node ID of the device, the number of
+events ``n``, the number of double and the number of integer valued
+columns, followed by the columns, each of them ``n`` entries long:
+
+* the node IDs of the senders
+* the time steps of the events
+* the offsets of the events in ms
+* the double valued columns in the order given by the device record
+* the integer valued columns in the order given by the device record
+
+The time of an event in ms is its time step multiplied by the
+resolution minus its offset.
+
+Reading the data
+~~~~~~~~~~~~~~~~
+
+The function ``nest.ReadBinaryRecording()`` reads one or more files
+written by this backend. For each recording device, it returns the
+model name and label and the recorded events in the same form as the
+``events`` of the ``memory`` backend.
+
+Recorder-specific parameters
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+label
+    A string (default: *""*) that is stored in the device record to
+    identify the recording device.
+
+filename
+    The name of the file the device records to. This is a read-only
+    property.
+
+Global parameters
+~~~~~~~~~~~~~~~~~
+
+These parameters can be set by assigning a nested dictionary to the
+kernel attribute ``recording_backends``. The dictionary has to have
+the form ``{'binary': {k_1: v_1, …, k_n: v_n}`` with ``k_i`` being
+from the following list:
+
+filename
+    The filename (default: *"output"*) part of the pattern according to
+    which the full filename is generated (see above).
+
+block_size
+    The number of events (default: *4096*) per block. Larger blocks
+    reduce the number of hand-offs to the writer thread at the cost of
+    memory per recording device and thread. This property cannot be
+    changed between ``Prepare`` and ``Cleanup``.
+
+EndUserDocs */
+
+namespace nest
+{
+
+/**
+ * Binary specialization of the RecordingBackend interface.
+ *
+ * RecordingBackendBinary stores the events of each recording device
+ * instance in a Block owned by the device's thread, so write() does
+ * not need any synchronization. Full blocks are moved to a queue of
+ * pending blocks, from which a writer thread started in prepare()
+ * writes them to the file of the MPI process. Written blocks are kept
+ * for reuse to avoid allocations during the simulation.
+ */
+class RecordingBackendBinary : public RecordingBackend
+{
+public:
+  const static unsigned int BINARY_REC_BACKEND_VERSION;
+
+  RecordingBackendBinary();
+
+  ~RecordingBackendBinary() throw() override;
+
+  void initialize() override;
+
+  void finalize() override;
+
+  void enroll( const RecordingDevice& device, const DictionaryDatum& params ) override;
+
+  void disenroll( const RecordingDevice& device ) override;
+
+  void set_value_names( const RecordingDevice& device,
+    const std::vector< Name >& double_value_names,
+    const std::vector< Name >& long_value_names ) override;
+
+  /**
+   * Open the file and start the writer thread
+   */
+  void prepare() override;
+
+  /**
+   * Stop the writer thread and close the file
+   */
+  void cleanup() override;
+
+  /**
+   * Write device records for devices that have not been described yet
+   */
+  void pre_run_hook() override;
+
+  /**
+   * Write all partially filled blocks and flush the file
+   */
+  void post_run_hook() override;
+
+  void post_step_hook() override;
+
+  void write( const RecordingDevice&, const Event&, const std::vector< double >&, const std::vector< long >& ) override;
+
+  /**
+   * Append the samples of a block directly to the columns of the device's
+   * Block, without passing them through write() one by one
+   */
+  void write_samples( const RecordingDevice&,
+    const std::vector< Time >&,
+    const std::vector< size_t >&,
+    const std::vector< double >& ) override;
+
+  void set_status( const DictionaryDatum& ) override;
+  void get_status( DictionaryDatum& ) const override;
+
+  void check_device_status( const DictionaryDatum& ) const override;
+  void get_device_defaults( DictionaryDatum& ) const override;
+  void get_device_status( const RecordingDevice& device, DictionaryDatum& ) const override;
+
+private:
+  //! Record types in the binary file
+  enum RecordType : uint32_t
+  {
+    DEVICE_RECORD = 1,
+    BLOCK_RECORD = 2
+  };
+
+  /**
+   * Fixed-size column store for the events of one device on one thread.
+   */
+  struct Block
+  {
+    void reset( size_t node_id, size_t capacity, size_t num_double_values, size_t num_long_values );
+    void append( const Event&, const std::vector< double >&, const std::vector< long >& );
+    void append_sample( size_t sender, long step, const double* values );
+    void write( std::ofstream& ) const;
+
+    bool
+    full() const
+    {
+      return size == capacity;
+    }
+
+    size_t node_id;
+    size_t capacity;
+    size_t size;
+    size_t num_double_values;
+    size_t num_long_values;
+    std::vector< int64_t > senders;
+    std::vector< int64_t > steps;
+    std::vector< double > offsets;
+    std::vector< double > double_values; //!< one column of capacity entries per double value
+    std::vector< int64_t > long_values;  //!< one column of capacity entries per long value
+  };
+
+  struct DeviceData
+  {
+    DeviceData() = delete;
+    explicit DeviceData( std::string );
+    void set_value_names( const std::vector< Name >&, const std::vector< Name >& );
+    void write_info( std::ofstream&, size_t node_id ) const;
+    void get_status( DictionaryDatum& ) const;
+    void set_status( const DictionaryDatum& );
+
+    std::string modelname_;                  //!< Model name of the device
+    std::string label_;                      //!< The label of the device
+    std::vector< Name > double_value_names_; //!< names for values of type double
+    std::vector< Name > long_value_names_;   //!< names for values of type long
+    std::unique_ptr< Block > block_;         //!< Block currently filled by the device's thread
+    bool described_;                         //!< Whether the device record was written to the current file
+  };
+
+  struct Parameters_
+  {
+    std::string filename_; //!< the filename part of the pattern for the file name
+    long block_size_;      //!< the number of events per block
+
+    Parameters_();
+
+    void get( const RecordingBackendBinary&, DictionaryDatum& ) const;
+    void set( const RecordingBackendBinary&, const DictionaryDatum& );
+  };
+
+  std::string compute_filename_() const;
+  void open_file_();
+  void close_file_();
+
+  //! Return an empty block, reusing a written one if possible
+  std::unique_ptr< Block > get_block_( size_t node_id, const DeviceData& );
+
+  //! Pass a block to the writer thread
+  void submit_block_( std::unique_ptr< Block > block );
+
+  //! Block until the writer thread has written all pending blocks
+  void wait_for_writer_();
+
+  //! Throw if the writer thread failed to write to the file
+  void check_write_error_() const;
+
+  //! Main loop of the writer thread
+  void writer_loop_();
+
+  Parameters_ P_;
+
+  typedef std::vector< std::map< size_t, DeviceData > > data_map;
+  data_map device_data_;
+
+  std::ofstream file_;
+  std::string current_filename_; //!< Name of the file opened in prepare()
+  std::thread writer_;
+
+  std::mutex mutex_;                   //!< Protects all members below
+  std::condition_variable block_cond_; //!< Signals new pending blocks or stop_writer_
+  std::condition_variable idle_cond_;  //!< Signals that the writer thread is idle
+  std::deque< std::unique_ptr< Block > > pending_blocks_;
+  std::vector< std::unique_ptr< Block > > free_blocks_;
+  bool writer_busy_; //!< Whether the writer thread is writing a block
+  bool stop_writer_; //!< Whether the writer thread shall terminate
+  bool write_error_; //!< Whether writing to the file failed
+};
+
+} // namespace
+
+#endif /* #ifndef RECORDING_BACKEND_BINARY_H */
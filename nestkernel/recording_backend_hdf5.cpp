@@ -0,0 +1,719 @@
+/*
+ *  recording_backend_hdf5.cpp
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "recording_backend_hdf5.h"
+
+#ifdef HAVE_HDF5
+
+// C++ includes:
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+// Includes from libnestutil:
+#include "compose.hpp"
+
+// Includes from nestkernel:
+#include "recording_device.h"
+#include "vp_manager_impl.h"
+
+// includes from sli:
+#include "dictutils.h"
+
+const unsigned int nest::RecordingBackendHDF5::HDF5_REC_BACKEND_VERSION = 1;
+
+namespace
+{
+
+/**
+ * Disable the automatic printing of the HDF5 error stack for the lifetime
+ * of the object and restore the previous setting afterwards.
+ *
+ * Errors in the calls of the backend are reported via exceptions, so the
+ * error stack would only clutter the output. Other users of the HDF5
+ * library in the same process keep their own error reporting.
+ */
+class HDF5ErrorPrintingDisabler
+{
+public:
+  HDF5ErrorPrintingDisabler()
+    : func_( nullptr )
+    , client_data_( nullptr )
+  {
+    H5Eget_auto2( H5E_DEFAULT, &func_, &client_data_ );
+    H5Eset_auto2( H5E_DEFAULT, nullptr, nullptr );
+  }
+
+  ~HDF5ErrorPrintingDisabler()
+  {
+    H5Eset_auto2( H5E_DEFAULT, func_, client_data_ );
+  }
+
+  HDF5ErrorPrintingDisabler( const HDF5ErrorPrintingDisabler& ) = delete;
+  HDF5ErrorPrintingDisabler& operator=( const HDF5ErrorPrintingDisabler& ) = delete;
+
+private:
+  H5E_auto2_t func_;
+  void* client_data_;
+};
+
+void
+write_string_attribute( H5::H5Object& object, const std::string& name, const std::string& value )
+{
+  const H5::StrType type( H5::PredType::C_S1, H5T_VARIABLE );
+  H5::Attribute attribute = object.createAttribute( name, type, H5::DataSpace( H5S_SCALAR ) );
+  attribute.write( type, value );
+}
+
+template < typename T >
+void
+write_scalar_attribute( H5::H5Object& object,
+  const std::string& name,
+  const H5::PredType& file_type,
+  const H5::PredType& mem_type,
+  const T value )
+{
+  H5::Attribute attribute = object.createAttribute( name, file_type, H5::DataSpace( H5S_SCALAR ) );
+  attribute.write( mem_type, &value );
+}
+
+/**
+ * Append values to the end of a one-dimensional extendable dataset in a single hyperslab.
+ */
+template < typename T >
+void
+append_to_dataset( H5::DataSet& dataset, const H5::PredType& mem_type, const std::vector< T >& values )
+{
+  hsize_t offset;
+  dataset.getSpace().getSimpleExtentDims( &offset );
+
+  hsize_t count = values.size();
+  const hsize_t size = offset + count;
+  dataset.extend( &size );
+
+  H5::DataSpace file_space = dataset.getSpace();
+  file_space.selectHyperslab( H5S_SELECT_SET, &count, &offset );
+  const H5::DataSpace mem_space( 1, &count );
+  dataset.write( values.data(), mem_type, mem_space, file_space );
+}
+
+} // namespace
+
+nest::RecordingBackendHDF5::RecordingBackendHDF5()
+{
+}
+
+nest::RecordingBackendHDF5::~RecordingBackendHDF5() throw()
+{
+  close_file_();
+}
+
+void
+nest::RecordingBackendHDF5::initialize()
+{
+  data_map tmp( kernel().vp_manager.get_num_threads() );
+  device_data_.swap( tmp );
+  num_buffered_.assign( kernel().vp_manager.get_num_threads(), 0 );
+}
+
+void
+nest::RecordingBackendHDF5::finalize()
+{
+  close_file_();
+}
+
+void
+nest::RecordingBackendHDF5::enroll( const RecordingDevice& device, const DictionaryDatum& params )
+{
+  const size_t t = device.get_thread();
+  const size_t node_id = device.get_node_id();
+
+  data_map::value_type::iterator device_data = device_data_[ t ].find( node_id );
+  if ( device_data == device_data_[ t ].end() )
+  {
+    auto p = device_data_[ t ].insert( std::make_pair( node_id, DeviceData( device.get_name() ) ) );
+    device_data = p.first;
+  }
+
+  device_data->second.set_status( params );
+}
+
+void
+nest::RecordingBackendHDF5::disenroll( const RecordingDevice& device )
+{
+  const size_t t = device.get_thread();
+  const size_t node_id = device.get_node_id();
+
+  data_map::value_type::iterator device_data = device_data_[ t ].find( node_id );
+  if ( device_data != device_data_[ t ].end() )
+  {
+    num_buffered_[ t ] -= device_data->second.senders_.size();
+    device_data_[ t ].erase( device_data );
+  }
+}
+
+void
+nest::RecordingBackendHDF5::set_value_names( const RecordingDevice& device,
+  const std::vector< Name >& double_value_names,
+  const std::vector< Name >& long_value_names )
+{
+  const size_t t = device.get_thread();
+  const size_t node_id = device.get_node_id();
+
+  data_map::value_type::iterator device_data = device_data_[ t ].find( node_id );
+  assert( device_data != device_data_[ t ].end() );
+  device_data->second.set_value_names( double_value_names, long_value_names );
+}
+
+void
+nest::RecordingBackendHDF5::prepare()
+{
+  size_t num_enrolled_devices = 0;
+  for ( const auto& inner : device_data_ )
+  {
+    num_enrolled_devices += inner.size();
+  }
+
+  // Only create a file if devices record to this backend on this rank
+  if ( num_enrolled_devices > 0 )
+  {
+    open_file_();
+  }
+}
+
+void
+nest::RecordingBackendHDF5::cleanup()
+{
+  close_file_();
+}
+
+void
+nest::RecordingBackendHDF5::pre_run_hook()
+{
+  if ( not file_ )
+  {
+    return;
+  }
+
+  for ( const auto& inner : device_data_ )
+  {
+    for ( const auto& device_data : inner )
+    {
+      if ( datasets_.find( device_data.first ) == datasets_.end() )
+      {
+        create_datasets_( device_data.first, device_data.second );
+      }
+    }
+  }
+}
+
+void
+nest::RecordingBackendHDF5::post_run_hook()
+{
+  if ( not file_ )
+  {
+    return;
+  }
+
+  for ( size_t tid = 0; tid < device_data_.size(); ++tid )
+  {
+    write_buffers_( tid );
+  }
+
+  if ( write_error_.empty() )
+  {
+    try
+    {
+      file_->flush( H5F_SCOPE_LOCAL );
+    }
+    catch ( const H5::Exception& e )
+    {
+      write_error_ = e.getDetailMsg();
+    }
+  }
+
+  if ( not write_error_.empty() )
+  {
+    std::string msg =
+      String::compose( "I/O error while writing file '%1': %2", current_filename_, write_error_ );
+    write_error_.clear();
+    LOG( M_ERROR, "RecordingBackendHDF5::post_run_hook()", msg );
+    throw IOError();
+  }
+}
+
+void
+nest::RecordingBackendHDF5::post_step_hook()
+{
+  // This function is called by all threads in parallel
+  const size_t tid = kernel().vp_manager.get_thread_id();
+  if ( not file_ or num_buffered_[ tid ] < static_cast< size_t >( P_.buffer_size_ ) )
+  {
+    return;
+  }
+
+#pragma omp critical( recording_backend_hdf5 )
+  {
+    write_buffers_( tid );
+  }
+}
+
+void
+nest::RecordingBackendHDF5::write( const RecordingDevice& device,
+  const Event& event,
+  const std::vector< double >& double_values,
+  const std::vector< long >& long_values )
+{
+  const size_t t = device.get_thread();
+  const size_t node_id = device.get_node_id();
+
+  data_map::value_type::iterator device_data = device_data_[ t ].find( node_id );
+  if ( device_data == device_data_[ t ].end() or not file_ )
+  {
+    return;
+  }
+
+  device_data->second.append( event, double_values, long_values );
+  ++num_buffered_[ t ];
+}
+
+void
+nest::RecordingBackendHDF5::write_samples( const RecordingDevice& device,
+  const std::vector< Time >& times,
+  const std::vector< size_t >& senders,
+  const std::vector< double >& values )
+{
+  const size_t t = device.get_thread();
+  const size_t node_id = device.get_node_id();
+
+  data_map::value_type::iterator device_data = device_data_[ t ].find( node_id );
+  if ( device_data == device_data_[ t ].end() or not file_ )
+  {
+    return;
+  }
+
+  device_data->second.append_samples( times, senders, values );
+  num_buffered_[ t ] += times.size() * senders.size();
+}
+
+void
+nest::RecordingBackendHDF5::set_status( const DictionaryDatum& d )
+{
+  Parameters_ ptmp = P_; // temporary copy in case of errors
+  ptmp.set( *this, d );  // throws if BadProperty
+
+  // if we get here, temporaries contain consistent set of properties
+  P_ = ptmp;
+}
+
+void
+nest::RecordingBackendHDF5::get_status( DictionaryDatum& d ) const
+{
+  P_.get( *this, d );
+}
+
+void
+nest::RecordingBackendHDF5::check_device_status( const DictionaryDatum& params ) const
+{
+  DeviceData dd( "" );
+  dd.set_status( params ); // throws if params contains invalid entries
+}
+
+void
+nest::RecordingBackendHDF5::get_device_defaults( DictionaryDatum& params ) const
+{
+  DeviceData dd( "" );
+  dd.get_status( params );
+}
+
+void
+nest::RecordingBackendHDF5::get_device_status( const nest::RecordingDevice& device, DictionaryDatum& d ) const
+{
+  const size_t t = device.get_thread();
+  const size_t node_id = device.get_node_id();
+
+  data_map::value_type::const_iterator device_data = device_data_[ t ].find( node_id );
+  if ( device_data != device_data_[ t ].end() )
+  {
+    device_data->second.get_status( d );
+    ( *d )[ names::filename ] = compute_filename_();
+  }
+}
+
+std::string
+nest::RecordingBackendHDF5::compute_filename_() const
+{
+  std::string data_path = kernel().io_manager.get_data_path();
+  if ( not data_path.empty() and not( data_path[ data_path.size() - 1 ] == '/' ) )
+  {
+    data_path += '/';
+  }
+
+  const double num_processes = kernel().mpi_manager.get_num_processes();
+  const int rank_digits = static_cast< int >( std::floor( std::log10( num_processes ) ) + 1 );
+
+  std::ostringstream rank_string;
+  rank_string << "-" << std::setfill( '0' ) << std::setw( rank_digits ) << kernel().mpi_manager.get_rank();
+
+  return data_path + kernel().io_manager.get_data_prefix() + P_.filename_ + rank_string.str() + ".h5";
+}
+
+void
+nest::RecordingBackendHDF5::open_file_()
+{
+  const std::string filename = compute_filename_();
+
+  std::ifstream test( filename.c_str() );
+  if ( test.good() and not kernel().io_manager.overwrite_files() )
+  {
+    std::string msg = String::compose(
+      "The file '%1' already exists and overwriting files is disabled. To overwrite files, set "
+      "the kernel property overwrite_files to true. To change the name or location of the file, "
+      "change the kernel properties data_path or data_prefix, or the filename property of the backend.",
+      filename );
+    LOG( M_ERROR, "RecordingBackendHDF5::prepare()", msg );
+    throw IOError();
+  }
+  test.close();
+
+  const HDF5ErrorPrintingDisabler disabler;
+
+  try
+  {
+    file_.reset( new H5::H5File( filename, H5F_ACC_TRUNC ) );
+
+    write_string_attribute( *file_, "nest_version", NEST_VERSION );
+    write_scalar_attribute< unsigned int >(
+      *file_, "version", H5::PredType::STD_U32LE, H5::PredType::NATIVE_UINT, HDF5_REC_BACKEND_VERSION );
+    write_scalar_attribute< long >(
+      *file_, "rank", H5::PredType::STD_I64LE, H5::PredType::NATIVE_LONG, kernel().mpi_manager.get_rank() );
+    write_scalar_attribute< double >(
+      *file_, "resolution", H5::PredType::IEEE_F64LE, H5::PredType::NATIVE_DOUBLE, Time::get_resolution().get_ms() );
+  }
+  catch ( const H5::Exception& e )
+  {
+    file_.reset();
+    std::string msg = String::compose( "I/O error while opening file '%1': %2", filename, e.getDetailMsg() );
+    LOG( M_ERROR, "RecordingBackendHDF5::prepare()", msg );
+    throw IOError();
+  }
+  current_filename_ = filename;
+
+  datasets_.clear();
+  write_error_.clear();
+  for ( size_t tid = 0; tid < device_data_.size(); ++tid )
+  {
+    for ( auto& device_data : device_data_[ tid ] )
+    {
+      device_data.second.clear();
+    }
+    num_buffered_[ tid ] = 0;
+  }
+}
+
+void
+nest::RecordingBackendHDF5::close_file_()
+{
+  const HDF5ErrorPrintingDisabler disabler;
+
+  datasets_.clear();
+
+  if ( file_ )
+  {
+    try
+    {
+      file_->close();
+    }
+    catch ( const H5::Exception& )
+    {
+      // the file is released anyway, errors of the last run have been reported by post_run_hook()
+    }
+    file_.reset();
+  }
+
+  for ( size_t tid = 0; tid < device_data_.size(); ++tid )
+  {
+    for ( auto& device_data : device_data_[ tid ] )
+    {
+      device_data.second.clear();
+    }
+    num_buffered_[ tid ] = 0;
+  }
+}
+
+H5::DataSet
+nest::RecordingBackendHDF5::create_dataset_( H5::Group& group,
+  const std::string& name,
+  const H5::PredType& type ) const
+{
+  const hsize_t size = 0;
+  const hsize_t max_size = H5S_UNLIMITED;
+  const H5::DataSpace space( 1, &size, &max_size );
+
+  H5::DSetCreatPropList properties;
+  const hsize_t chunk_size = P_.chunk_size_;
+  properties.setChunk( 1, &chunk_size );
+  if ( P_.compression_level_ > 0 )
+  {
+    properties.setDeflate( P_.compression_level_ );
+  }
+
+  return group.createDataSet( name, type, space, properties );
+}
+
+void
+nest::RecordingBackendHDF5::create_datasets_( const size_t node_id, const DeviceData& device_data )
+{
+  const HDF5ErrorPrintingDisabler disabler;
+
+  try
+  {
+    DeviceDatasets& datasets = datasets_[ node_id ];
+    datasets.group = file_->createGroup( std::to_string( node_id ) );
+
+    write_scalar_attribute< long >(
+      datasets.group, "node_id", H5::PredType::STD_I64LE, H5::PredType::NATIVE_LONG, node_id );
+    write_string_attribute( datasets.group, "model", device_data.modelname_ );
+    write_string_attribute( datasets.group, "label", device_data.label_ );
+
+    datasets.senders = create_dataset_( datasets.group, "senders", H5::PredType::STD_I64LE );
+    datasets.times = create_dataset_( datasets.group, "times", H5::PredType::IEEE_F64LE );
+    for ( const auto& name : device_data.double_value_names_ )
+    {
+      datasets.double_values.push_back(
+        create_dataset_( datasets.group, name.toString(), H5::PredType::IEEE_F64LE ) );
+    }
+    for ( const auto& name : device_data.long_value_names_ )
+    {
+      datasets.long_values.push_back( create_dataset_( datasets.group, name.toString(), H5::PredType::STD_I64LE ) );
+    }
+  }
+  catch ( const H5::Exception& e )
+  {
+    datasets_.erase( node_id );
+    std::string msg = String::compose(
+      "I/O error while creating datasets for device %1 in file '%2': %3", node_id, current_filename_, e.getDetailMsg() );
+    LOG( M_ERROR, "RecordingBackendHDF5::pre_run_hook()", msg );
+    throw IOError();
+  }
+}
+
+void
+nest::RecordingBackendHDF5::write_buffers_( const size_t tid )
+{
+  const HDF5ErrorPrintingDisabler disabler;
+
+  for ( auto& device_data : device_data_[ tid ] )
+  {
+    DeviceData& data = device_data.second;
+    if ( data.senders_.empty() )
+    {
+      continue;
+    }
+
+    // After an error, buffers are discarded and the error is reported at the end of the run
+    if ( write_error_.empty() )
+    {
+      try
+      {
+        DeviceDatasets& datasets = datasets_.at( device_data.first );
+        append_to_dataset( datasets.senders, H5::PredType::NATIVE_LONG, data.senders_ );
+        append_to_dataset( datasets.times, H5::PredType::NATIVE_DOUBLE, data.times_ );
+        for ( size_t i = 0; i < data.double_values_.size(); ++i )
+        {
+          append_to_dataset( datasets.double_values[ i ], H5::PredType::NATIVE_DOUBLE, data.double_values_[ i ] );
+        }
+        for ( size_t i = 0; i < data.long_values_.size(); ++i )
+        {
+          append_to_dataset( datasets.long_values[ i ], H5::PredType::NATIVE_LONG, data.long_values_[ i ] );
+        }
+      }
+      catch ( const H5::Exception& e )
+      {
+        write_error_ = e.getDetailMsg();
+      }
+      catch ( const std::out_of_range& )
+      {
+        write_error_ = String::compose( "no datasets for device %1", device_data.first );
+      }
+    }
+
+    data.clear();
+  }
+
+  num_buffered_[ tid ] = 0;
+}
+
+/* ******************* Device meta data and buffers class DeviceData ******************* */
+
+nest::RecordingBackendHDF5::DeviceData::DeviceData( std::string modelname )
+  : modelname_( modelname )
+  , label_( "" )
+{
+}
+
+void
+nest::RecordingBackendHDF5::DeviceData::set_value_names( const std::vector< Name >& double_value_names,
+  const std::vector< Name >& long_value_names )
+{
+  double_value_names_ = double_value_names;
+  long_value_names_ = long_value_names;
+
+  clear();
+  double_values_.resize( double_value_names.size() );
+  long_values_.resize( long_value_names.size() );
+}
+
+void
+nest::RecordingBackendHDF5::DeviceData::append( const Event& event,
+  const std::vector< double >& double_values,
+  const std::vector< long >& long_values )
+{
+  assert( double_values.size() == double_values_.size() );
+  assert( long_values.size() == long_values_.size() );
+
+  senders_.push_back( event.get_sender_node_id() );
+  times_.push_back( event.get_stamp().get_ms() - event.get_offset() );
+  for ( size_t i = 0; i < double_values.size(); ++i )
+  {
+    double_values_[ i ].push_back( double_values[ i ] );
+  }
+  for ( size_t i = 0; i < long_values.size(); ++i )
+  {
+    long_values_[ i ].push_back( long_values[ i ] );
+  }
+}
+
+void
+nest::RecordingBackendHDF5::DeviceData::append_samples( const std::vector< Time >& times,
+  const std::vector< size_t >& senders,
+  const std::vector< double >& values )
+{
+  assert( long_values_.empty() );
+
+  const size_t num_samples = times.size() * senders.size();
+  if ( num_samples == 0 )
+  {
+    return;
+  }
+
+  const size_t num_values = double_values_.size();
+  assert( values.size() == num_samples * num_values );
+
+  senders_.reserve( senders_.size() + num_samples );
+  times_.reserve( times_.size() + num_samples );
+  for ( const auto& time : times )
+  {
+    senders_.insert( senders_.end(), senders.begin(), senders.end() );
+    times_.insert( times_.end(), senders.size(), time.get_ms() );
+  }
+
+  // values are stored sample by sample, columns hold one value of each sample
+  for ( size_t i = 0; i < num_values; ++i )
+  {
+    std::vector< double >& column = double_values_[ i ];
+    column.reserve( column.size() + num_samples );
+    for ( size_t j = 0; j < num_samples; ++j )
+    {
+      column.push_back( values[ j * num_values + i ] );
+    }
+  }
+}
+
+void
+nest::RecordingBackendHDF5::DeviceData::clear()
+{
+  // clear() keeps the capacity, so buffers are not reallocated after each write
+  senders_.clear();
+  times_.clear();
+  for ( auto& column : double_values_ )
+  {
+    column.clear();
+  }
+  for ( auto& column : long_values_ )
+  {
+    column.clear();
+  }
+}
+
+void
+nest::RecordingBackendHDF5::DeviceData::get_status( DictionaryDatum& d ) const
+{
+  ( *d )[ names::label ] = label_;
+}
+
+void
+nest::RecordingBackendHDF5::DeviceData::set_status( const DictionaryDatum& d )
+{
+  updateValue< std::string >( d, names::label, label_ );
+}
+
+/* ******************* Parameters of the backend ******************* */
+
+nest::RecordingBackendHDF5::Parameters_::Parameters_()
+  : filename_( "output" )
+  , buffer_size_( 65536 )
+  , chunk_size_( 16384 )
+  , compression_level_( 0 )
+{
+}
+
+void
+nest::RecordingBackendHDF5::Parameters_::get( const RecordingBackendHDF5&, DictionaryDatum& d ) const
+{
+  ( *d )[ names::filename ] = filename_;
+  ( *d )[ names::buffer_size ] = buffer_size_;
+  ( *d )[ names::chunk_size ] = chunk_size_;
+  ( *d )[ names::compression_level ] = compression_level_;
+}
+
+void
+nest::RecordingBackendHDF5::Parameters_::set( const RecordingBackendHDF5& backend, const DictionaryDatum& d )
+{
+  if ( backend.file_
+    and ( d->known( names::filename ) or d->known( names::buffer_size ) or d->known( names::chunk_size )
+      or d->known( names::compression_level ) ) )
+  {
+    throw BadProperty( "Parameters of the hdf5 recording backend cannot be changed between Prepare and Cleanup." );
+  }
+
+  updateValue< std::string >( d, names::filename, filename_ );
+  updateValue< long >( d, names::buffer_size, buffer_size_ );
+  updateValue< long >( d, names::chunk_size, chunk_size_ );
+  updateValue< long >( d, names::compression_level, compression_level_ );
+
+  if ( buffer_size_ < 1 )
+  {
+    throw BadProperty( "buffer_size > 0 required." );
+  }
+  if ( chunk_size_ < 1 )
+  {
+    throw BadProperty( "chunk_size > 0 required." );
+  }
+  if ( compression_level_ < 0 or compression_level_ > 9 )
+  {
+    throw BadProperty( "0 <= compression_level <= 9 required." );
+  }
+}
+
+#endif /* HAVE_HDF5 */
@@ -0,0 +1,300 @@
+/*
+ *  recording_backend_hdf5.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef RECORDING_BACKEND_HDF5_H
+#define RECORDING_BACKEND_HDF5_H
+
+#include "config.h"
+
+#ifdef HAVE_HDF5
+
+// C++ includes:
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "recording_backend.h"
+
+#include "H5Cpp.h"
+
+/* BeginUserDocs: NOINDEX
+
+Recording backend `hdf5` - Write data to HDF5 files
+---------------------------------------------------
+
+Description
+~~~~~~~~~~~
+
+The `hdf5` recording backend writes collected data persistently to
+one HDF5 file per MPI process. The data of each recording device is
+stored in chunked datasets, which can optionally be compressed and
+are extended as the simulation progresses. The files can be read with
+any HDF5 tool, for instance with `h5py <https://www.h5py.org>`_ from
+Python.
+
+Each thread buffers the events of its recording devices in memory.
+Once a thread has buffered ``buffer_size`` events, it appends them to
+the datasets of the respective devices in one large write operation
+per dataset. All remaining events are written and the file is flushed
+at the end of each call to ``Run``, so the data is available for
+immediate inspection. As the HDF5 library is not thread-safe, threads
+write to the file one after the other.
+
+Files are named according to the following pattern:
+
+::
+
+   <data_path>/<data_prefix><filename>-<rank>.h5
+
+The properties ``data_path`` and ``data_prefix`` are global kernel
+properties, ``filename`` is a global property of the backend and
+``rank`` is the zero-padded rank of the MPI process writing the file.
+
+The life of a file starts with the call to ``Prepare`` and ends with
+the call to ``Cleanup``. If the file already exists, the call to
+``Prepare`` will fail with an ``IOError``, unless the kernel property
+``overwrite_files`` is set to ``True``.
+
+Data layout
+~~~~~~~~~~~
+
+The root group of the file has the attributes ``nest_version``,
+``version`` (the version of the data layout), ``rank`` and
+``resolution`` (in ms). The data of each recording device
+is stored in a group named after the node ID of the device, which has
+the attributes ``node_id``, ``model`` and ``label``. The group contains
+one-dimensional datasets of equal length:
+
+senders
+    The node IDs of the senders of the events (64-bit integers).
+
+times
+    The times of the events in ms (64-bit floating point numbers).
+
+*value names*
+    One dataset for each value recorded by the device, for instance
+    ``V_m`` for a multimeter recording the membrane potential. Values
+    of type double are stored as 64-bit floating point numbers, all
+    other values as 64-bit integers.
+
+Events recorded by different threads are appended in the order in
+which the threads write their buffers, so the datasets are not sorted
+by time.
+
+Recorder-specific parameters
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+label
+    A string (default: *""*) that is stored as an attribute of the
+    group of the recording device.
+
+filename
+    The name of the file the device records to. This is a read-only
+    property.
+
+Global parameters
+~~~~~~~~~~~~~~~~~
+
+These parameters can be set by assigning a nested dictionary to the
+kernel attribute ``recording_backends``. The dictionary has to have
+the form ``{'hdf5': {k_1: v_1, …, k_n: v_n}`` with ``k_i`` being
+from the following list:
+
+filename
+    The filename (default: *"output"*) part of the pattern according to
+    which the full filename is generated (see above).
+
+buffer_size
+    The number of events (default: *65536*) a thread buffers before
+    writing them to the file.
+
+chunk_size
+    The number of entries (default: *16384*) per chunk of the datasets.
+    Datasets are extended and compressed in units of chunks.
+
+compression_level
+    The level of the deflate compression of the datasets between *0*
+    (default, no compression) and *9* (strongest compression).
+
+The parameters cannot be changed between ``Prepare`` and ``Cleanup``.
+
+EndUserDocs */
+
+namespace nest
+{
+
+/**
+ * HDF5 specialization of the RecordingBackend interface.
+ *
+ * RecordingBackendHDF5 buffers the events of each recording device
+ * instance in columns owned by the device's thread, so write() does
+ * not need any synchronization. As the HDF5 library is not
+ * thread-safe, the buffers are appended to the datasets of the file
+ * in post_step_hook() inside a critical section, and serially in
+ * post_run_hook(). Errors reported by HDF5 during the simulation are
+ * recorded and raised in post_run_hook(), because exceptions must not
+ * leave the critical section.
+ */
+class RecordingBackendHDF5 : public RecordingBackend
+{
+public:
+  const static unsigned int HDF5_REC_BACKEND_VERSION;
+
+  RecordingBackendHDF5();
+
+  ~RecordingBackendHDF5() throw() override;
+
+  void initialize() override;
+
+  void finalize() override;
+
+  void enroll( const RecordingDevice& device, const DictionaryDatum& params ) override;
+
+  void disenroll( const RecordingDevice& device ) override;
+
+  void set_value_names( const RecordingDevice& device,
+    const std::vector< Name >& double_value_names,
+    const std::vector< Name >& long_value_names ) override;
+
+  /**
+   * Create the file
+   */
+  void prepare() override;
+
+  /**
+   * Close the file
+   */
+  void cleanup() override;
+
+  /**
+   * Create the groups and datasets of devices that are new in the file
+   */
+  void pre_run_hook() override;
+
+  /**
+   * Write all buffered events and flush the file
+   */
+  void post_run_hook() override;
+
+  /**
+   * Write the buffered events of the calling thread if its buffers are full
+   */
+  void post_step_hook() override;
+
+  void write( const RecordingDevice&, const Event&, const std::vector< double >&, const std::vector< long >& ) override;
+
+  /**
+   * Append the samples of a block directly to the buffered columns of the
+   * device, without passing them through write() one by one
+   */
+  void write_samples( const RecordingDevice&,
+    const std::vector< Time >&,
+    const std::vector< size_t >&,
+    const std::vector< double >& ) override;
+
+  void set_status( const DictionaryDatum& ) override;
+  void get_status( DictionaryDatum& ) const override;
+
+  void check_device_status( const DictionaryDatum& ) const override;
+  void get_device_defaults( DictionaryDatum& ) const override;
+  void get_device_status( const RecordingDevice& device, DictionaryDatum& ) const override;
+
+private:
+  /**
+   * Datasets of one recording device, shared by all threads.
+   */
+  struct DeviceDatasets
+  {
+    H5::Group group;
+    H5::DataSet senders;
+    H5::DataSet times;
+    std::vector< H5::DataSet > double_values;
+    std::vector< H5::DataSet > long_values;
+  };
+
+  struct DeviceData
+  {
+    DeviceData() = delete;
+    explicit DeviceData( std::string );
+    void set_value_names( const std::vector< Name >&, const std::vector< Name >& );
+    void append( const Event&, const std::vector< double >&, const std::vector< long >& );
+    void append_samples( const std::vector< Time >&, const std::vector< size_t >&, const std::vector< double >& );
+    void clear();
+    void get_status( DictionaryDatum& ) const;
+    void set_status( const DictionaryDatum& );
+
+    std::string modelname_;                  //!< Model name of the device
+    std::string label_;                      //!< The label of the device
+    std::vector< Name > double_value_names_; //!< names for values of type double
+    std::vector< Name > long_value_names_;   //!< names for values of type long
+
+    std::vector< long > senders_;                        //!< buffered node IDs of senders
+    std::vector< double > times_;                        //!< buffered times in ms
+    std::vector< std::vector< double > > double_values_; //!< one buffered column per double value
+    std::vector< std::vector< long > > long_values_;     //!< one buffered column per long value
+  };
+
+  struct Parameters_
+  {
+    std::string filename_;   //!< the filename part of the pattern for the file name
+    long buffer_size_;       //!< the number of events a thread buffers before writing
+    long chunk_size_;        //!< the number of entries per chunk of a dataset
+    long compression_level_; //!< the deflate level, 0 means no compression
+
+    Parameters_();
+
+    void get( const RecordingBackendHDF5&, DictionaryDatum& ) const;
+    void set( const RecordingBackendHDF5&, const DictionaryDatum& );
+  };
+
+  std::string compute_filename_() const;
+  void open_file_();
+  void close_file_();
+
+  //! Create group and datasets for the given device
+  void create_datasets_( size_t node_id, const DeviceData& );
+
+  //! Create an empty extendable dataset
+  H5::DataSet create_dataset_( H5::Group&, const std::string& name, const H5::PredType& type ) const;
+
+  //! Append the buffered events of thread tid to the datasets; must not be called concurrently
+  void write_buffers_( size_t tid );
+
+  Parameters_ P_;
+
+  typedef std::vector< std::map< size_t, DeviceData > > data_map;
+  data_map device_data_;
+
+  //! Number of events buffered by each thread
+  std::vector< size_t > num_buffered_;
+
+  std::unique_ptr< H5::H5File > file_;
+  std::string current_filename_;                //!< Name of the file opened in prepare()
+  std::map< size_t, DeviceDatasets > datasets_; //!< Datasets of the devices in the current file
+  std::string write_error_;                     //!< Message of the first HDF5 error during a run
+};
+
+} // namespace
+
+#endif /* HAVE_HDF5 */
+
+#endif /* #ifndef RECORDING_BACKEND_HDF5_H */
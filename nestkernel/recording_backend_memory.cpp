@@ -20,12 +20,38 @@
  *
  */
 
+// C++ includes:
+#include <algorithm>
+
 // Includes from nestkernel:
 #include "recording_device.h"
 #include "vp_manager_impl.h"
 
 #include "recording_backend_memory.h"
 
+namespace
+{
+
+/**
+ * Append the entries of a ring buffer to a vector property, starting
+ * with the oldest entry at index first.
+ */
+template < typename DatumT, typename T >
+void
+append_ring_property( DictionaryDatum& d, const Name propname, const std::vector< T >& values, const size_t first )
+{
+  Token t = d->lookup( propname );
+  assert( not t.empty() );
+
+  DatumT* arrd = dynamic_cast< DatumT* >( t.datum() );
+  assert( arrd );
+
+  ( *arrd )->insert( ( *arrd )->end(), values.begin() + first, values.end() );
+  ( *arrd )->insert( ( *arrd )->end(), values.begin(), values.begin() + first );
+}
+
+}
+
 nest::RecordingBackendMemory::RecordingBackendMemory()
 {
 }
@@ -112,6 +138,18 @@ nest::RecordingBackendMemory::write( const RecordingDevice& device,
   device_data_[ t ][ node_id ].push_back( event, double_values, long_values );
 }
 
+void
+nest::RecordingBackendMemory::write_samples( const RecordingDevice& device,
+  const std::vector< Time >& times,
+  const std::vector< size_t >& senders,
+  const std::vector< double >& values )
+{
+  size_t t = device.get_thread();
+  size_t node_id = device.get_node_id();
+
+  device_data_[ t ][ node_id ].push_back_samples( times, senders, values );
+}
+
 void
 nest::RecordingBackendMemory::check_device_status( const DictionaryDatum& params ) const
 {
@@ -169,10 +207,25 @@ nest::RecordingBackendMemory::prepare()
   // nothing to do
 }
 
+/* ******************* Events of one sender for downsampling ******************* */
+
+nest::RecordingBackendMemory::Window::Window()
+  : count( 0 )
+  , first_steps( 0 )
+  , first_offset( 0.0 )
+  , last_steps( 0 )
+  , last_offset( 0.0 )
+{
+}
+
 /* ******************* Device meta data class DeviceInfo ******************* */
 
 nest::RecordingBackendMemory::DeviceData::DeviceData()
-  : time_in_steps_( false )
+  : capacity_( 0 )
+  , oldest_( 0 )
+  , downsampling_( Downsampling::NONE )
+  , downsampling_factor_( 1 )
+  , time_in_steps_( false )
 {
 }
 
@@ -192,6 +245,14 @@ nest::RecordingBackendMemory::DeviceData::push_back( const Event& event,
   const std::vector< double >& double_values,
   const std::vector< long >& long_values )
 {
+  if ( capacity_ > 0 or downsampling_ != Downsampling::NONE )
+  {
+    assert( double_values.size() == double_values_.size() and long_values.size() == long_values_.size() );
+    add_(
+      event.get_sender_node_id(), event.get_stamp().get_steps(), event.get_offset(), double_values.data(), long_values.data() );
+    return;
+  }
+
   senders_.push_back( event.get_sender_node_id() );
 
   if ( time_in_steps_ )
@@ -214,6 +275,174 @@ nest::RecordingBackendMemory::DeviceData::push_back( const Event& event,
   }
 }
 
+void
+nest::RecordingBackendMemory::DeviceData::push_back_samples( const std::vector< Time >& times,
+  const std::vector< size_t >& senders,
+  const std::vector< double >& values )
+{
+  const size_t num_samples = times.size() * senders.size();
+  const size_t num_values = double_values_.size();
+  assert( values.size() == num_samples * num_values );
+
+  if ( capacity_ > 0 or downsampling_ != Downsampling::NONE )
+  {
+    assert( long_values_.empty() );
+    size_t k = 0;
+    for ( const auto& time : times )
+    {
+      for ( const auto sender : senders )
+      {
+        add_( sender, time.get_steps(), 0.0, values.data() + k * num_values, nullptr );
+        ++k;
+      }
+    }
+    return;
+  }
+
+  for ( const auto& time : times )
+  {
+    senders_.insert( senders_.end(), senders.begin(), senders.end() );
+
+    if ( time_in_steps_ )
+    {
+      times_steps_.insert( times_steps_.end(), senders.size(), time.get_steps() );
+      times_offset_.insert( times_offset_.end(), senders.size(), 0.0 );
+    }
+    else
+    {
+      times_ms_.insert( times_ms_.end(), senders.size(), time.get_ms() );
+    }
+  }
+
+  // transpose the block into one column per value
+  for ( size_t i = 0; i < num_values; ++i )
+  {
+    std::vector< double >& column = double_values_[ i ];
+    const size_t begin = column.size();
+    column.resize( begin + num_samples );
+    for ( size_t k = 0; k < num_samples; ++k )
+    {
+      column[ begin + k ] = values[ k * num_values + i ];
+    }
+  }
+}
+
+void
+nest::RecordingBackendMemory::DeviceData::add_( const long sender,
+  const long steps,
+  const double offset,
+  const double* double_values,
+  const long* long_values )
+{
+  if ( downsampling_ == Downsampling::NONE )
+  {
+    store_( sender, steps, offset, double_values, long_values );
+    return;
+  }
+
+  Window& window = windows_[ sender ];
+
+  if ( downsampling_ == Downsampling::DECIMATE )
+  {
+    if ( window.count == 0 )
+    {
+      store_( sender, steps, offset, double_values, long_values );
+    }
+  }
+  else
+  {
+    const size_t num_doubles = double_values_.size();
+    const size_t num_longs = long_values_.size();
+
+    if ( window.count == 0 )
+    {
+      window.first_steps = steps;
+      window.first_offset = offset;
+      window.min.assign( double_values, double_values + num_doubles );
+      window.max.assign( double_values, double_values + num_doubles );
+      window.first_longs.assign( long_values, long_values + num_longs );
+    }
+    else
+    {
+      for ( size_t i = 0; i < num_doubles; ++i )
+      {
+        window.min[ i ] = std::min( window.min[ i ], double_values[ i ] );
+        window.max[ i ] = std::max( window.max[ i ], double_values[ i ] );
+      }
+    }
+
+    window.last_steps = steps;
+    window.last_offset = offset;
+    window.last_longs.assign( long_values, long_values + num_longs );
+  }
+
+  if ( ++window.count == downsampling_factor_ )
+  {
+    if ( downsampling_ == Downsampling::MINMAX )
+    {
+      store_( sender, window.first_steps, window.first_offset, window.min.data(), window.first_longs.data() );
+      store_( sender, window.last_steps, window.last_offset, window.max.data(), window.last_longs.data() );
+    }
+    window.count = 0;
+  }
+}
+
+void
+nest::RecordingBackendMemory::DeviceData::store_( const long sender,
+  const long steps,
+  const double offset,
+  const double* double_values,
+  const long* long_values )
+{
+  if ( capacity_ == 0 or senders_.size() < capacity_ )
+  {
+    senders_.push_back( sender );
+    if ( time_in_steps_ )
+    {
+      times_steps_.push_back( steps );
+      times_offset_.push_back( offset );
+    }
+    else
+    {
+      times_ms_.push_back( Time( Time::step( steps ) ).get_ms() - offset );
+    }
+
+    for ( size_t i = 0; i < double_values_.size(); ++i )
+    {
+      double_values_[ i ].push_back( double_values[ i ] );
+    }
+    for ( size_t i = 0; i < long_values_.size(); ++i )
+    {
+      long_values_[ i ].push_back( long_values[ i ] );
+    }
+    return;
+  }
+
+  // the ring buffer is full, overwrite the oldest event
+  const size_t i = oldest_;
+  oldest_ = ( oldest_ + 1 ) % capacity_;
+
+  senders_[ i ] = sender;
+  if ( time_in_steps_ )
+  {
+    times_steps_[ i ] = steps;
+    times_offset_[ i ] = offset;
+  }
+  else
+  {
+    times_ms_[ i ] = Time( Time::step( steps ) ).get_ms() - offset;
+  }
+
+  for ( size_t j = 0; j < double_values_.size(); ++j )
+  {
+    double_values_[ j ][ i ] = double_values[ j ];
+  }
+  for ( size_t j = 0; j < long_values_.size(); ++j )
+  {
+    long_values_[ j ][ i ] = long_values[ j ];
+  }
+}
+
 void
 nest::RecordingBackendMemory::DeviceData::get_status( DictionaryDatum& d ) const
 {
@@ -229,35 +458,53 @@ nest::RecordingBackendMemory::DeviceData::get_status( DictionaryDatum& d ) const
     events = getValue< DictionaryDatum >( d, names::events );
   }
 
+  // Events are appended directly to the vectors of the dictionary in
+  // the order in which they were stored, also if the ring buffer has
+  // wrapped around.
   initialize_property_intvector( events, names::senders );
-  append_property( events, names::senders, senders_ );
+  append_ring_property< IntVectorDatum >( events, names::senders, senders_, oldest_ );
 
   if ( time_in_steps_ )
   {
     initialize_property_intvector( events, names::times );
-    append_property( events, names::times, times_steps_ );
+    append_ring_property< IntVectorDatum >( events, names::times, times_steps_, oldest_ );
 
     initialize_property_doublevector( events, names::offsets );
-    append_property( events, names::offsets, times_offset_ );
+    append_ring_property< DoubleVectorDatum >( events, names::offsets, times_offset_, oldest_ );
   }
   else
   {
     initialize_property_doublevector( events, names::times );
-    append_property( events, names::times, times_ms_ );
+    append_ring_property< DoubleVectorDatum >( events, names::times, times_ms_, oldest_ );
   }
 
   for ( size_t i = 0; i < double_values_.size(); ++i )
   {
     initialize_property_doublevector( events, double_value_names_[ i ] );
-    append_property( events, double_value_names_[ i ], double_values_[ i ] );
+    append_ring_property< DoubleVectorDatum >( events, double_value_names_[ i ], double_values_[ i ], oldest_ );
   }
   for ( size_t i = 0; i < long_values_.size(); ++i )
   {
     initialize_property_intvector( events, long_value_names_[ i ] );
-    append_property( events, long_value_names_[ i ], long_values_[ i ] );
+    append_ring_property< IntVectorDatum >( events, long_value_names_[ i ], long_values_[ i ], oldest_ );
   }
 
   ( *d )[ names::time_in_steps ] = time_in_steps_;
+  ( *d )[ names::capacity ] = capacity_;
+
+  switch ( downsampling_ )
+  {
+  case Downsampling::NONE:
+    ( *d )[ names::downsampling ] = LiteralDatum( "none" );
+    break;
+  case Downsampling::DECIMATE:
+    ( *d )[ names::downsampling ] = LiteralDatum( "decimate" );
+    break;
+  case Downsampling::MINMAX:
+    ( *d )[ names::downsampling ] = LiteralDatum( "minmax" );
+    break;
+  }
+  ( *d )[ names::downsampling_factor ] = downsampling_factor_;
 }
 
 void
@@ -274,6 +521,62 @@ nest::RecordingBackendMemory::DeviceData::set_status( const DictionaryDatum& d )
     time_in_steps_ = time_in_steps;
   }
 
+  long capacity = capacity_;
+  if ( updateValue< long >( d, names::capacity, capacity ) )
+  {
+    if ( kernel().simulation_manager.has_been_simulated() )
+    {
+      throw BadProperty( "Property capacity cannot be set after Simulate has been called." );
+    }
+    if ( capacity < 0 )
+    {
+      throw BadProperty( "Property capacity must be >= 0." );
+    }
+
+    capacity_ = capacity;
+  }
+
+  std::string downsampling;
+  if ( updateValue< std::string >( d, names::downsampling, downsampling ) )
+  {
+    if ( kernel().simulation_manager.has_been_simulated() )
+    {
+      throw BadProperty( "Property downsampling cannot be set after Simulate has been called." );
+    }
+
+    if ( downsampling == "none" )
+    {
+      downsampling_ = Downsampling::NONE;
+    }
+    else if ( downsampling == "decimate" )
+    {
+      downsampling_ = Downsampling::DECIMATE;
+    }
+    else if ( downsampling == "minmax" )
+    {
+      downsampling_ = Downsampling::MINMAX;
+    }
+    else
+    {
+      throw BadProperty( "Property downsampling must be 'none', 'decimate' or 'minmax'." );
+    }
+  }
+
+  long downsampling_factor = downsampling_factor_;
+  if ( updateValue< long >( d, names::downsampling_factor, downsampling_factor ) )
+  {
+    if ( kernel().simulation_manager.has_been_simulated() )
+    {
+      throw BadProperty( "Property downsampling_factor cannot be set after Simulate has been called." );
+    }
+    if ( downsampling_factor < 1 )
+    {
+      throw BadProperty( "Property downsampling_factor must be >= 1." );
+    }
+
+    downsampling_factor_ = downsampling_factor;
+  }
+
   size_t n_events = 1;
   if ( updateValue< long >( d, names::n_events, n_events ) and n_events == 0 )
   {
@@ -284,6 +587,9 @@ nest::RecordingBackendMemory::DeviceData::set_status( const DictionaryDatum& d )
 void
 nest::RecordingBackendMemory::DeviceData::clear()
 {
+  oldest_ = 0;
+  windows_.clear();
+
   senders_.clear();
   times_ms_.clear();
   times_steps_.clear();
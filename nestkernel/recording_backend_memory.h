@@ -23,6 +23,10 @@
 #ifndef RECORDING_BACKEND_MEMORY_H
 #define RECORDING_BACKEND_MEMORY_H
 
+// C++ includes:
+#include <map>
+#include <vector>
+
 // Includes from nestkernel:
 #include "recording_backend.h"
 
@@ -65,6 +69,33 @@ be read out of the `n_events` entry in the status dictionary of the
 recording device. To delete data from memory, `n_events` can be set to
 0. Other values cannot be set.
 
+By default, the ``memory`` backend keeps all data until `n_events` is
+set to 0, so the memory it uses grows with the duration of the
+simulation. For long-running simulations, for instance interactive
+sessions driven through NEST Server, the memory can be bounded by
+setting ``capacity``. The backend then keeps only the most recent
+``capacity`` events of each thread in a ring buffer and silently
+discards older ones. Additionally, the data can be downsampled while it
+is recorded:
+
+- If ``downsampling`` is ``"decimate"``, only the first of each
+  ``downsampling_factor`` consecutive events of each sender is kept.
+
+- If ``downsampling`` is ``"minmax"``, each ``downsampling_factor``
+  consecutive events of a sender are replaced by two events: the first
+  has the time of the first event and contains the minimum of each
+  floating point value, the second has the time of the last event and
+  contains the maximum of each floating point value. Integer values are
+  taken from the first and the last event, respectively. This preserves
+  the envelope of fast signals, for instance of membrane potentials with
+  spikes, which is what is needed for plotting. Events of a sender are
+  only stored once ``downsampling_factor`` of them have been collected.
+
+::
+
+   >>> mm = nest.Create("multimeter", params={"record_from": ["V_m"], "capacity": 100000,
+   ...                                        "downsampling": "minmax", "downsampling_factor": 10})
+
 Parameter summary
 ~~~~~~~~~~~~~~~~~
 
@@ -80,6 +111,22 @@ n_events
     `n_events`. By setting `n_events` to 0, all events recorded so far
     will be discarded from memory.
 
+capacity
+    The maximal number of events (default: *0*) stored per thread. Once
+    it is reached, each new event replaces the oldest stored event. If
+    0, the number of stored events is not limited. This property cannot
+    be set after Simulate has been called.
+
+downsampling
+    The method used to downsample events before they are stored, either
+    ``"none"`` (default), ``"decimate"`` or ``"minmax"`` (see above). This
+    property cannot be set after Simulate has been called.
+
+downsampling_factor
+    The number of consecutive events of a sender (default: *1*) that are
+    reduced to one event (``"decimate"``) or two events (``"minmax"``).
+    This property cannot be set after Simulate has been called.
+
 time_in_steps
     A Boolean (default: *false*) specifying whether to store time in
     steps, i.e., in integer multiples of the simulation resolution
@@ -132,6 +179,11 @@ public:
 
   void write( const RecordingDevice&, const Event&, const std::vector< double >&, const std::vector< long >& ) override;
 
+  void write_samples( const RecordingDevice&,
+    const std::vector< Time >&,
+    const std::vector< size_t >&,
+    const std::vector< double >& ) override;
+
   void pre_run_hook() override;
 
   void post_run_hook() override;
@@ -147,16 +199,59 @@ public:
   void get_device_status( const RecordingDevice& device, DictionaryDatum& ) const override;
 
 private:
+  //! Methods to downsample events before storing them
+  enum class Downsampling
+  {
+    NONE,
+    DECIMATE,
+    MINMAX
+  };
+
+  /**
+   * Events of one sender collected for downsampling.
+   *
+   * Only the first event is kept for decimation, while minimum and
+   * maximum of each double value are kept for min/max downsampling.
+   */
+  struct Window
+  {
+    Window();
+
+    size_t count;                    //!< number of events collected so far
+    long first_steps;                //!< time of the first event in steps
+    double first_offset;             //!< offset of the first event
+    long last_steps;                 //!< time of the last event in steps
+    double last_offset;              //!< offset of the last event
+    std::vector< double > min;       //!< minima of the double values
+    std::vector< double > max;       //!< maxima of the double values
+    std::vector< long > first_longs; //!< long values of the first event
+    std::vector< long > last_longs;  //!< long values of the last event
+  };
+
   struct DeviceData
   {
     DeviceData();
     void set_value_names( const std::vector< Name >&, const std::vector< Name >& );
     void push_back( const Event&, const std::vector< double >&, const std::vector< long >& );
+    void push_back_samples( const std::vector< Time >&, const std::vector< size_t >&, const std::vector< double >& );
     void get_status( DictionaryDatum& ) const;
     void set_status( const DictionaryDatum& );
 
   private:
     void clear();
+
+    //! Pass a single event through downsampling
+    void add_( long sender, long steps, double offset, const double* double_values, const long* long_values );
+
+    //! Store a single event, replacing the oldest one if the capacity is reached
+    void store_( long sender, long steps, double offset, const double* double_values, const long* long_values );
+
+    size_t capacity_;                  //!< maximal number of stored events, 0 means unbounded
+    size_t oldest_;                    //!< index of the oldest stored event once the capacity is reached
+    Downsampling downsampling_;        //!< method to downsample events
+    size_t downsampling_factor_;       //!< number of events of a sender reduced by downsampling
+    std::map< long, Window > windows_; //!< events collected for downsampling, per sender
+
     std::vector< long > senders_;                        //!< sender node IDs of the events
     std::vector< double > times_ms_;                     //!< times of registered events in ms
     std::vector< long > times_steps_;                    //!< times of registered events in steps
@@ -0,0 +1,460 @@
+/*
+ *  recording_backend_statistics.cpp
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+// C++ includes:
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <set>
+
+// Includes from nestkernel:
+#include "recording_device.h"
+#include "vp_manager_impl.h"
+
+// Includes from sli:
+#include "arraydatum.h"
+#include "dictutils.h"
+
+#include "recording_backend_statistics.h"
+
+nest::RecordingBackendStatistics::RecordingBackendStatistics()
+{
+}
+
+nest::RecordingBackendStatistics::~RecordingBackendStatistics() throw()
+{
+}
+
+void
+nest::RecordingBackendStatistics::initialize()
+{
+  data_map tmp( kernel().vp_manager.get_num_threads() );
+  device_data_.swap( tmp );
+  combined_data_.clear();
+}
+
+void
+nest::RecordingBackendStatistics::finalize()
+{
+  // nothing to do
+}
+
+void
+nest::RecordingBackendStatistics::enroll( const RecordingDevice& device, const DictionaryDatum& params )
+{
+  const size_t t = device.get_thread();
+  const size_t node_id = device.get_node_id();
+
+  device_data_[ t ][ node_id ].set_status( params );
+
+  size_t n_events = 1;
+  if ( updateValue< long >( params, names::n_events, n_events ) and n_events == 0 )
+  {
+    combined_data_.erase( node_id );
+  }
+}
+
+void
+nest::RecordingBackendStatistics::disenroll( const RecordingDevice& device )
+{
+  const size_t t = device.get_thread();
+  const size_t node_id = device.get_node_id();
+
+  device_data_[ t ].erase( node_id );
+}
+
+void
+nest::RecordingBackendStatistics::set_value_names( const RecordingDevice&,
+  const std::vector< Name >&,
+  const std::vector< Name >& )
+{
+  // values of events do not enter the statistics
+}
+
+void
+nest::RecordingBackendStatistics::prepare()
+{
+  // nothing to do
+}
+
+void
+nest::RecordingBackendStatistics::cleanup()
+{
+  // nothing to do
+}
+
+void
+nest::RecordingBackendStatistics::pre_run_hook()
+{
+  for ( auto& inner : device_data_ )
+  {
+    for ( auto& device_data : inner )
+    {
+      device_data.second.bin_steps_ = Time( Time::ms( device_data.second.bin_width_ ) ).get_steps();
+    }
+  }
+}
+
+void
+nest::RecordingBackendStatistics::post_run_hook()
+{
+  // All MPI processes have instances of the same devices, so iterating
+  // over the sorted node IDs performs the same collective operations on
+  // all of them.
+  std::set< size_t > node_ids;
+  for ( const auto& inner : device_data_ )
+  {
+    for ( const auto& device_data : inner )
+    {
+      node_ids.insert( device_data.first );
+    }
+  }
+
+  const long sim_steps = kernel().simulation_manager.get_time().get_steps();
+
+  for ( const size_t node_id : node_ids )
+  {
+    DeviceData& combined = combined_data_[ node_id ];
+    combined.clear();
+
+    // combine the accumulators of all threads
+    bool first_instance = true;
+    for ( const auto& inner : device_data_ )
+    {
+      const auto device_data = inner.find( node_id );
+      if ( device_data == inner.end() )
+      {
+        continue;
+      }
+
+      const DeviceData& local = device_data->second;
+      if ( first_instance )
+      {
+        combined.bin_width_ = local.bin_width_;
+        combined.bin_steps_ = local.bin_steps_;
+
+        // the number of bins only depends on the simulated time, so it is equal on all processes
+        combined.histogram_.resize( ( sim_steps + local.bin_steps_ - 1 ) / local.bin_steps_, 0.0 );
+        first_instance = false;
+      }
+
+      assert( local.histogram_.size() <= combined.histogram_.size() );
+      for ( size_t i = 0; i < local.histogram_.size(); ++i )
+      {
+        combined.histogram_[ i ] += local.histogram_[ i ];
+      }
+
+      for ( const auto& sender : local.senders_ )
+      {
+        combined.senders_[ sender.first ].merge( sender.second );
+      }
+    }
+
+    // combine the accumulators of all MPI processes on rank 0, all other
+    // processes keep the statistics of their local events
+    if ( not combined.histogram_.empty() )
+    {
+      kernel().mpi_manager.communicate_Reduce_sum_in_place( combined.histogram_ );
+    }
+
+    std::vector< double > send_buffer;
+    send_buffer.reserve( combined.senders_.size() * SENDER_RECORD_SIZE );
+    for ( const auto& sender : combined.senders_ )
+    {
+      const SenderStatistics& stats = sender.second;
+      send_buffer.push_back( sender.first );
+      send_buffer.push_back( stats.count );
+      send_buffer.push_back( stats.first );
+      send_buffer.push_back( stats.last );
+      send_buffer.push_back( stats.n_isi );
+      send_buffer.push_back( stats.isi_mean );
+      send_buffer.push_back( stats.isi_m2 );
+    }
+
+    std::vector< double > recv_buffer;
+    kernel().mpi_manager.communicate_Gatherv( send_buffer, recv_buffer );
+    if ( kernel().mpi_manager.get_rank() != 0 )
+    {
+      continue;
+    }
+
+    combined.senders_.clear();
+    for ( auto it = recv_buffer.begin(); it != recv_buffer.end(); it += SENDER_RECORD_SIZE )
+    {
+      SenderStatistics stats;
+      stats.count = static_cast< long >( it[ 1 ] );
+      stats.first = it[ 2 ];
+      stats.last = it[ 3 ];
+      stats.n_isi = static_cast< long >( it[ 4 ] );
+      stats.isi_mean = it[ 5 ];
+      stats.isi_m2 = it[ 6 ];
+      combined.senders_[ static_cast< size_t >( it[ 0 ] ) ].merge( stats );
+    }
+  }
+}
+
+void
+nest::RecordingBackendStatistics::post_step_hook()
+{
+  // nothing to do
+}
+
+void
+nest::RecordingBackendStatistics::write( const RecordingDevice& device,
+  const Event& event,
+  const std::vector< double >&,
+  const std::vector< long >& )
+{
+  const size_t t = device.get_thread();
+  const size_t node_id = device.get_node_id();
+
+  const auto device_data = device_data_[ t ].find( node_id );
+  if ( device_data != device_data_[ t ].end() )
+  {
+    device_data->second.add( event );
+  }
+}
+
+void
+nest::RecordingBackendStatistics::set_status( const DictionaryDatum& )
+{
+  // nothing to do
+}
+
+void
+nest::RecordingBackendStatistics::get_status( DictionaryDatum& ) const
+{
+  // nothing to do
+}
+
+void
+nest::RecordingBackendStatistics::check_device_status( const DictionaryDatum& params ) const
+{
+  DeviceData dd;
+  dd.set_status( params ); // throws if params contains invalid entries
+}
+
+void
+nest::RecordingBackendStatistics::get_device_defaults( DictionaryDatum& params ) const
+{
+  DeviceData dd;
+  dd.get_status( params );
+}
+
+void
+nest::RecordingBackendStatistics::get_device_status( const RecordingDevice& device, DictionaryDatum& d ) const
+{
+  const size_t t = device.get_thread();
+  const size_t node_id = device.get_node_id();
+
+  const auto device_data = device_data_[ t ].find( node_id );
+  if ( device_data == device_data_[ t ].end() )
+  {
+    return;
+  }
+
+  device_data->second.get_status( d );
+
+  // The combined statistics are only reported once, by the instance on thread 0
+  if ( t == 0 )
+  {
+    const auto combined = combined_data_.find( node_id );
+    if ( combined != combined_data_.end() )
+    {
+      combined->second.get_statistics( d );
+    }
+    else
+    {
+      DeviceData().get_statistics( d );
+    }
+  }
+}
+
+/* ******************* Accumulators of one sender ******************* */
+
+nest::RecordingBackendStatistics::SenderStatistics::SenderStatistics()
+  : count( 0 )
+  , first( 0.0 )
+  , last( 0.0 )
+  , n_isi( 0 )
+  , isi_mean( 0.0 )
+  , isi_m2( 0.0 )
+{
+}
+
+void
+nest::RecordingBackendStatistics::SenderStatistics::add( const double time )
+{
+  if ( count == 0 )
+  {
+    first = time;
+  }
+  else
+  {
+    const double isi = time - last;
+    ++n_isi;
+    const double delta = isi - isi_mean;
+    isi_mean += delta / n_isi;
+    isi_m2 += delta * ( isi - isi_mean );
+  }
+
+  last = time;
+  ++count;
+}
+
+void
+nest::RecordingBackendStatistics::SenderStatistics::merge( const SenderStatistics& other )
+{
+  if ( other.count == 0 )
+  {
+    return;
+  }
+  if ( count == 0 )
+  {
+    *this = other;
+    return;
+  }
+
+  // Only reached if events of the same sender are recorded by several
+  // instances of the device. The interval between the last event of one
+  // instance and the first event of the other is then not taken into account.
+  count += other.count;
+  first = std::min( first, other.first );
+  last = std::max( last, other.last );
+
+  // combine the moments with the pairwise algorithm of Chan et al.
+  const long n = n_isi + other.n_isi;
+  if ( n > 0 )
+  {
+    const double delta = other.isi_mean - isi_mean;
+    isi_m2 += other.isi_m2 + delta * delta * n_isi * other.n_isi / n;
+    isi_mean += delta * other.n_isi / n;
+  }
+  n_isi = n;
+}
+
+/* ******************* Accumulators of one device ******************* */
+
+nest::RecordingBackendStatistics::DeviceData::DeviceData()
+  : bin_width_( 10.0 )
+  , bin_steps_( 1 )
+{
+}
+
+void
+nest::RecordingBackendStatistics::DeviceData::add( const Event& event )
+{
+  // An event with time stamp s occurred in the interval ( s - 1, s ] in steps
+  const long steps = event.get_stamp().get_steps();
+  const size_t bin = std::max( steps - 1, 0L ) / bin_steps_;
+  if ( bin >= histogram_.size() )
+  {
+    histogram_.resize( bin + 1, 0.0 );
+  }
+  histogram_[ bin ] += 1.0;
+
+  senders_[ event.get_sender_node_id() ].add( event.get_stamp().get_ms() - event.get_offset() );
+}
+
+void
+nest::RecordingBackendStatistics::DeviceData::clear()
+{
+  histogram_.clear();
+  senders_.clear();
+}
+
+void
+nest::RecordingBackendStatistics::DeviceData::get_status( DictionaryDatum& d ) const
+{
+  ( *d )[ names::bin_width ] = bin_width_;
+}
+
+void
+nest::RecordingBackendStatistics::DeviceData::set_status( const DictionaryDatum& d )
+{
+  double bin_width = bin_width_;
+  if ( updateValue< double >( d, names::bin_width, bin_width ) )
+  {
+    if ( kernel().simulation_manager.has_been_simulated() )
+    {
+      throw BadProperty( "Property bin_width cannot be set after Simulate has been called." );
+    }
+
+    const Time bin_time = Time( Time::ms( bin_width ) );
+    if ( bin_time < Time::get_resolution() or not bin_time.is_multiple_of( Time::get_resolution() ) )
+    {
+      throw BadProperty( "The bin width must be a positive multiple of the simulation resolution." );
+    }
+
+    bin_width_ = bin_width;
+  }
+
+  size_t n_events = 1;
+  if ( updateValue< long >( d, names::n_events, n_events ) and n_events == 0 )
+  {
+    clear();
+  }
+}
+
+void
+nest::RecordingBackendStatistics::DeviceData::get_statistics( DictionaryDatum& d ) const
+{
+  DictionaryDatum statistics( new Dictionary );
+
+  std::vector< long > histogram( histogram_.begin(), histogram_.end() );
+  ( *statistics )[ names::histogram ] = IntVectorDatum( new std::vector< long >( histogram ) );
+
+  std::vector< long > senders;
+  std::vector< long > spike_counts;
+  std::vector< double > first_spike_times;
+  std::vector< double > last_spike_times;
+  std::vector< double > isi_mean;
+  std::vector< double > isi_cv;
+  for ( const auto& sender : senders_ )
+  {
+    const SenderStatistics& stats = sender.second;
+    senders.push_back( sender.first );
+    spike_counts.push_back( stats.count );
+    first_spike_times.push_back( stats.first );
+    last_spike_times.push_back( stats.last );
+
+    if ( stats.n_isi > 0 )
+    {
+      isi_mean.push_back( stats.isi_mean );
+      isi_cv.push_back( std::sqrt( stats.isi_m2 / stats.n_isi ) / stats.isi_mean );
+    }
+    else
+    {
+      isi_mean.push_back( std::numeric_limits< double >::quiet_NaN() );
+      isi_cv.push_back( std::numeric_limits< double >::quiet_NaN() );
+    }
+  }
+
+  ( *statistics )[ names::senders ] = IntVectorDatum( new std::vector< long >( senders ) );
+  ( *statistics )[ names::spike_counts ] = IntVectorDatum( new std::vector< long >( spike_counts ) );
+  ( *statistics )[ names::first_spike_times ] = DoubleVectorDatum( new std::vector< double >( first_spike_times ) );
+  ( *statistics )[ names::last_spike_times ] = DoubleVectorDatum( new std::vector< double >( last_spike_times ) );
+  ( *statistics )[ names::isi_mean ] = DoubleVectorDatum( new std::vector< double >( isi_mean ) );
+  ( *statistics )[ names::isi_cv ] = DoubleVectorDatum( new std::vector< double >( isi_cv ) );
+
+  ( *d )[ names::statistics ] = statistics;
+}
@@ -0,0 +1,225 @@
+/*
+ *  recording_backend_statistics.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef RECORDING_BACKEND_STATISTICS_H
+#define RECORDING_BACKEND_STATISTICS_H
+
+// C++ includes:
+#include <map>
+#include <vector>
+
+#include "recording_backend.h"
+
+/* BeginUserDocs: NOINDEX
+
+Recording backend `statistics` - Aggregate spike statistics in memory
+---------------------------------------------------------------------
+
+Description
+~~~~~~~~~~~
+
+The `statistics` recording backend does not store individual events.
+Instead, it updates a set of aggregate statistics for every recorded
+event. It is meant for studies which only need population rates,
+spike counts or the regularity of firing, for instance parameter
+scans, and where storing every spike would produce large amounts of
+data.
+
+For each recording device, the backend computes
+
+* a histogram of the number of events in bins of width ``bin_width``,
+  starting at time 0 (the peri-stimulus time histogram of the recorded
+  population)
+* the number of events of each sender
+* the times of the first and the last event of each sender
+* the mean and the coefficient of variation of the inter-spike
+  intervals of each sender
+
+Each thread updates its own accumulators while the simulation runs.
+At the end of each call to ``Run``, the accumulators of all threads
+are combined and those of all MPI processes are reduced to the MPI
+process with rank 0. Only there, the ``statistics`` of the device cover
+all recorded senders. On all other MPI processes, they cover the events
+recorded locally. The per-sender accumulators amount to seven numbers
+per sender, which are sent to rank 0 only, so that the memory needed
+on the other processes does not grow with the total number of senders.
+Statistics accumulate over all calls to ``Simulate`` or ``Run``. They can be reset by setting the property
+``n_events`` of the recording device to 0.
+
+::
+
+   >>> sr = nest.Create("spike_recorder", params={"record_to": "statistics", "bin_width": 5.0})
+   >>> nest.Connect(neurons, sr)
+   >>> nest.Simulate(1000.0)
+   >>> rate = sr.statistics["histogram"] / (len(neurons) * 5.0e-3)
+
+The inter-spike intervals of a sender are computed from its events in
+the order in which they are recorded. As events are delivered in
+temporal order, this gives the correct intervals for all devices
+recording spikes.
+
+Recorder-specific parameters
+~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+bin_width
+    The width of the bins of the histogram in ms (default: *10.0*).
+    It must be a multiple of the simulation resolution and cannot be
+    changed after ``Simulate`` has been called.
+
+statistics
+    A dictionary with the statistics gathered so far. This is a
+    read-only property with the following entries:
+
+    histogram
+        The number of events in each bin. Bin ``i`` contains the events
+        with times in the interval (``i * bin_width``, ``(i + 1) * bin_width``].
+
+    senders
+        The node IDs of the senders, in ascending order. All other
+        entries listed below give one value per sender in this order.
+
+    spike_counts
+        The number of events of each sender.
+
+    first_spike_times, last_spike_times
+        The times of the first and the last event of each sender in ms.
+
+    isi_mean, isi_cv
+        The mean in ms and the coefficient of variation of the
+        inter-spike intervals of each sender. Both are *NaN* for senders
+        with less than two events.
+
+EndUserDocs */
+
+namespace nest
+{
+
+/**
+ * Statistics specialization of the RecordingBackend interface.
+ *
+ * RecordingBackendStatistics keeps one set of accumulators per
+ * recording device instance, i.e., per device and thread, which are
+ * updated in write() without synchronization. In post_run_hook(), the
+ * accumulators of all threads are combined and reduced to rank 0.
+ * Histograms are summed up by a reduce, while the per-sender
+ * accumulators are gathered on rank 0 and merged there. The combined
+ * statistics are returned as status of the device instance on thread 0.
+ */
+class RecordingBackendStatistics : public RecordingBackend
+{
+public:
+  RecordingBackendStatistics();
+
+  ~RecordingBackendStatistics() throw() override;
+
+  void initialize() override;
+
+  void finalize() override;
+
+  void enroll( const RecordingDevice& device, const DictionaryDatum& params ) override;
+
+  void disenroll( const RecordingDevice& device ) override;
+
+  void set_value_names( const RecordingDevice& device,
+    const std::vector< Name >& double_value_names,
+    const std::vector< Name >& long_value_names ) override;
+
+  void prepare() override;
+
+  void cleanup() override;
+
+  /**
+   * Convert the bin widths of all devices to steps
+   */
+  void pre_run_hook() override;
+
+  /**
+   * Combine the accumulators of all threads and MPI processes
+   */
+  void post_run_hook() override;
+
+  void post_step_hook() override;
+
+  void write( const RecordingDevice&, const Event&, const std::vector< double >&, const std::vector< long >& ) override;
+
+  void set_status( const DictionaryDatum& ) override;
+  void get_status( DictionaryDatum& ) const override;
+
+  void check_device_status( const DictionaryDatum& ) const override;
+  void get_device_defaults( DictionaryDatum& ) const override;
+  void get_device_status( const RecordingDevice& device, DictionaryDatum& ) const override;
+
+private:
+  /**
+   * Accumulators for the events of one sender.
+   *
+   * The moments of the inter-spike intervals are updated with
+   * Welford's algorithm.
+   */
+  struct SenderStatistics
+  {
+    SenderStatistics();
+
+    void add( double time );
+
+    //! Combine with the accumulators of the same sender recorded elsewhere
+    void merge( const SenderStatistics& );
+
+    long count;      //!< number of events
+    double first;    //!< time of the first event in ms
+    double last;     //!< time of the last event in ms
+    long n_isi;      //!< number of inter-spike intervals
+    double isi_mean; //!< mean of the inter-spike intervals in ms
+    double isi_m2;   //!< sum of squared deviations of the inter-spike intervals from their mean
+  };
+
+  //! Number of doubles per sender when exchanging accumulators between MPI processes
+  static const size_t SENDER_RECORD_SIZE = 7;
+
+  struct DeviceData
+  {
+    DeviceData();
+    void add( const Event& );
+    void clear();
+    void get_status( DictionaryDatum& ) const;
+    void set_status( const DictionaryDatum& );
+
+    //! Write the statistics to the entry statistics of the given dictionary
+    void get_statistics( DictionaryDatum& ) const;
+
+    double bin_width_; //!< width of the histogram bins in ms
+    long bin_steps_;   //!< width of the histogram bins in steps, set in pre_run_hook()
+
+    std::vector< double > histogram_;              //!< number of events per bin
+    std::map< size_t, SenderStatistics > senders_; //!< accumulators per sender
+  };
+
+  typedef std::vector< std::map< size_t, DeviceData > > data_map;
+  data_map device_data_;
+
+  //! Statistics of each device combined across threads and MPI processes in post_run_hook()
+  std::map< size_t, DeviceData > combined_data_;
+};
+
+} // namespace
+
+#endif /* #ifndef RECORDING_BACKEND_STATISTICS_H */
@@ -216,3 +216,12 @@ nest::RecordingDevice::write( const Event& event,
   kernel().io_manager.write( P_.record_to_, *this, event, double_values, long_values );
   S_.n_events_++;
 }
+
+void
+nest::RecordingDevice::write_samples( const std::vector< Time >& times,
+  const std::vector< size_t >& senders,
+  const std::vector< double >& values )
+{
+  kernel().io_manager.write_samples( P_.record_to_, *this, times, senders, values );
+  S_.n_events_ += times.size() * senders.size();
+}
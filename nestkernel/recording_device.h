@@ -177,6 +177,11 @@ public:
 
 protected:
   void write( const Event&, const std::vector< double >&, const std::vector< long >& );
+
+  /**
+   * Write a block of samples, stored in the order time × sender × value.
+   */
+  void write_samples( const std::vector< Time >&, const std::vector< size_t >&, const std::vector< double >& );
   void set_initialized_() override;
 
 private:
@@ -140,6 +140,17 @@ public:
     return buffer_.size();
   }
 
+  /**
+   * Returns pointer to the bin of slot 0, for direct spike input.
+   *
+   * @see SpikeInputBuffer
+   */
+  double*
+  data()
+  {
+    return buffer_.data();
+  }
+
 private:
   //! Buffered data
   std::vector< double > buffer_;
@@ -382,6 +393,14 @@ public:
 
   size_t size() const;
 
+  /**
+   * Returns pointer to channel 0 of slot 0, for direct spike input.
+   *
+   * Slots are stored contiguously, num_channels values per slot.
+   * @see SpikeInputBuffer
+   */
+  double* data();
+
 private:
   /**
    * Buffered data stored in a vector of arrays of double values
@@ -422,6 +441,15 @@ MultiChannelInputBuffer< num_channels >::size() const
   return buffer_.size();
 }
 
+template < unsigned int num_channels >
+inline double*
+MultiChannelInputBuffer< num_channels >::data()
+{
+  static_assert( sizeof( std::array< double, num_channels > ) == num_channels * sizeof( double ) );
+  assert( not buffer_.empty() );
+  return buffer_.front().data();
+}
+
 } // namespace nest
 
 
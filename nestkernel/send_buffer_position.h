@@ -24,6 +24,7 @@
 #define SEND_BUFFER_POSITION_H
 
 // C++ includes:
+#include <algorithm>
 #include <cassert>
 #include <limits>
 #include <vector>
@@ -71,6 +72,12 @@ public:
   bool is_chunk_filled( const size_t rank ) const;
 
   void increase( const size_t rank );
+
+  /**
+   * Increase index for specified rank by given number of entries, but not
+   * beyond the end of the part of the buffer for rank.
+   */
+  void increase( const size_t rank, const size_t num_entries );
 };
 
 inline size_t
@@ -103,6 +110,12 @@ SendBufferPosition::increase( const size_t rank )
   ++idx_[ rank ];
 }
 
+inline void
+SendBufferPosition::increase( const size_t rank, const size_t num_entries )
+{
+  idx_[ rank ] = std::min( idx_[ rank ] + num_entries, end_[ rank ] );
+}
+
 
 /**
  * This class simplifies keeping track of write position in MPI buffer
@@ -56,6 +56,7 @@ nest::SimulationManager::SimulationManager()
   , inconsistent_state_( false )
   , print_time_( false )
   , use_wfr_( true )
+  , use_population_update_( false )
   , wfr_comm_interval_( 1.0 )
   , wfr_tol_( 0.0001 )
   , wfr_max_iterations_( 15 )
@@ -96,6 +97,7 @@ nest::SimulationManager::initialize( const bool adjust_number_of_threads_or_rng_
   inconsistent_state_ = false;
   print_time_ = false;
   use_wfr_ = true;
+  use_population_update_ = false;
 
   wfr_comm_interval_ = 1.0;
   wfr_tol_ = 0.0001;
@@ -173,6 +175,16 @@ nest::SimulationManager::set_status( const DictionaryDatum& d )
 
   updateValue< bool >( d, names::print_time, print_time_ );
 
+  bool use_population_update;
+  if ( updateValue< bool >( d, names::use_population_update, use_population_update ) )
+  {
+    if ( simulating_ )
+    {
+      throw KernelException( "Population update cannot be enabled or disabled during simulation." );
+    }
+    use_population_update_ = use_population_update;
+  }
+
   // tics_per_ms and resolution must come after local_num_thread /
   // total_num_threads because they might reset the network and the time
   // representation
@@ -464,6 +476,7 @@ nest::SimulationManager::get_status( DictionaryDatum& d )
 
   def< bool >( d, names::prepared, prepared_ );
 
+  def< bool >( d, names::use_population_update, use_population_update_ );
   def< bool >( d, names::use_wfr, use_wfr_ );
   def< double >( d, names::wfr_comm_interval, wfr_comm_interval_ );
   def< double >( d, names::wfr_tol, wfr_tol_ );
@@ -518,6 +531,30 @@ nest::SimulationManager::prepare()
   // find shortest and longest delay across all MPI processes
   // this call sets the member variables
   kernel().connection_manager.update_delay_extrema_();
+
+  if ( kernel().event_delivery_manager.use_pipelined_spike_exchange() )
+  {
+    // Spikes are delivered one slice later than usual, so all delays must span at least two slices.
+    const bool delays_too_short = 2 * kernel().connection_manager.get_min_delay()
+      > kernel().connection_manager.get_min_delay_time_().get_steps();
+    if ( kernel().mpi_manager.any_true( delays_too_short ) )
+    {
+      throw KernelException( "Pipelined spike exchange requires a minimal delay of at least two time steps." );
+    }
+
+    if ( kernel().event_delivery_manager.get_off_grid_communication()
+      or kernel().mpi_manager.any_true( kernel().connection_manager.secondary_connections_exist() ) )
+    {
+      throw KernelException(
+        "Pipelined spike exchange cannot be combined with precise spike times or secondary events." );
+    }
+
+    if ( kernel().event_delivery_manager.use_sparse_spike_exchange() )
+    {
+      throw KernelException( "Pipelined spike exchange cannot be combined with sparse spike exchange." );
+    }
+  }
+
   kernel().event_delivery_manager.init_moduli();
 
   // if at the beginning of a simulation, set up spike buffers
@@ -528,6 +565,7 @@ nest::SimulationManager::prepare()
 
   kernel().node_manager.ensure_valid_thread_local_ids();
   kernel().node_manager.prepare_nodes();
+  kernel().event_delivery_manager.register_spike_input_buffers();
 
   // we have to do enter_runtime after prepare_nodes, since we use
   // calibrate to map the ports of MUSIC devices, which has to be done
@@ -619,6 +657,11 @@ nest::SimulationManager::run( Time const& t )
 
   kernel().io_manager.pre_run_hook();
 
+  if ( use_population_update_ )
+  {
+    kernel().node_manager.prepare_population_update();
+  }
+
   // Reset local spike counters within event_delivery_manager
   kernel().event_delivery_manager.reset_counters();
 
@@ -649,6 +692,14 @@ nest::SimulationManager::run( Time const& t )
 
   call_update_();
 
+  // do not leave MPI communication pending between runs
+  kernel().event_delivery_manager.complete_pending_spike_exchange();
+
+  if ( use_population_update_ )
+  {
+    kernel().node_manager.finalize_population_update();
+  }
+
   kernel().io_manager.post_run_hook();
   kernel().random_manager.check_rng_synchrony();
 
@@ -740,9 +791,15 @@ nest::SimulationManager::update_connection_infrastructure( const size_t tid )
 
   sw_communicate_prepare_.start();
 
+#pragma omp single
+  {
+    kernel().connection_manager.determine_incremental_update();
+  } // of omp single; implicit barrier
+
   kernel().connection_manager.sort_connections( tid );
   sw_gather_target_data_.start();
   kernel().connection_manager.restructure_connection_tables( tid );
+  kernel().connection_manager.compress_source_table( tid );
   kernel().connection_manager.collect_compressed_spike_data( tid );
   sw_gather_target_data_.stop();
 
@@ -800,6 +857,8 @@ nest::SimulationManager::update_connection_infrastructure( const size_t tid )
 
   sw_gather_target_data_.stop();
 
+  kernel().connection_manager.set_connections_communicated( tid );
+
   if ( kernel().connection_manager.secondary_connections_exist() )
   {
     kernel().connection_manager.compress_secondary_send_buffer_pos( tid );
@@ -1037,24 +1096,52 @@ nest::SimulationManager::update_()
         } // of structural plasticity
 
         sw_update_.start();
-        const SparseNodeArray& thread_local_nodes = kernel().node_manager.get_local_nodes( tid );
-
-        for ( SparseNodeArray::const_iterator n = thread_local_nodes.begin(); n != thread_local_nodes.end(); ++n )
+        if ( use_population_update_ )
+        {
+          // frozen nodes are not included in the schedule
+          for ( const UpdateScheduleEntry& entry : kernel().node_manager.get_update_schedule( tid ) )
+          {
+            if ( entry.population )
+            {
+              entry.population->update( clock_, from_step_, to_step_ );
+            }
+            else
+            {
+              entry.node->update( clock_, from_step_, to_step_ );
+            }
+          }
+        }
+        else
         {
-          Node* node = n->get_node();
-          if ( not( node )->is_frozen() )
+          const SparseNodeArray& thread_local_nodes = kernel().node_manager.get_local_nodes( tid );
+
+          for ( SparseNodeArray::const_iterator n = thread_local_nodes.begin(); n != thread_local_nodes.end(); ++n )
           {
-            ( node )->update( clock_, from_step_, to_step_ );
+            Node* node = n->get_node();
+            if ( not( node )->is_frozen() )
+            {
+              ( node )->update( clock_, from_step_, to_step_ );
+            }
           }
         }
 
         sw_update_.stop();
 
+        // evaluate before the barrier, since the master thread advances time afterwards
+        const bool end_of_slice_with_spikes = to_step_ == kernel().connection_manager.get_min_delay()
+          and kernel().connection_manager.has_primary_connections();
+
         // parallel section ends, wait until all threads are done -> synchronize
         kernel().get_omp_synchronization_simulation_stopwatch().start();
 #pragma omp barrier
         kernel().get_omp_synchronization_simulation_stopwatch().stop();
 
+        // all threads collocate their spikes before the master thread communicates them
+        if ( end_of_slice_with_spikes )
+        {
+          kernel().event_delivery_manager.collocate_spike_data( tid );
+        }
+
         // the following block is executed by the master thread only
         // the other threads are enforced to wait at the end of the block
 #pragma omp master
@@ -1095,8 +1182,8 @@ nest::SimulationManager::update_()
 // end of master section, all threads have to synchronize at this point
 #pragma omp barrier
 
-        // if block to avoid omp barrier if SIONLIB is not used
-#ifdef HAVE_SIONLIB
+        // if block to avoid omp barrier if neither SIONLIB nor HDF5 is used
+#if defined( HAVE_SIONLIB ) or defined( HAVE_HDF5 )
         kernel().io_manager.post_step_hook();
         // enforce synchronization after post-step activities of the recording backends
         kernel().get_omp_synchronization_simulation_stopwatch().start();
@@ -90,6 +90,11 @@ public:
    */
   bool use_wfr() const;
 
+  /**
+   * Returns true if nodes are updated through population kernels.
+   */
+  bool use_population_update() const;
+
   /**
    * Get the desired communication interval for the waveform relaxation
    */
@@ -215,6 +220,8 @@ private:
   bool print_time_;                //!< Indicates whether time should be printed during
                                    //!< simulations (or not)
   bool use_wfr_;                   //!< Indicates wheter waveform relaxation is used
+  bool use_population_update_;     //!< Update homogeneous runs of nodes through
+                                   //!< population kernels
   double wfr_comm_interval_;       //!< Desired waveform relaxation communication
                                    //!< interval (in ms)
   double wfr_tol_;                 //!< Convergence tolerance of waveform relaxation method
@@ -318,6 +325,12 @@ SimulationManager::use_wfr() const
   return use_wfr_;
 }
 
+inline bool
+SimulationManager::use_population_update() const
+{
+  return use_population_update_;
+}
+
 inline double
 SimulationManager::get_wfr_comm_interval() const
 {
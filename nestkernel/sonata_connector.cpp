@@ -26,7 +26,8 @@
 #ifdef HAVE_HDF5
 
 // C++ includes:
-#include <cstdlib> // for div()
+#include <algorithm>
+#include <future>
 
 // Includes from nestkernel:
 #include "kernel_manager.h"
@@ -146,8 +147,10 @@ SonataConnector::connect()
       get_attribute_( source_attribute_value_, src_node_id_dset_, "node_population" );
       get_attribute_( target_attribute_value_, tgt_node_id_dset_, "node_population" );
 
-      // Read datasets sequentially in chunks and connect
-      sequential_chunkwise_connector_();
+      get_population_node_collections_();
+
+      // Read datasets in chunks and connect
+      chunkwise_connector_( pop_grp );
 
       close_dsets_();
 
@@ -347,95 +350,223 @@ SonataConnector::close_dsets_()
 }
 
 void
-SonataConnector::sequential_chunkwise_connector_()
+SonataConnector::get_population_node_collections_()
 {
-  // Retrieve number of connections described by datasets
-  const auto num_conn = get_nrows_( tgt_node_id_dset_ );
+  // Retrieve the correct NodeCollections
+  const auto nest_nodes = getValue< DictionaryDatum >( graph_specs_->lookup( "nodes" ) );
 
-  //  Adjust if hyperslab (chunk) size is too large
-  if ( num_conn < hyperslab_size_ )
+  try
   {
-    hyperslab_size_ = num_conn;
+    src_nc_ = getValue< NodeCollectionPTR >( nest_nodes->lookup( source_attribute_value_ ) );
   }
-
-  // organize chunks; dv.quot = integral quotient, dv.rem = reaminder
-  auto dv = std::div( static_cast< long long >( num_conn ), static_cast< long long >( hyperslab_size_ ) );
-
-  // Iterate chunks
-  hsize_t offset = 0; // start coordinates of data selection
-  for ( long long i = 0; i < dv.quot; i++ )
+  catch ( const TypeMismatch& e )
   {
-    connect_chunk_( hyperslab_size_, offset );
-    offset += hyperslab_size_;
+    throw KernelException(
+      "Unable to find source node population '" + source_attribute_value_ + "' in node collection dictionary. Error caused "
+      "by the population name specified by attribute of source_node_id dataset in "
+      + cur_fname_ );
   }
 
-  // Handle remainder
-  if ( dv.rem > 0 )
+  try
+  {
+    tgt_nc_ = getValue< NodeCollectionPTR >( nest_nodes->lookup( target_attribute_value_ ) );
+  }
+  catch ( const TypeMismatch& e )
   {
-    connect_chunk_( dv.rem, offset );
+    throw KernelException(
+      "Unable to find target node population '" + target_attribute_value_ + "' in node collection dictionary. Error caused "
+      "by the population name specified by attribute of target_node_id dataset in "
+      + cur_fname_ );
   }
 }
 
-void
-SonataConnector::connect_chunk_( const hsize_t hyperslab_size, const hsize_t offset )
+std::vector< SonataConnector::EdgeRange >
+SonataConnector::get_local_edge_ranges_( const H5::Group* pop_grp )
 {
+  // Retrieve number of connections described by datasets
+  const auto num_conn = get_nrows_( tgt_node_id_dset_ );
 
-  // Read subsets
-  std::vector< unsigned long > src_node_id_data_subset( hyperslab_size );
-  std::vector< unsigned long > tgt_node_id_data_subset( hyperslab_size );
-  std::vector< unsigned long > edge_type_id_data_subset( hyperslab_size );
-  std::vector< double > syn_weight_data_subset;
-  std::vector< double > delay_data_subset;
+  const bool have_index = H5Lexists( pop_grp->getId(), "indices", H5P_DEFAULT ) > 0
+    and H5Lexists( pop_grp->getId(), "indices/target_to_source", H5P_DEFAULT ) > 0;
+  if ( not have_index )
+  {
+    return { EdgeRange( 0, num_conn ) };
+  }
 
-  read_subset_( src_node_id_dset_, src_node_id_data_subset, H5::PredType::NATIVE_LONG, hyperslab_size, offset );
-  read_subset_( tgt_node_id_dset_, tgt_node_id_data_subset, H5::PredType::NATIVE_LONG, hyperslab_size, offset );
-  read_subset_( edge_type_id_dset_, edge_type_id_data_subset, H5::PredType::NATIVE_LONG, hyperslab_size, offset );
+  const auto index_grp = open_group_( pop_grp, "indices/target_to_source" );
+  H5::DataSet node_id_to_range_dset;
+  H5::DataSet range_to_edge_id_dset;
+  try
+  {
+    node_id_to_range_dset = index_grp->openDataSet( "node_id_to_range" );
+    range_to_edge_id_dset = index_grp->openDataSet( "range_to_edge_id" );
+  }
+  catch ( const H5::Exception& e )
+  {
+    throw KernelException(
+      "Could not open target_to_source index datasets in " + cur_fname_ + ": " + e.getDetailMsg() );
+  }
+
+  // Row i of node_id_to_range holds the rows of range_to_edge_id for SONATA target id i, and each
+  // row of range_to_edge_id holds a range of edge ids.
+  const auto node_id_to_range = read_index_dataset_( node_id_to_range_dset );
+  const auto range_to_edge_id = read_index_dataset_( range_to_edge_id_dset );
+  const size_t num_ranges = range_to_edge_id.size() / 2;
+  node_id_to_range_dset.close();
+  range_to_edge_id_dset.close();
+  index_grp->close();
+  delete index_grp;
+
+  std::vector< EdgeRange > ranges;
+  const size_t num_targets = std::min( node_id_to_range.size() / 2, tgt_nc_->size() );
+  const auto tnode_begin = tgt_nc_->begin();
+  for ( size_t sonata_tgt_id = 0; sonata_tgt_id < num_targets; ++sonata_tgt_id )
+  {
+    const size_t tnode_id = ( *( tnode_begin + sonata_tgt_id ) ).node_id;
+    if ( not kernel().node_manager.is_local_node_id( tnode_id ) )
+    {
+      continue;
+    }
 
-  if ( weight_dataset_exist_ )
+    const hsize_t first_range = node_id_to_range[ 2 * sonata_tgt_id ];
+    const hsize_t last_range = node_id_to_range[ 2 * sonata_tgt_id + 1 ];
+    if ( last_range > num_ranges )
+    {
+      throw KernelException( "Invalid target_to_source index in " + cur_fname_ + ": range out of bounds" );
+    }
+
+    for ( hsize_t r = first_range; r < last_range; ++r )
+    {
+      const hsize_t first_edge = range_to_edge_id[ 2 * r ];
+      const hsize_t last_edge = range_to_edge_id[ 2 * r + 1 ];
+      if ( first_edge > last_edge or last_edge > num_conn )
+      {
+        throw KernelException( "Invalid target_to_source index in " + cur_fname_ + ": edge id out of bounds" );
+      }
+      if ( first_edge < last_edge )
+      {
+        ranges.emplace_back( first_edge, last_edge );
+      }
+    }
+  }
+
+  // Read edges in the order in which they are stored, so that connections are created in the same order as
+  // without index, and merge adjacent ranges into single hyperslabs
+  std::sort( ranges.begin(), ranges.end() );
+  std::vector< EdgeRange > merged_ranges;
+  for ( const auto& range : ranges )
   {
-    syn_weight_data_subset.resize( hyperslab_size );
-    read_subset_( syn_weight_dset_, syn_weight_data_subset, H5::PredType::NATIVE_DOUBLE, hyperslab_size, offset );
+    if ( not merged_ranges.empty() and range.first <= merged_ranges.back().second )
+    {
+      merged_ranges.back().second = std::max( merged_ranges.back().second, range.second );
+    }
+    else
+    {
+      merged_ranges.push_back( range );
+    }
   }
-  if ( delay_dataset_exist_ )
+
+  return merged_ranges;
+}
+
+std::vector< std::vector< SonataConnector::EdgeRange > >
+SonataConnector::partition_edge_ranges_( const std::vector< EdgeRange >& ranges ) const
+{
+  std::vector< std::vector< EdgeRange > > chunks;
+  hsize_t chunk_size = hyperslab_size_; // forces new chunk for first range
+
+  for ( auto range : ranges )
   {
-    delay_data_subset.resize( hyperslab_size );
-    read_subset_( delay_dset_, delay_data_subset, H5::PredType::NATIVE_DOUBLE, hyperslab_size, offset );
+    while ( range.first < range.second )
+    {
+      if ( chunk_size == hyperslab_size_ )
+      {
+        chunks.emplace_back();
+        chunk_size = 0;
+      }
+
+      const hsize_t n = std::min( range.second - range.first, hyperslab_size_ - chunk_size );
+      chunks.back().emplace_back( range.first, range.first + n );
+      chunk_size += n;
+      range.first += n;
+    }
   }
 
-  std::vector< std::shared_ptr< WrappedThreadException > > exceptions_raised_( kernel().vp_manager.get_num_threads() );
+  return chunks;
+}
 
-  // Retrieve the correct NodeCollections
-  const auto nest_nodes = getValue< DictionaryDatum >( graph_specs_->lookup( "nodes" ) );
+void
+SonataConnector::chunkwise_connector_( const H5::Group* pop_grp )
+{
+  const auto chunks = partition_edge_ranges_( get_local_edge_ranges_( pop_grp ) );
+  if ( chunks.empty() )
+  {
+    return;
+  }
 
-  NodeCollectionPTR src_nc;
+  // Double buffering: while connections are created from one buffer, the next chunk is read into the other.
+  // HDF5 is only ever called from one thread at a time.
+  EdgeChunk buffers[ 2 ];
+  read_chunk_( chunks[ 0 ], buffers[ 0 ] );
 
-  try
+  for ( size_t i = 0; i < chunks.size(); ++i )
   {
-    src_nc = getValue< NodeCollectionPTR >( nest_nodes->lookup( source_attribute_value_ ) );
+    std::future< void > next_chunk_read;
+    if ( i + 1 < chunks.size() )
+    {
+      next_chunk_read = std::async( std::launch::async,
+        [ this, &chunks, &buffers, i ]() { read_chunk_( chunks[ i + 1 ], buffers[ ( i + 1 ) % 2 ] ); } );
+    }
+
+    // If connect_chunk_() throws, the destructor of next_chunk_read waits for the read to complete
+    connect_chunk_( buffers[ i % 2 ] );
+
+    if ( next_chunk_read.valid() )
+    {
+      // Rethrows exceptions raised while reading
+      next_chunk_read.get();
+    }
   }
-  catch ( const TypeMismatch& e )
+}
+
+void
+SonataConnector::read_chunk_( const std::vector< EdgeRange >& ranges, EdgeChunk& chunk )
+{
+  chunk.ranges = ranges;
+  chunk.size = 0;
+  for ( const auto& range : ranges )
   {
-    throw KernelException(
-      "Unable to find source node population '" + source_attribute_value_ + "' in node collection dictionary. Error caused "
-      "by the population name specified by attribute of source_node_id dataset in "
-      + cur_fname_ );
+    chunk.size += range.second - range.first;
   }
 
-  NodeCollectionPTR tgt_nc;
-  try
+  // Buffers are only resized here; memory is reused across chunks
+  chunk.src_node_ids.resize( chunk.size );
+  chunk.tgt_node_ids.resize( chunk.size );
+  chunk.edge_type_ids.resize( chunk.size );
+
+  read_subset_( src_node_id_dset_, chunk.src_node_ids, H5::PredType::NATIVE_LONG, ranges, chunk.size );
+  read_subset_( tgt_node_id_dset_, chunk.tgt_node_ids, H5::PredType::NATIVE_LONG, ranges, chunk.size );
+  read_subset_( edge_type_id_dset_, chunk.edge_type_ids, H5::PredType::NATIVE_LONG, ranges, chunk.size );
+
+  if ( weight_dataset_exist_ )
   {
-    tgt_nc = getValue< NodeCollectionPTR >( nest_nodes->lookup( target_attribute_value_ ) );
+    chunk.syn_weights.resize( chunk.size );
+    read_subset_( syn_weight_dset_, chunk.syn_weights, H5::PredType::NATIVE_DOUBLE, ranges, chunk.size );
   }
-  catch ( const TypeMismatch& e )
+  if ( delay_dataset_exist_ )
   {
-    throw KernelException(
-      "Unable to find target node population '" + target_attribute_value_ + "' in node collection dictionary. Error caused "
-      "by the population name specified by attribute of target_node_id dataset in "
-      + cur_fname_ );
+    chunk.delays.resize( chunk.size );
+    read_subset_( delay_dset_, chunk.delays, H5::PredType::NATIVE_DOUBLE, ranges, chunk.size );
   }
+}
 
-  const auto snode_begin = src_nc->begin();
-  const auto tnode_begin = tgt_nc->begin();
+void
+SonataConnector::connect_chunk_( EdgeChunk& chunk )
+{
+  std::vector< std::shared_ptr< WrappedThreadException > > exceptions_raised_( kernel().vp_manager.get_num_threads() );
+
+  const auto snode_begin = src_nc_->begin();
+  const auto tnode_begin = tgt_nc_->begin();
 
 #pragma omp parallel
   {
@@ -445,10 +576,10 @@ SonataConnector::connect_chunk_( const hsize_t hyperslab_size, const hsize_t off
     try
     {
       // Iterate the datasets and create the connections
-      for ( hsize_t i = 0; i < hyperslab_size; ++i )
+      for ( hsize_t i = 0; i < chunk.size; ++i )
       {
 
-        const auto sonata_tgt_id = tgt_node_id_data_subset[ i ];
+        const auto sonata_tgt_id = chunk.tgt_node_ids[ i ];
         const size_t tnode_id = ( *( tnode_begin + sonata_tgt_id ) ).node_id;
 
         if ( not kernel().vp_manager.is_node_id_vp_local( tnode_id ) )
@@ -456,17 +587,16 @@ SonataConnector::connect_chunk_( const hsize_t hyperslab_size, const hsize_t off
           continue;
         }
 
-        const auto sonata_src_id = src_node_id_data_subset[ i ];
+        const auto sonata_src_id = chunk.src_node_ids[ i ];
         const size_t snode_id = ( *( snode_begin + sonata_src_id ) ).node_id;
 
         Node* target = kernel().node_manager.get_node_or_proxy( tnode_id, tid );
         const size_t target_thread = target->get_thread();
 
-        const auto edge_type_id = edge_type_id_data_subset[ i ];
+        const auto edge_type_id = chunk.edge_type_ids[ i ];
         const auto syn_spec = getValue< DictionaryDatum >( cur_edge_params_->lookup( std::to_string( edge_type_id ) ) );
-        const double weight =
-          get_syn_property_( syn_spec, i, weight_dataset_exist_, syn_weight_data_subset, names::weight );
-        const double delay = get_syn_property_( syn_spec, i, delay_dataset_exist_, delay_data_subset, names::delay );
+        const double weight = get_syn_property_( syn_spec, i, weight_dataset_exist_, chunk.syn_weights, names::weight );
+        const double delay = get_syn_property_( syn_spec, i, delay_dataset_exist_, chunk.delays, names::delay );
 
         get_synapse_params_( snode_id, *target, target_thread, rng, edge_type_id );
 
@@ -498,7 +628,7 @@ SonataConnector::connect_chunk_( const hsize_t hyperslab_size, const hsize_t off
     }
   }
 
-} // end create_connections_()
+} // end connect_chunk_()
 
 hsize_t
 SonataConnector::get_nrows_( H5::DataSet dataset )
@@ -543,15 +673,20 @@ void
 SonataConnector::read_subset_( const H5::DataSet& dataset,
   std::vector< T >& data_buf,
   H5::PredType datatype,
-  hsize_t hyperslab_size,
-  hsize_t offset )
+  const std::vector< EdgeRange >& ranges,
+  hsize_t size )
 {
   try
   {
-    H5::DataSpace mspace( 1, &hyperslab_size, NULL );
+    H5::DataSpace mspace( 1, &size, NULL );
     H5::DataSpace dspace = dataset.getSpace();
-    // Select hyperslab. H5S_SELECT_SET replaces any existing selection with this call
-    dspace.selectHyperslab( H5S_SELECT_SET, &hyperslab_size, &offset );
+    // Select union of hyperslabs. H5S_SELECT_SET replaces any existing selection, H5S_SELECT_OR adds to it
+    for ( size_t r = 0; r < ranges.size(); ++r )
+    {
+      const hsize_t offset = ranges[ r ].first;
+      const hsize_t count = ranges[ r ].second - ranges[ r ].first;
+      dspace.selectHyperslab( r == 0 ? H5S_SELECT_SET : H5S_SELECT_OR, &count, &offset );
+    }
     dataset.read( data_buf.data(), datatype, mspace, dspace );
     mspace.close();
     dspace.close();
@@ -562,6 +697,34 @@ SonataConnector::read_subset_( const H5::DataSet& dataset,
   }
 }
 
+std::vector< hsize_t >
+SonataConnector::read_index_dataset_( const H5::DataSet& dataset )
+{
+  std::vector< hsize_t > data;
+  try
+  {
+    H5::DataSpace dspace = dataset.getSpace();
+    if ( dspace.getSimpleExtentNdims() != 2 )
+    {
+      throw KernelException( "Index datasets in " + cur_fname_ + " must be two-dimensional" );
+    }
+    hsize_t dims[ 2 ];
+    dspace.getSimpleExtentDims( dims, NULL );
+    if ( dims[ 1 ] != 2 )
+    {
+      throw KernelException( "Index datasets in " + cur_fname_ + " must have two columns" );
+    }
+    data.resize( dims[ 0 ] * dims[ 1 ] );
+    dataset.read( data.data(), H5::PredType::NATIVE_HSIZE );
+    dspace.close();
+  }
+  catch ( const H5::Exception& e )
+  {
+    throw KernelException( "Unable to read index datasets in " + cur_fname_ + ": " + e.getDetailMsg() );
+  }
+  return data;
+}
+
 void
 SonataConnector::create_edge_type_id_2_syn_spec_( DictionaryDatum edge_params )
 {
@@ -690,6 +853,8 @@ SonataConnector::reset_params_()
   }
   edge_type_id_2_syn_spec_.clear();
   edge_type_id_2_param_dicts_.clear();
+  src_nc_.reset();
+  tgt_nc_.reset();
 }
 
 } // end namespace nest
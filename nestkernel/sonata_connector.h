@@ -29,6 +29,7 @@
 
 // C++ includes:
 #include <map>
+#include <utility>
 #include <vector>
 
 // Includes from nestkernel:
@@ -61,7 +62,12 @@ namespace nest
  * thread-safety, it is not thread-efficient as the usage of locks effectively
  * serialize function calls. Since HDF5 does not provide support for
  * thread-parallel reading, only one thread per MPI process reads connectivity
- * data, before all threads create connections in parallel.
+ * data, while all threads create connections in parallel from the previously
+ * read hyperslab.
+ *
+ * If an edge population provides the optional `indices/target_to_source`
+ * index, each MPI process only reads the edges of its local targets.
+ * Otherwise, all edges are read and filtered.
  */
 class SonataConnector
 {
@@ -200,33 +206,95 @@ private:
     std::vector< double >& data,
     const Name& name );
 
+  //! Half-open range [first, second) of edge ids, i.e., rows in the edge datasets
+  typedef std::pair< hsize_t, hsize_t > EdgeRange;
+
+  /**
+   * @brief Edge data read from one or more hyperslabs.
+   *
+   * Weights and delays are only filled if the respective datasets exist.
+   */
+  struct EdgeChunk
+  {
+    std::vector< EdgeRange > ranges;
+    hsize_t size;
+    std::vector< unsigned long > src_node_ids;
+    std::vector< unsigned long > tgt_node_ids;
+    std::vector< unsigned long > edge_type_ids;
+    std::vector< double > syn_weights;
+    std::vector< double > delays;
+  };
+
+  /**
+   * @brief Look up the node collections of the current source and target populations.
+   */
+  void get_population_node_collections_();
+
   /**
-   * @brief Manage the sequential chunkwise connections to be created.
+   * @brief Find the edges with targets on this MPI process.
+   *
+   * Uses the `indices/target_to_source` index of the population group if it
+   * exists. Otherwise, all edges are returned as a single range.
+   *
+   * @param pop_grp Population group pointer.
+   * @return Sorted, non-overlapping ranges of edge ids.
    */
-  void sequential_chunkwise_connector_();
+  std::vector< EdgeRange > get_local_edge_ranges_( const H5::Group* pop_grp );
 
   /**
-   * @brief Create connections in chunks.
-   * @param hyperslab_size Size of hyperslab (chunk) to be read from datasets
-   * @param offset Offset from start coordinate of data selection
+   * @brief Split edge ranges into chunks of at most hyperslab_size_ edges.
    */
-  void connect_chunk_( const hsize_t hyperslab_size, const hsize_t offset );
+  std::vector< std::vector< EdgeRange > > partition_edge_ranges_( const std::vector< EdgeRange >& ranges ) const;
+
+  /**
+   * @brief Manage the chunkwise connections to be created.
+   *
+   * While connections are created from one chunk, the next chunk is read on
+   * a separate I/O thread.
+   *
+   * @param pop_grp Population group pointer.
+   */
+  void chunkwise_connector_( const H5::Group* pop_grp );
+
+  /**
+   * @brief Read all datasets required for the edges in the given ranges.
+   * @param ranges Edge ranges to read.
+   * @param chunk Buffer to store data in memory.
+   */
+  void read_chunk_( const std::vector< EdgeRange >& ranges, EdgeChunk& chunk );
+
+  /**
+   * @brief Create connections from chunk of edges.
+   * @param chunk Edge data read by read_chunk_().
+   */
+  void connect_chunk_( EdgeChunk& chunk );
 
   /**
    * @brief Read subset of dataset into memory.
+   *
+   * All ranges are selected as a union of hyperslabs and read in one read
+   * operation into consecutive elements of data_buf.
+   *
    * @tparam T
    * @param dataset HDF5 dataset to read.
    * @param data_buf Buffer to store data in memory.
    * @param datatype Type of data in dataset.
-   * @param hyperslab_size Size of hyperslab to be read from dataset.
-   * @param offset Offset from start coordinate of data selection.
+   * @param ranges Edge ranges to be read from dataset.
+   * @param size Total number of edges in ranges.
    */
   template < typename T >
   void read_subset_( const H5::DataSet& dataset,
     std::vector< T >& data_buf,
     H5::PredType datatype,
-    hsize_t hyperslab_size,
-    hsize_t offset );
+    const std::vector< EdgeRange >& ranges,
+    hsize_t size );
+
+  /**
+   * @brief Read two-column index dataset into memory.
+   * @param dataset HDF5 dataset of size {N x 2}.
+   * @return Row-major data of dataset.
+   */
+  std::vector< hsize_t > read_index_dataset_( const H5::DataSet& dataset );
 
   /**
    * @brief Find the number and names of edge groups.
@@ -287,6 +355,12 @@ private:
   //! Current edge parameters
   DictionaryDatum cur_edge_params_;
 
+  //! Node collection of current source population
+  NodeCollectionPTR src_nc_;
+
+  //! Node collection of current target population
+  NodeCollectionPTR tgt_nc_;
+
   //! Map from edge type id (SONATA specification) to synapse model
   std::map< int, size_t > edge_type_id_2_syn_model_;
 
@@ -22,6 +22,7 @@
 
 // C++ includes:
 #include <iostream>
+#include <utility>
 
 // Includes from nestkernel:
 #include "connection_manager.h"
@@ -46,18 +47,22 @@ nest::SourceTable::initialize()
   assert( sizeof( Source ) == 8 );
   const size_t num_threads = kernel().vp_manager.get_num_threads();
   sources_.resize( num_threads );
+  compressed_sources_.resize( num_threads );
   is_cleared_.initialize( num_threads, false );
   saved_entry_point_.initialize( num_threads, false );
   current_positions_.resize( num_threads );
   saved_positions_.resize( num_threads );
   compressible_sources_.resize( num_threads );
+  num_communicated_sources_.resize( num_threads );
 
 #pragma omp parallel
   {
     const size_t tid = kernel().vp_manager.get_thread_id();
     sources_.at( tid ).resize( 0 );
+    compressed_sources_.at( tid ).resize( 0 );
     resize_sources();
     compressible_sources_.at( tid ).resize( 0 );
+    num_communicated_sources_.at( tid ).resize( 0 );
   } // of omp parallel
 }
 
@@ -74,10 +79,13 @@ nest::SourceTable::finalize()
   }
 
   sources_.clear();
+  compressed_sources_.clear();
   current_positions_.clear();
   saved_positions_.clear();
   compressible_sources_.clear();
   compressed_spike_data_map_.clear();
+  source_indices_.clear();
+  num_communicated_sources_.clear();
 }
 
 bool
@@ -86,9 +94,31 @@ nest::SourceTable::is_cleared() const
   return is_cleared_.all_true();
 }
 
+void
+nest::SourceTable::compress( const size_t tid )
+{
+  for ( synindex syn_id = 0; syn_id < sources_[ tid ].size(); ++syn_id )
+  {
+    // If sources cannot be compressed, they remain in sources_
+    CompressedSourceVector compressed_sources;
+    if ( compressed_sources.assign( sources_[ tid ][ syn_id ] ) )
+    {
+      // compressed_sources_[ tid ] only grows once sources are compressed,
+      // so it stays empty as long as all sources are uncompressed
+      if ( compressed_sources_[ tid ].size() <= syn_id )
+      {
+        compressed_sources_[ tid ].resize( syn_id + 1 );
+      }
+      compressed_sources_[ tid ][ syn_id ] = std::move( compressed_sources );
+      sources_[ tid ][ syn_id ].clear();
+    }
+  }
+}
+
 std::vector< BlockVector< nest::Source > >&
 nest::SourceTable::get_thread_local_sources( const size_t tid )
 {
+  assert( compressed_sources_[ tid ].empty() );
   return sources_[ tid ];
 }
 
@@ -124,7 +154,15 @@ nest::SourceTable::clean( const size_t tid )
     for ( synindex syn_id = max_position.syn_id; syn_id < sources_[ tid ].size(); ++syn_id )
     {
       BlockVector< Source >& sources = sources_[ tid ][ syn_id ];
-      if ( max_position.syn_id == syn_id )
+      if ( is_compressed_( tid, syn_id ) )
+      {
+        // compressed sources cannot be truncated, but are small
+        if ( max_position.syn_id < syn_id )
+        {
+          compressed_sources_[ tid ][ syn_id ].clear();
+        }
+      }
+      else if ( max_position.syn_id == syn_id )
       {
         // we need to add 2 to max_position.lcid since
         // max_position.lcid + 1 can contain a valid entry which we
@@ -144,6 +182,7 @@ nest::SourceTable::clean( const size_t tid )
   else if ( max_position.tid < static_cast< long >( tid ) )
   {
     sources_[ tid ].clear();
+    compressed_sources_[ tid ].clear();
   }
   else
   {
@@ -159,7 +198,7 @@ nest::SourceTable::get_node_id( const size_t tid, const synindex syn_id, const s
   {
     throw KernelException( "Cannot use SourceTable::get_node_id when get_keep_source_table is false" );
   }
-  return sources_[ tid ][ syn_id ][ lcid ].get_node_id();
+  return get_source_node_id_( tid, syn_id, lcid );
 }
 
 size_t
@@ -169,6 +208,7 @@ nest::SourceTable::remove_disabled_sources( const size_t tid, const synindex syn
   {
     return invalid_index; // no source table entry for this synapse model
   }
+  assert( not is_compressed_( tid, syn_id ) );
 
   BlockVector< Source >& mysources = sources_[ tid ][ syn_id ];
   const size_t max_size = mysources.size();
@@ -217,7 +257,17 @@ nest::SourceTable::compute_buffer_pos_for_unique_secondary_sources( const size_t
     const ConnectorModel& conn_model = kernel().model_manager.get_connection_model( syn_id, tid );
     const bool is_primary = conn_model.has_property( ConnectionModelProperties::IS_PRIMARY );
 
-    if ( not is_primary )
+    if ( not is_primary and is_compressed_( tid, syn_id ) )
+    {
+      compressed_sources_[ tid ][ syn_id ].for_each_run( [ syn_id ]( const SourceRun& run )
+        {
+#pragma omp critical
+          {
+            ( *unique_secondary_source_node_id_syn_id ).insert( std::make_pair( run.node_id, syn_id ) );
+          }
+        } );
+    }
+    else if ( not is_primary )
     {
       for ( BlockVector< Source >::const_iterator source_cit = sources_[ tid ][ syn_id ].begin();
             source_cit != sources_[ tid ][ syn_id ].end();
@@ -268,6 +318,32 @@ nest::SourceTable::compute_buffer_pos_for_unique_secondary_sources( const size_t
   } // of omp single
 }
 
+void
+nest::SourceTable::count_unique_sources_per_rank( const size_t tid,
+  const synindex syn_id,
+  std::vector< size_t >& num_unique_sources_per_rank ) const
+{
+  if ( is_compressed_( tid, syn_id ) )
+  {
+    compressed_sources_[ tid ][ syn_id ].for_each_run(
+      [ & ]( const SourceRun& run )
+      { ++num_unique_sources_per_rank[ kernel().mpi_manager.get_process_id_of_node_id( run.node_id ) ]; } );
+    return;
+  }
+
+  size_t last_source = 0;
+  for ( BlockVector< Source >::const_iterator cit = sources_[ tid ][ syn_id ].begin();
+        cit != sources_[ tid ][ syn_id ].end();
+        ++cit )
+  {
+    if ( last_source != ( *cit ).get_node_id() )
+    {
+      last_source = ( *cit ).get_node_id();
+      ++num_unique_sources_per_rank[ kernel().mpi_manager.get_process_id_of_node_id( last_source ) ];
+    }
+  }
+}
+
 void
 nest::SourceTable::resize_sources()
 {
@@ -311,7 +387,10 @@ nest::SourceTable::previous_entry_has_same_source_( const SourceTablePosition& c
   const long previous_lcid = current_position.lcid - 1; // needs to be a signed type such that negative
                                                         // values can signal invalid indices
 
-  return ( previous_lcid >= 0 and not local_sources[ previous_lcid ].is_processed()
+  // new entries do not continue runs of entries communicated during previous updates
+  const long first_new_lcid = get_num_communicated_sources_( current_position.tid, current_position.syn_id );
+
+  return ( previous_lcid >= first_new_lcid and not local_sources[ previous_lcid ].is_processed()
     and local_sources[ previous_lcid ].get_node_id() == current_source.get_node_id() );
 }
 
@@ -378,12 +457,30 @@ nest::SourceTable::get_next_target_data( const size_t tid,
   // TargetData object or we have reached the end of the sources table
   while ( true )
   {
-    current_position.seek_to_next_valid_index( sources_ );
+    current_position.seek_to_next_valid_index( *this );
     if ( current_position.is_invalid() )
     {
       return false; // reached the end of the sources table
     }
 
+    // entries communicated during previous updates are already known on
+    // the presynaptic side
+    if ( current_position.lcid
+      < static_cast< long >( get_num_communicated_sources_( current_position.tid, current_position.syn_id ) ) )
+    {
+      current_position.lcid = -1;
+      continue;
+    }
+
+    if ( is_compressed_( current_position.tid, current_position.syn_id ) )
+    {
+      if ( get_next_target_data_from_run_( current_position, rank_start, rank_end, source_rank, next_target_data ) )
+      {
+        return true;
+      }
+      continue;
+    }
+
     // the current position contains an entry, so we retrieve it
     Source& current_source = sources_[ current_position.tid ][ current_position.syn_id ][ current_position.lcid ];
 
@@ -428,6 +525,48 @@ nest::SourceTable::get_next_target_data( const size_t tid,
   }
 }
 
+bool
+nest::SourceTable::get_next_target_data_from_run_( SourceTablePosition& current_position,
+  const size_t rank_start,
+  const size_t rank_end,
+  size_t& source_rank,
+  TargetData& next_target_data )
+{
+  CompressedSourceVector& sources = compressed_sources_[ current_position.tid ][ current_position.syn_id ];
+  const SourceRun run = sources.get_run( current_position.lcid );
+
+  // all entries of a run have the same source and are communicated as a
+  // single target from the first entry of the run, so the remaining
+  // entries do not need to be visited
+  current_position.lcid = run.first_lcid;
+  const Source current_source( run.node_id, run.is_primary );
+
+  if ( sources.is_processed( run ) or not source_should_be_processed_( rank_start, rank_end, current_source ) )
+  {
+    current_position.decrease();
+    return false;
+  }
+
+  // all but the last entry of the run have more targets with the same source
+  const size_t end_lcid = run.first_lcid + run.length;
+  for ( size_t lcid = run.first_lcid; lcid < end_lcid; ++lcid )
+  {
+    kernel().connection_manager.set_source_has_more_targets(
+      current_position.tid, current_position.syn_id, lcid, lcid + 1 < end_lcid );
+  }
+
+  source_rank = kernel().mpi_manager.get_process_id_of_node_id( current_source.get_node_id() );
+  if ( not populate_target_data_fields_( current_position, current_source, source_rank, next_target_data ) )
+  {
+    current_position.decrease();
+    return false;
+  }
+
+  sources.set_processed( run, true );
+  current_position.decrease();
+  return true;
+}
+
 void
 nest::SourceTable::resize_compressible_sources()
 {
@@ -444,6 +583,23 @@ nest::SourceTable::collect_compressible_sources( const size_t tid )
 {
   for ( synindex syn_id = 0; syn_id < sources_[ tid ].size(); ++syn_id )
   {
+    if ( is_compressed_( tid, syn_id ) )
+    {
+      compressed_sources_[ tid ][ syn_id ].for_each_run(
+        [ this, tid, syn_id ]( const SourceRun& run )
+        {
+          compressible_sources_[ tid ][ syn_id ].insert(
+            std::make_pair( run.node_id, SpikeData( tid, syn_id, run.first_lcid, 0 ) ) );
+
+          const size_t end_lcid = run.first_lcid + run.length;
+          for ( size_t lcid = run.first_lcid; lcid < end_lcid; ++lcid )
+          {
+            kernel().connection_manager.set_source_has_more_targets( tid, syn_id, lcid, lcid + 1 < end_lcid );
+          }
+        } );
+      continue;
+    }
+
     size_t lcid = 0;
     auto& syn_sources = sources_[ tid ][ syn_id ];
     while ( lcid < syn_sources.size() )
@@ -475,12 +631,12 @@ nest::SourceTable::dump_sources() const
   FULL_LOGGING_ONLY( for ( size_t tid = 0; tid < sources_.size(); ++tid ) {
     for ( size_t syn_id = 0; syn_id < sources_[ tid ].size(); ++syn_id )
     {
-      for ( size_t lcid = 0; lcid < sources_[ tid ][ syn_id ].size(); ++lcid )
+      for ( size_t lcid = 0; lcid < num_sources( tid, syn_id ); ++lcid )
       {
         kernel().write_to_dump( String::compose( "src  : r%1 t%2 s%3 tg%4 l%5 tt%6",
           kernel().mpi_manager.get_rank(),
           kernel().vp_manager.get_thread_id(),
-          sources_[ tid ][ syn_id ][ lcid ].get_node_id(),
+          get_source_node_id_( tid, syn_id, lcid ),
           kernel().connection_manager.get_target_node_id( tid, syn_id, lcid ),
           lcid,
           tid ) );
@@ -511,18 +667,30 @@ nest::SourceTable::dump_compressible_sources() const
 
 void
 nest::SourceTable::fill_compressed_spike_data(
-  std::vector< std::vector< std::vector< SpikeData > > >& compressed_spike_data )
+  std::vector< std::vector< std::vector< SpikeData > > >& compressed_spike_data,
+  const bool only_new_sources )
 {
   const size_t num_synapse_models = kernel().model_manager.get_num_connection_models();
   compressed_spike_data.clear();
   compressed_spike_data.resize( num_synapse_models );
   compressed_spike_data_map_.clear();
   compressed_spike_data_map_.resize( num_synapse_models, std::map< size_t, CSDMapEntry >() );
+  source_indices_.resize( num_synapse_models );
+
+  // Sources keep their index from previous updates, since the presynaptic
+  // side and spikes still in transit refer to it. Entries of sources
+  // without remaining connections stay invalid.
+  for ( synindex syn_id = 0; syn_id < num_synapse_models; ++syn_id )
+  {
+    compressed_spike_data[ syn_id ].resize( source_indices_[ syn_id ].size(),
+      std::vector< SpikeData >(
+        kernel().vp_manager.get_num_threads(), SpikeData( invalid_targetindex, invalid_synindex, invalid_lcid, 0 ) ) );
+  }
 
   // For each synapse type, and for each source neuron with at least one local target,
   // store in compressed_spike_data one SpikeData entry for each local thread that
   // owns a local target. In compressed_spike_data_map_ store index into compressed_spike_data[syn_id]
-  // where data for a given source is stored.
+  // for all sources that need to be communicated to the presynaptic side.
 
   // TODO: I believe that at this point compressible_sources_ is ordered by source gid.
   //       Maybe one can exploit that to avoid searching with find() below.
@@ -535,7 +703,8 @@ nest::SourceTable::fill_compressed_spike_data(
       {
         const auto source_gid = connection.first;
 
-        if ( compressed_spike_data_map_[ syn_id ].find( source_gid ) == compressed_spike_data_map_[ syn_id ].end() )
+        auto source_index_it = source_indices_[ syn_id ].find( source_gid );
+        if ( source_index_it == source_indices_[ syn_id ].end() )
         {
           // Set up entry for new source
           const auto new_source_index = compressed_spike_data[ syn_id ].size();
@@ -543,11 +712,19 @@ nest::SourceTable::fill_compressed_spike_data(
           compressed_spike_data[ syn_id ].emplace_back( kernel().vp_manager.get_num_threads(),
             SpikeData( invalid_targetindex, invalid_synindex, invalid_lcid, 0 ) );
 
+          source_index_it = source_indices_[ syn_id ].insert( std::make_pair( source_gid, new_source_index ) ).first;
+
           compressed_spike_data_map_[ syn_id ].insert(
             std::make_pair( source_gid, CSDMapEntry( new_source_index, target_thread ) ) );
         }
+        else if ( not only_new_sources )
+        {
+          // no-op if source has already been entered for a previous thread
+          compressed_spike_data_map_[ syn_id ].insert(
+            std::make_pair( source_gid, CSDMapEntry( source_index_it->second, target_thread ) ) );
+        }
 
-        const auto source_index = compressed_spike_data_map_[ syn_id ].find( source_gid )->second.get_source_index();
+        const auto source_index = source_index_it->second;
 
         assert( compressed_spike_data[ syn_id ][ source_index ][ target_thread ].get_lcid() == invalid_lcid );
 
@@ -558,6 +735,12 @@ nest::SourceTable::fill_compressed_spike_data(
 
     } // for target_thread
   }   // for syn_id
+
+  if ( not kernel().connection_manager.get_keep_source_table() )
+  {
+    // the connection infrastructure cannot be updated again
+    source_indices_.clear();
+  }
 }
 
 // Argument name only needed if full logging is activated. Macro-protect to avoid unused argument warning.
@@ -32,6 +32,7 @@
 #include <vector>
 
 // Includes from nestkernel:
+#include "compressed_source_vector.h"
 #include "mpi_manager.h"
 #include "nest_types.h"
 #include "per_thread_bool_indicator.h"
@@ -99,6 +100,13 @@ using success_csdmapentry_size = StaticAssert< sizeof( CSDMapEntry ) == 8 >::suc
  * After all connections have been created, the information stored in
  * this structure is transferred to the presynaptic side and the
  * sources vector can be cleared.
+ *
+ * If the source table is not kept after the transfer, the sorted
+ * sources of each thread and synapse type can be replaced by a
+ * CompressedSourceVector for the duration of the transfer, see
+ * compress(). Each accessor handles both representations; a synapse
+ * type is stored in compressed form if its entry in compressed_sources_
+ * is not empty.
  */
 class SourceTable
 {
@@ -110,6 +118,11 @@ private:
    */
   std::vector< std::vector< BlockVector< Source > > > sources_;
 
+  /**
+   * Compressed sources, with the same layout as sources_.
+   */
+  std::vector< std::vector< CompressedSourceVector > > compressed_sources_;
+
   /**
    * Whether the 3D structure has been deleted.
    */
@@ -171,6 +184,29 @@ private:
     const size_t source_rank,
     TargetData& next_target_data ) const;
 
+  /**
+   * Returns whether sources of given thread and synapse type are compressed.
+   */
+  bool is_compressed_( const size_t tid, const synindex syn_id ) const;
+
+  /**
+   * Returns the node ID of the source at tid|syn_id|lcid in either representation.
+   */
+  size_t get_source_node_id_( const size_t tid, const synindex syn_id, const size_t lcid ) const;
+
+  /**
+   * Counterpart of get_next_target_data() for compressed sources.
+   *
+   * Handles the complete run containing the current position and moves
+   * the position to the entry preceding the run. Returns false if the run
+   * does not need to be communicated by this thread.
+   */
+  bool get_next_target_data_from_run_( SourceTablePosition& current_position,
+    const size_t rank_start,
+    const size_t rank_end,
+    size_t& source_rank,
+    TargetData& next_target_data );
+
   /**
    * A structure to temporarily hold information about all process
    * local targets will be addressed by incoming spikes.
@@ -195,6 +231,31 @@ private:
    */
   std::vector< std::map< size_t, CSDMapEntry > > compressed_spike_data_map_;
 
+  /**
+   * Index into compressed_spike_data of all sources that have been
+   * communicated to the presynaptic side, arranged as a vector over
+   * synapse ids with an inner map (source node id -> source index). Kept
+   * between updates of the connection infrastructure, since targets on the
+   * presynaptic side and spikes in transit at the end of a simulation
+   * refer to these indices. Only kept if the source table is kept.
+   */
+  std::vector< std::map< size_t, size_t > > source_indices_;
+
+  /**
+   * Number of entries per thread and synapse type that have been
+   * communicated to the presynaptic side during previous updates of the
+   * connection infrastructure. Entries added since then have larger local
+   * connection indices and are the only ones considered by
+   * get_next_target_data().
+   */
+  std::vector< std::vector< size_t > > num_communicated_sources_;
+
+  /**
+   * Returns the number of entries of given thread and synapse type that
+   * have been communicated during previous updates.
+   */
+  size_t get_num_communicated_sources_( const size_t tid, const synindex syn_id ) const;
+
 public:
   SourceTable();
   ~SourceTable();
@@ -214,6 +275,13 @@ public:
    */
   void add_source( const size_t tid, const synindex syn_id, const size_t node_id, const bool is_primary );
 
+  /**
+   * Allocates memory for n further sources of the given thread and
+   * synapse type, such that subsequent calls to add_source() do not
+   * allocate memory.
+   */
+  void reserve( const size_t tid, const synindex syn_id, const size_t n );
+
   /**
    * Clears sources_.
    */
@@ -224,6 +292,25 @@ public:
    */
   bool is_cleared() const;
 
+  /**
+   * Replaces sorted sources of thread by their compressed representation.
+   *
+   * Must only be called if the source table is not kept after construction
+   * of the presynaptic connection infrastructure, since compressed sources
+   * cannot be modified.
+   */
+  void compress( const size_t tid );
+
+  /**
+   * Returns the number of synapse types with sources on given thread.
+   */
+  size_t num_synapse_types( const size_t tid ) const;
+
+  /**
+   * Returns the number of sources for given thread and synapse type.
+   */
+  size_t num_sources( const size_t tid, const synindex syn_id ) const;
+
   /**
    * Returns the next target data, according to the current_positions_.
    */
@@ -277,6 +364,18 @@ public:
    */
   void reset_processed_flags( const size_t tid );
 
+  /**
+   * Marks all entries of thread as communicated, such that only entries
+   * added later are communicated during the next incremental update of
+   * the connection infrastructure.
+   */
+  void set_sources_communicated( const size_t tid );
+
+  /**
+   * Marks all entries of thread as not communicated.
+   */
+  void reset_communicated_sources( const size_t tid );
+
   /**
    * Removes all entries marked as processed.
    */
@@ -331,6 +430,14 @@ public:
    */
   size_t num_unique_sources( const size_t tid, const synindex syn_id ) const;
 
+  /**
+   * Adds the number of unique node IDs for given thread id and synapse type
+   * to the entry of the rank on which the source lives.
+   */
+  void count_unique_sources_per_rank( const size_t tid,
+    const synindex syn_id,
+    std::vector< size_t >& num_unique_sources_per_rank ) const;
+
   /**
    * Resizes sources_ according to total number of threads and synapse types.
    */
@@ -346,8 +453,17 @@ public:
 
   // creates maps of sources with more than one thread-local target
   void collect_compressible_sources( const size_t tid );
-  // fills the compressed_spike_data structure in ConnectionManager
-  void fill_compressed_spike_data( std::vector< std::vector< std::vector< SpikeData > > >& compressed_spike_data );
+  // fills the compressed_spike_data structure in ConnectionManager; if
+  // only_new_sources is set, only sources not communicated during previous
+  // updates are entered in compressed_spike_data_map_
+  void fill_compressed_spike_data( std::vector< std::vector< std::vector< SpikeData > > >& compressed_spike_data,
+    const bool only_new_sources );
+
+  /**
+   * Forgets indices of sources in compressed_spike_data, such that the
+   * next call to fill_compressed_spike_data() assigns new indices.
+   */
+  void clear_source_indices();
 
   void clear_compressed_spike_data_map();
 
@@ -357,13 +473,46 @@ public:
     const std::vector< std::vector< std::vector< SpikeData > > >& compressed_spike_data ) const;
 };
 
+inline bool
+SourceTable::is_compressed_( const size_t tid, const synindex syn_id ) const
+{
+  return syn_id < compressed_sources_[ tid ].size() and not compressed_sources_[ tid ][ syn_id ].empty();
+}
+
+inline size_t
+SourceTable::num_synapse_types( const size_t tid ) const
+{
+  return sources_[ tid ].size();
+}
+
+inline size_t
+SourceTable::num_sources( const size_t tid, const synindex syn_id ) const
+{
+  return is_compressed_( tid, syn_id ) ? compressed_sources_[ tid ][ syn_id ].size() : sources_[ tid ][ syn_id ].size();
+}
+
+inline size_t
+SourceTable::get_source_node_id_( const size_t tid, const synindex syn_id, const size_t lcid ) const
+{
+  return is_compressed_( tid, syn_id ) ? compressed_sources_[ tid ][ syn_id ].get_node_id( lcid )
+                                       : sources_[ tid ][ syn_id ][ lcid ].get_node_id();
+}
+
 inline void
 SourceTable::add_source( const size_t tid, const synindex syn_id, const size_t node_id, const bool is_primary )
 {
+  assert( not is_compressed_( tid, syn_id ) );
   const Source src( node_id, is_primary );
   sources_[ tid ][ syn_id ].push_back( src );
 }
 
+inline void
+SourceTable::reserve( const size_t tid, const synindex syn_id, const size_t n )
+{
+  assert( not is_compressed_( tid, syn_id ) );
+  sources_[ tid ][ syn_id ].reserve( sources_[ tid ][ syn_id ].size() + n );
+}
+
 inline void
 SourceTable::clear( const size_t tid )
 {
@@ -372,6 +521,8 @@ SourceTable::clear( const size_t tid )
     it->clear();
   }
   sources_[ tid ].clear();
+  compressed_sources_[ tid ].clear();
+  num_communicated_sources_[ tid ].clear();
   is_cleared_.set_true( tid );
 }
 
@@ -382,11 +533,18 @@ SourceTable::reject_last_target_data( const size_t tid )
   // be inserted into MPI buffer due to overflow. We hence need to
   // correct the processed flag of the last entry (see
   // source_table.cpp)
-  assert( current_positions_[ tid ].lcid + 1
-    < static_cast< long >( sources_[ current_positions_[ tid ].tid ][ current_positions_[ tid ].syn_id ].size() ) );
+  const SourceTablePosition& position = current_positions_[ tid ];
+  assert( position.lcid + 1 < static_cast< long >( num_sources( position.tid, position.syn_id ) ) );
 
-  sources_[ current_positions_[ tid ].tid ][ current_positions_[ tid ].syn_id ][ current_positions_[ tid ].lcid + 1 ]
-    .set_processed( false );
+  if ( is_compressed_( position.tid, position.syn_id ) )
+  {
+    CompressedSourceVector& sources = compressed_sources_[ position.tid ][ position.syn_id ];
+    sources.set_processed( sources.get_run( position.lcid + 1 ), false );
+  }
+  else
+  {
+    sources_[ position.tid ][ position.syn_id ][ position.lcid + 1 ].set_processed( false );
+  }
 }
 
 inline void
@@ -404,8 +562,7 @@ SourceTable::save_entry_point( const size_t tid )
       // contain non-processed entry (see reject_last_target_data()) or
       // store maximal value for lcid.
       saved_positions_[ tid ].lcid = std::min( current_positions_[ tid ].lcid + 1,
-        static_cast< long >(
-          sources_[ current_positions_[ tid ].tid ][ current_positions_[ tid ].syn_id ].size() - 1 ) );
+        static_cast< long >( num_sources( current_positions_[ tid ].tid, current_positions_[ tid ].syn_id ) - 1 ) );
     }
     else
     {
@@ -442,7 +599,7 @@ SourceTable::reset_entry_point( const size_t tid )
   }
   if ( saved_positions_[ tid ].syn_id > -1 )
   {
-    saved_positions_[ tid ].lcid = sources_[ saved_positions_[ tid ].tid ][ saved_positions_[ tid ].syn_id ].size() - 1;
+    saved_positions_[ tid ].lcid = num_sources( saved_positions_[ tid ].tid, saved_positions_[ tid ].syn_id ) - 1;
   }
   else
   {
@@ -460,6 +617,32 @@ SourceTable::reset_processed_flags( const size_t tid )
       iit->set_processed( false );
     }
   }
+  for ( auto& sources : compressed_sources_[ tid ] )
+  {
+    sources.reset_processed_flags();
+  }
+}
+
+inline void
+SourceTable::set_sources_communicated( const size_t tid )
+{
+  num_communicated_sources_[ tid ].resize( sources_[ tid ].size() );
+  for ( synindex syn_id = 0; syn_id < sources_[ tid ].size(); ++syn_id )
+  {
+    num_communicated_sources_[ tid ][ syn_id ] = num_sources( tid, syn_id );
+  }
+}
+
+inline void
+SourceTable::reset_communicated_sources( const size_t tid )
+{
+  num_communicated_sources_[ tid ].clear();
+}
+
+inline size_t
+SourceTable::get_num_communicated_sources_( const size_t tid, const synindex syn_id ) const
+{
+  return syn_id < num_communicated_sources_[ tid ].size() ? num_communicated_sources_[ tid ][ syn_id ] : 0;
 }
 
 inline void
@@ -473,6 +656,11 @@ SourceTable::no_targets_to_process( const size_t tid )
 inline size_t
 SourceTable::find_first_source( const size_t tid, const synindex syn_id, const size_t snode_id ) const
 {
+  if ( is_compressed_( tid, syn_id ) )
+  {
+    return compressed_sources_[ tid ][ syn_id ].find_first( snode_id );
+  }
+
   // binary search in sorted sources
   const BlockVector< Source >::const_iterator begin = sources_[ tid ][ syn_id ].begin();
   const BlockVector< Source >::const_iterator end = sources_[ tid ][ syn_id ].end();
@@ -499,6 +687,7 @@ SourceTable::disable_connection( const size_t tid, const synindex syn_id, const
 {
   // disabling a source changes its node ID to 2^62 -1
   // source here
+  assert( not is_compressed_( tid, syn_id ) );
   assert( not sources_[ tid ][ syn_id ][ lcid ].is_disabled() );
   sources_[ tid ][ syn_id ][ lcid ].disable();
 }
@@ -511,13 +700,18 @@ SourceTable::get_source_node_ids( const size_t tid,
 {
   for ( std::vector< size_t >::const_iterator cit = source_lcids.begin(); cit != source_lcids.end(); ++cit )
   {
-    sources.push_back( sources_[ tid ][ syn_id ][ *cit ].get_node_id() );
+    sources.push_back( get_source_node_id_( tid, syn_id, *cit ) );
   }
 }
 
 inline size_t
 SourceTable::num_unique_sources( const size_t tid, const synindex syn_id ) const
 {
+  if ( is_compressed_( tid, syn_id ) )
+  {
+    return compressed_sources_[ tid ][ syn_id ].num_runs();
+  }
+
   size_t n = 0;
   size_t last_source = 0;
   for ( BlockVector< Source >::const_iterator cit = sources_[ tid ][ syn_id ].begin();
@@ -533,6 +727,51 @@ SourceTable::num_unique_sources( const size_t tid, const synindex syn_id ) const
   return n;
 }
 
+inline void
+SourceTablePosition::seek_to_next_valid_index( const SourceTable& source_table )
+{
+  if ( lcid >= 0 )
+  {
+    return; // nothing to do if we are at a valid index
+  }
+
+  // we stay in this loop either until we can return a valid position,
+  // i.e., lcid >= 0, or we have reached the end of the
+  // multidimensional vector
+  while ( lcid < 0 )
+  {
+    // first try finding a valid lcid by only decreasing synapse index
+    --syn_id;
+    if ( syn_id >= 0 )
+    {
+      lcid = source_table.num_sources( tid, syn_id ) - 1;
+      continue;
+    }
+
+    // if we can not find a valid lcid by decreasing synapse indices,
+    // try decreasing thread index
+    --tid;
+    if ( tid >= 0 )
+    {
+      syn_id = source_table.num_synapse_types( tid ) - 1;
+      if ( syn_id >= 0 )
+      {
+        lcid = source_table.num_sources( tid, syn_id ) - 1;
+      }
+      continue;
+    }
+
+    // if we can not find a valid lcid by decreasing synapse or thread
+    // indices, we have read all entries
+    assert( tid == -1 );
+    assert( syn_id == -1 );
+    assert( lcid == -1 );
+    return; // reached the end without finding a valid entry
+  }
+
+  return; // found a valid entry
+}
+
 inline size_t
 SourceTable::pack_source_node_id_and_syn_id( const size_t source_node_id, const synindex syn_id ) const
 {
@@ -543,6 +782,12 @@ SourceTable::pack_source_node_id_and_syn_id( const size_t source_node_id, const
   return ( source_node_id << 8 ) + syn_id;
 }
 
+inline void
+SourceTable::clear_source_indices()
+{
+  source_indices_.clear();
+}
+
 inline void
 SourceTable::clear_compressed_spike_data_map()
 {
@@ -33,6 +33,8 @@
 namespace nest
 {
 
+class SourceTable;
+
 /**
  * Three-tuple to store position in 3d vector of sources.
  */
@@ -49,8 +51,10 @@ struct SourceTablePosition
 
   /**
    * Decreases indices until a valid entry is found.
+   *
+   * Defined in source_table.h.
    */
-  void seek_to_next_valid_index( const std::vector< std::vector< BlockVector< Source > > >& sources );
+  void seek_to_next_valid_index( const SourceTable& source_table );
 
   /**
    * Decreases the inner most index (lcid).
@@ -78,51 +82,6 @@ inline SourceTablePosition::SourceTablePosition( const long tid, const long syn_
 {
 }
 
-inline void
-SourceTablePosition::seek_to_next_valid_index( const std::vector< std::vector< BlockVector< Source > > >& sources )
-{
-  if ( lcid >= 0 )
-  {
-    return; // nothing to do if we are at a valid index
-  }
-
-  // we stay in this loop either until we can return a valid position,
-  // i.e., lcid >= 0, or we have reached the end of the
-  // multidimensional vector
-  while ( lcid < 0 )
-  {
-    // first try finding a valid lcid by only decreasing synapse index
-    --syn_id;
-    if ( syn_id >= 0 )
-    {
-      lcid = sources[ tid ][ syn_id ].size() - 1;
-      continue;
-    }
-
-    // if we can not find a valid lcid by decreasing synapse indices,
-    // try decreasing thread index
-    --tid;
-    if ( tid >= 0 )
-    {
-      syn_id = sources[ tid ].size() - 1;
-      if ( syn_id >= 0 )
-      {
-        lcid = sources[ tid ][ syn_id ].size() - 1;
-      }
-      continue;
-    }
-
-    // if we can not find a valid lcid by decreasing synapse or thread
-    // indices, we have read all entries
-    assert( tid == -1 );
-    assert( syn_id == -1 );
-    assert( lcid == -1 );
-    return; // reached the end without finding a valid entry
-  }
-
-  return; // found a valid entry
-}
-
 inline bool
 SourceTablePosition::is_invalid() const
 {
@@ -0,0 +1,70 @@
+/*
+ *  target_data_exchange_log.cpp
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "target_data_exchange_log.h"
+
+// Includes from sli:
+#include "dictutils.h"
+
+namespace nest
+{
+
+TargetDataExchangeLog::TargetDataExchangeLog()
+  : round_()
+  , buffer_size_()
+  , bytes_()
+  , time_()
+{
+}
+
+void
+TargetDataExchangeLog::clear()
+{
+  round_.clear();
+  buffer_size_.clear();
+  bytes_.clear();
+  time_.clear();
+}
+
+void
+TargetDataExchangeLog::add_entry( size_t round, size_t buffer_size, size_t bytes, double time )
+{
+  round_.emplace_back( round );
+  buffer_size_.emplace_back( buffer_size );
+  bytes_.emplace_back( bytes );
+  time_.emplace_back( time );
+}
+
+void
+TargetDataExchangeLog::to_dict( DictionaryDatum& rounds ) const
+{
+  initialize_property_intvector( rounds, "round" );
+  append_property( rounds, "round", round_ );
+  initialize_property_intvector( rounds, "buffer_size" );
+  append_property( rounds, "buffer_size", buffer_size_ );
+  initialize_property_intvector( rounds, "bytes" );
+  append_property( rounds, "bytes", bytes_ );
+  initialize_property_doublevector( rounds, "time" );
+  append_property( rounds, "time", time_ );
+}
+
+}
@@ -0,0 +1,55 @@
+/*
+ *  target_data_exchange_log.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef TARGET_DATA_EXCHANGE_LOG_H
+#define TARGET_DATA_EXCHANGE_LOG_H
+
+// C++ includes:
+#include <vector>
+
+// Includes from sli:
+#include "dictdatum.h"
+
+namespace nest
+{
+
+/**
+ * Collect information on rounds of the exchange of target data during connection setup.
+ */
+class TargetDataExchangeLog
+{
+public:
+  TargetDataExchangeLog();
+  void clear();
+  void add_entry( size_t round, size_t buffer_size, size_t bytes, double time );
+  void to_dict( DictionaryDatum& ) const;
+
+private:
+  std::vector< long > round_;       //!< Index of round within its exchange, starting at 0
+  std::vector< long > buffer_size_; //!< Number of entries in MPI buffers
+  std::vector< long > bytes_;       //!< Bytes sent by this rank
+  std::vector< double > time_;      //!< Wall-clock time of round in seconds
+};
+
+}
+
+#endif /* TARGET_DATA_EXCHANGE_LOG_H */
@@ -156,6 +156,13 @@ public:
    */
   void record_data( long );
 
+  //! Return true if at least one logging device is connected
+  bool
+  has_loggers() const
+  {
+    return not data_loggers_.empty();
+  }
+
   //! Erase all existing data
   void reset();
 
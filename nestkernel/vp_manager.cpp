@@ -25,7 +25,15 @@
 // C++ includes:
 #include <cstdlib>
 
+#ifdef __linux__
+// C includes:
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
 // Includes from libnestutil:
+#include "compose.hpp"
 #include "logging.h"
 
 // Includes from nestkernel:
@@ -44,6 +52,8 @@ nest::VPManager::VPManager()
   : force_singlethreading_( true )
 #endif
   , n_threads_( 1 )
+  , pin_threads_( false )
+  , process_cpus_()
 {
 }
 
@@ -74,6 +84,7 @@ nest::VPManager::initialize( const bool adjust_number_of_threads_or_rng_only )
     LOG( M_INFO, "VPManager::initialize()", msg );
   }
 
+  pin_threads_ = false;
   set_num_threads( 1 );
 }
 
@@ -174,6 +185,25 @@ nest::VPManager::set_status( const DictionaryDatum& d )
 
     kernel().change_number_of_threads( n_threads );
   }
+
+  bool pin_threads = pin_threads_;
+  if ( updateValue< bool >( d, names::pin_threads, pin_threads ) and pin_threads != pin_threads_ )
+  {
+    // Memory is placed on the NUMA domain of the thread that touches it first
+    if ( kernel().node_manager.size() > 0 )
+    {
+      throw KernelException( "Thread pinning cannot be changed after nodes have been created." );
+    }
+#ifndef __linux__
+    if ( pin_threads )
+    {
+      throw KernelException( "Thread pinning is only supported on Linux." );
+    }
+#endif
+
+    pin_threads_ = pin_threads;
+    update_thread_affinity_();
+  }
 }
 
 void
@@ -181,6 +211,13 @@ nest::VPManager::get_status( DictionaryDatum& d )
 {
   def< long >( d, names::local_num_threads, get_num_threads() );
   def< long >( d, names::total_num_virtual_procs, get_num_virtual_processes() );
+  def< bool >( d, names::pin_threads, pin_threads_ );
+
+  std::vector< long > cpus;
+  std::vector< long > numa_nodes;
+  get_thread_placement_( cpus, numa_nodes );
+  def< std::vector< long > >( d, names::thread_cpus, cpus );
+  def< std::vector< long > >( d, names::thread_numa_nodes, numa_nodes );
 }
 
 void
@@ -192,4 +229,89 @@ nest::VPManager::set_num_threads( size_t n_threads )
 #ifdef _OPENMP
   omp_set_num_threads( n_threads_ );
 #endif
+
+  update_thread_affinity_();
+}
+
+void
+nest::VPManager::update_thread_affinity_()
+{
+#ifdef __linux__
+  // Nothing to restore if threads have never been pinned
+  if ( not pin_threads_ and process_cpus_.empty() )
+  {
+    return;
+  }
+
+  if ( process_cpus_.empty() )
+  {
+    cpu_set_t process_cpu_set;
+    CPU_ZERO( &process_cpu_set );
+    if ( sched_getaffinity( 0, sizeof( cpu_set_t ), &process_cpu_set ) != 0 )
+    {
+      throw KernelException( "Could not determine the CPUs available for pinning threads." );
+    }
+    for ( int cpu = 0; cpu < CPU_SETSIZE; ++cpu )
+    {
+      if ( CPU_ISSET( cpu, &process_cpu_set ) )
+      {
+        process_cpus_.push_back( cpu );
+      }
+    }
+  }
+
+  if ( pin_threads_ and process_cpus_.size() < n_threads_ )
+  {
+    LOG( M_WARNING,
+      "VPManager::update_thread_affinity_()",
+      String::compose( "Pinning %1 threads to %2 CPUs, some threads share a CPU.", n_threads_, process_cpus_.size() ) );
+  }
+
+  bool affinity_set = true;
+#pragma omp parallel reduction( && : affinity_set )
+  {
+    cpu_set_t cpu_set;
+    CPU_ZERO( &cpu_set );
+    if ( pin_threads_ )
+    {
+      CPU_SET( process_cpus_[ get_thread_id() % process_cpus_.size() ], &cpu_set );
+    }
+    else
+    {
+      for ( const int cpu : process_cpus_ )
+      {
+        CPU_SET( cpu, &cpu_set );
+      }
+    }
+
+    // With pid 0, the affinity of the calling thread is set
+    affinity_set = sched_setaffinity( 0, sizeof( cpu_set_t ), &cpu_set ) == 0;
+  } // of omp parallel
+
+  if ( not affinity_set )
+  {
+    LOG( M_WARNING, "VPManager::update_thread_affinity_()", "Could not set CPU affinity of all threads." );
+  }
+#endif
+}
+
+void
+nest::VPManager::get_thread_placement_( std::vector< long >& cpus, std::vector< long >& numa_nodes ) const
+{
+  cpus.assign( n_threads_, -1 );
+  numa_nodes.assign( n_threads_, -1 );
+
+#ifdef __linux__
+#pragma omp parallel
+  {
+    const size_t tid = get_thread_id();
+    unsigned int cpu = 0;
+    unsigned int numa_node = 0;
+    if ( syscall( SYS_getcpu, &cpu, &numa_node, nullptr ) == 0 )
+    {
+      cpus[ tid ] = cpu;
+      numa_nodes[ tid ] = numa_node;
+    }
+  } // of omp parallel
+#endif
 }
@@ -23,6 +23,9 @@
 #ifndef VP_MANAGER_H
 #define VP_MANAGER_H
 
+// C++ includes:
+#include <vector>
+
 // Includes from libnestutil:
 #include "manager_interface.h"
 
@@ -73,6 +76,8 @@ public:
    * Set the number of threads by setting the internal variable
    * n_threads_, the corresponding value in the Communicator, and
    * the OpenMP number of threads.
+   *
+   * If pin_threads is set, the new threads are pinned to CPUs.
    */
   void set_num_threads( const size_t n_threads );
 
@@ -170,8 +175,26 @@ public:
   AssignedRanks get_assigned_ranks( const size_t tid );
 
 private:
+  /**
+   * Pin each thread to one CPU if pin_threads_ is set, otherwise allow all threads to run on all CPUs again.
+   *
+   * Thread tid is pinned to the tid-th CPU, modulo their number, of the CPUs
+   * on which the process was allowed to run before threads were pinned first.
+   * Pinning keeps memory first touched by a thread local to its NUMA domain.
+   */
+  void update_thread_affinity_();
+
+  /**
+   * Return CPU and NUMA node on which each thread currently runs.
+   *
+   * Entries are -1 if the information is not available on this platform.
+   */
+  void get_thread_placement_( std::vector< long >& cpus, std::vector< long >& numa_nodes ) const;
+
   const bool force_singlethreading_;
-  size_t n_threads_; //!< Number of threads per process.
+  size_t n_threads_;                //!< Number of threads per process.
+  bool pin_threads_;                //!< Whether threads are pinned to CPUs
+  std::vector< int > process_cpus_; //!< CPUs available to the process, recorded when threads are pinned first
 };
 }
 
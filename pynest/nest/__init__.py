@@ -91,6 +91,7 @@ class NestModule(types.ModuleType):
         self.__dict__.update(_original_module_attrs)  # noqa
 
         # Import public APIs of submodules into the `nest.` namespace
+        _rel_import_star(self, ".lib.hl_api_binary_recording")  # noqa: F821
         _rel_import_star(self, ".lib.hl_api_connections")  # noqa: F821
         _rel_import_star(self, ".lib.hl_api_exceptions")  # noqa: F821
         _rel_import_star(self, ".lib.hl_api_info")  # noqa: F821
@@ -185,6 +186,20 @@ class NestModule(types.ModuleType):
     )
     total_num_virtual_procs = KernelAttribute("int", "The total number of virtual processes", default=1)
     local_num_threads = KernelAttribute("int", "The local number of threads", default=1)
+    pin_threads = KernelAttribute(
+        "bool",
+        (
+            "Whether to pin each thread to one of the CPUs available to the process, so that memory "
+            + "allocated by a thread stays on its NUMA domain. Can only be changed before nodes are created"
+        ),
+        default=False,
+    )
+    thread_cpus = KernelAttribute(
+        "list[int]", "CPU on which each thread ran when the attribute was read, -1 if unknown", readonly=True
+    )
+    thread_numa_nodes = KernelAttribute(
+        "list[int]", "NUMA node on which each thread ran when the attribute was read, -1 if unknown", readonly=True
+    )
     num_processes = KernelAttribute("int", "The number of MPI processes", readonly=True)
     off_grid_spiking = KernelAttribute(
         "bool",
@@ -226,6 +241,16 @@ class NestModule(types.ModuleType):
         "Maximal size of MPI buffers for communication of connections",
         default=16777216,
     )
+    target_data_exchange_log = KernelAttribute(
+        "dict",
+        (
+            "Log of the rounds of communication of connections as a dictionary. For each round, it contains "
+            + "the index of the ``round`` within its update of the connection infrastructure, starting at 0, "
+            + "the ``buffer_size``, that is, the number of entries exchanged, the ``bytes`` sent by this rank "
+            + "and the wall-clock ``time`` of the round in seconds"
+        ),
+        readonly=True,
+    )
     spike_buffer_grow_extra = KernelAttribute(
         "float",
         "When spike exchange buffer is expanded, resize it to "
@@ -261,6 +286,42 @@ class NestModule(types.ModuleType):
         ),
         readonly=True,
     )
+    spike_exchange_bytes_sent = KernelAttribute(
+        "int",
+        (
+            "Number of bytes sent by this rank in spike exchanges during the most recent call to Simulate(); "
+            + "only counted if ``use_sparse_spike_exchange`` is set"
+        ),
+        readonly=True,
+    )
+    spike_exchange_bytes_saved = KernelAttribute(
+        "int",
+        (
+            "Number of bytes this rank would have sent in addition during the most recent call to Simulate() "
+            + "in a fixed-size exchange just large enough for the largest number of spikes sent between any "
+            + "two ranks; only counted if ``use_sparse_spike_exchange`` is set"
+        ),
+        readonly=True,
+    )
+    spikes_sent_per_slice_histogram = KernelAttribute(
+        "list[int]",
+        (
+            "Histogram of the number of spikes this rank sent per slice since the start of the most recent "
+            + "call to Run() or Simulate(), which reset it. Entry 0 counts slices without spikes, entry k > 0 "
+            + "slices with 2^(k-1) to 2^k - 1 spikes. Spikes are counted once per target rank and thread, or "
+            + "once per target rank if ``use_compressed_spikes`` is set"
+        ),
+        readonly=True,
+    )
+    use_sparse_spike_exchange = KernelAttribute(
+        "bool",
+        (
+            "Whether to exchange spikes with ``MPI_Alltoallv`` after exchanging the number of spikes "
+            + "for each pair of ranks, instead of with fixed-size buffers. "
+            + "Must be set before the first call to Simulate."
+        ),
+        default=False,
+    )
 
     use_wfr = KernelAttribute("bool", "Whether to use waveform relaxation method", default=True)
     wfr_comm_interval = KernelAttribute(
@@ -305,6 +366,16 @@ class NestModule(types.ModuleType):
         "The list of the available structural plasticity growth curves",
         readonly=True,
     )
+    compress_source_table = KernelAttribute(
+        "bool",
+        (
+            "Whether to store the sorted source table in run-length and delta"
+            + " encoded form while connection information is transferred to the"
+            + " presynaptic side, reducing peak memory during the first call to"
+            + " Simulate. Requires ``keep_source_table`` to be False."
+        ),
+        default=False,
+    )
     use_compressed_spikes = KernelAttribute(
         "bool",
         (
@@ -315,6 +386,67 @@ class NestModule(types.ModuleType):
         ),
         default=True,
     )
+    use_incremental_connection_update = KernelAttribute(
+        "bool",
+        (
+            "Whether to only communicate connections created since the last"
+            + " call to Simulate and append them to the presynaptic target"
+            + " table. The connection infrastructure is rebuilt instead if"
+            + " connections were deleted, ``keep_source_table`` is False, or"
+            + " secondary connections or structural plasticity are used."
+        ),
+        default=True,
+    )
+    use_pipelined_spike_exchange = KernelAttribute(
+        "bool",
+        (
+            "Whether to overlap the MPI exchange of spikes with the update of"
+            + " the next time slice; spikes are then delivered one slice later,"
+            + " so min_delay is set to half the minimal delay in the network."
+            + " Must be set before the first call to Simulate."
+        ),
+        default=False,
+    )
+    use_pipelined_target_data_exchange = KernelAttribute(
+        "bool",
+        (
+            "Whether to collocate connection information for the next round of"
+            + " communication of connections while the current round is exchanged;"
+            + " the MPI buffers are sized from the largest number of connections"
+            + " sent from one rank to another and, if ``adaptive_target_buffers``"
+            + " is set, grow in each further round up to ``max_buffer_size_target_data``"
+        ),
+        default=False,
+    )
+    use_population_update = KernelAttribute(
+        "bool",
+        (
+            "Whether to update consecutive nodes of models supporting it"
+            + " (iaf_psc_alpha, iaf_psc_exp, iaf_psc_delta) in batched,"
+            + " vectorized population kernels instead of one by one."
+        ),
+        default=False,
+    )
+    use_radix_sort = KernelAttribute(
+        "bool",
+        (
+            "Whether to sort connections by source with a stable radix sort,"
+            + " which can use idle threads for large synapse types, instead of"
+            + " the in-place sort. Faster with many connections per thread and"
+            + " synapse type, but needs 16 bytes of temporary memory per"
+            + " connection being sorted."
+        ),
+        default=False,
+    )
+    use_sorted_spike_delivery = KernelAttribute(
+        "bool",
+        (
+            "Whether to sort received spikes by synapse type and connection"
+            + " index before delivering them, so that connections are accessed"
+            + " in memory order."
+        ),
+        default=False,
+    )
     data_path = KernelAttribute(
         "str",
         "A path, where all data is written to, defaults to current directory",
@@ -333,6 +465,15 @@ class NestModule(types.ModuleType):
         readonly=True,
         localonly=True,
     )
+    compact_synapse_memory_saved = KernelAttribute(
+        "int",
+        (
+            "Number of bytes saved on this rank by storing connections in compact"
+            + " synapse models instead of the corresponding full synapse models"
+        ),
+        readonly=True,
+        localonly=True,
+    )
     connection_rules = KernelAttribute(
         "list[str]",
         "The list of available connection rules",
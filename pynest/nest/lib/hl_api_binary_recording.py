@@ -0,0 +1,175 @@
+# -*- coding: utf-8 -*-
+#
+# hl_api_binary_recording.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+Functions for reading data written by the ``binary`` recording backend
+"""
+
+import struct
+
+import numpy as np
+
+from .hl_api_helper import is_string
+
+__all__ = [
+    "ReadBinaryRecording",
+]
+
+_MAGIC = b"NESTBIN\0"
+_FORMAT_VERSION = 1
+_BYTE_ORDER_MARK = 0x01020304
+_DEVICE_RECORD = 1
+_BLOCK_RECORD = 2
+
+
+class _BinaryRecordingFile:
+    """Sequential reader for a single file written by the ``binary`` recording backend."""
+
+    def __init__(self, filename):
+        with open(filename, "rb") as f:
+            self._data = f.read()
+        self._filename = filename
+        self._pos = 0
+
+        if self._data[: len(_MAGIC)] != _MAGIC:
+            raise ValueError(f"'{filename}' was not written by the binary recording backend.")
+        self._pos = len(_MAGIC)
+
+        version, byte_order_mark = self._unpack("=II")
+        if byte_order_mark != _BYTE_ORDER_MARK:
+            raise ValueError(f"'{filename}' was written on a machine with different byte order.")
+        if version != _FORMAT_VERSION:
+            raise ValueError(f"'{filename}' has unsupported format version {version}.")
+
+        self.rank, self.resolution = self._unpack("=Qd")
+        self.nest_version = self._string()
+
+    def _unpack(self, fmt):
+        values = struct.unpack_from(fmt, self._data, self._pos)
+        self._pos += struct.calcsize(fmt)
+        return values
+
+    def _string(self):
+        (length,) = self._unpack("=Q")
+        s = self._data[self._pos : self._pos + length].decode()
+        self._pos += length
+        return s
+
+    def _column(self, dtype, n):
+        column = np.frombuffer(self._data, dtype=dtype, count=n, offset=self._pos)
+        self._pos += column.nbytes
+        return column
+
+    def records(self):
+        """Yield device records as dictionaries and block records as tuples of node ID and events."""
+
+        while self._pos < len(self._data):
+            (record_type,) = self._unpack("=I")
+            if record_type == _DEVICE_RECORD:
+                (node_id,) = self._unpack("=Q")
+                model = self._string()
+                label = self._string()
+                (num_double_values,) = self._unpack("=Q")
+                double_value_names = [self._string() for _ in range(num_double_values)]
+                (num_long_values,) = self._unpack("=Q")
+                long_value_names = [self._string() for _ in range(num_long_values)]
+                yield {
+                    "node_id": node_id,
+                    "model": model,
+                    "label": label,
+                    "double_value_names": double_value_names,
+                    "long_value_names": long_value_names,
+                }
+            elif record_type == _BLOCK_RECORD:
+                node_id, n, num_double_values, num_long_values = self._unpack("=QQQQ")
+                senders = self._column(np.int64, n)
+                steps = self._column(np.int64, n)
+                offsets = self._column(np.float64, n)
+                double_values = [self._column(np.float64, n) for _ in range(num_double_values)]
+                long_values = [self._column(np.int64, n) for _ in range(num_long_values)]
+                times = steps * self.resolution - offsets
+                yield node_id, senders, times, double_values, long_values
+            else:
+                raise ValueError(f"Corrupt record in '{self._filename}' at byte {self._pos - 4}.")
+
+
+def ReadBinaryRecording(filenames):
+    """Read files written by the ``binary`` recording backend.
+
+    The files written by all MPI processes can be read at once, the events
+    of each recording device are then combined.
+
+    Parameters
+    ----------
+    filenames : str or list of str
+        Names of the files to read, as given by the ``filename`` property of
+        the recording devices
+
+    Returns
+    -------
+    dict:
+        For each recording device, identified by its node ID, a dictionary
+        with the ``model`` and ``label`` of the device and its ``events``.
+        Like the ``events`` of the ``memory`` backend, these contain the
+        arrays ``senders`` and ``times`` (in ms) and one array for each
+        recorded value.
+
+    Raises
+    ------
+    ValueError
+        If a file was not written by the ``binary`` recording backend or is
+        corrupt.
+    """
+
+    if is_string(filenames):
+        filenames = [filenames]
+
+    devices = {}
+    columns = {}
+    for filename in filenames:
+        for record in _BinaryRecordingFile(filename).records():
+            if isinstance(record, dict):
+                node_id = record["node_id"]
+                if node_id not in devices:
+                    devices[node_id] = record
+                    names = ["senders", "times"] + record["double_value_names"] + record["long_value_names"]
+                    columns[node_id] = {name: [] for name in names}
+            else:
+                node_id, senders, times, double_values, long_values = record
+                device = devices[node_id]
+                device_columns = columns[node_id]
+                device_columns["senders"].append(senders)
+                device_columns["times"].append(times)
+                for name, values in zip(device["double_value_names"], double_values):
+                    device_columns[name].append(values)
+                for name, values in zip(device["long_value_names"], long_values):
+                    device_columns[name].append(values)
+
+    result = {}
+    for node_id, device in devices.items():
+        dtypes = dict.fromkeys(device["double_value_names"] + ["times"], np.float64)
+        events = {
+            name: np.concatenate(parts) if parts else np.array([], dtype=dtypes.get(name, np.int64))
+            for name, parts in columns[node_id].items()
+        }
+        result[node_id] = {"model": device["model"], "label": device["label"], "events": events}
+
+    return result
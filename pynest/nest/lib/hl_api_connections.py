@@ -42,7 +42,10 @@ __all__ = [
     "Connect",
     "TripartiteConnect",
     "Disconnect",
+    "GetConnectionColumns",
     "GetConnections",
+    "LoadConnectivity",
+    "SaveConnectivity",
 ]
 
 
@@ -82,6 +85,24 @@ def GetConnections(source=None, target=None, synapse_model=None, synapse_label=N
     the command are returned.
     """
 
+    params = _get_connections_selection(source, target, synapse_model, synapse_label)
+
+    sps(params)
+
+    print("BEFORE SLI RUN. pynest/nest/lib/hl_api_connections.py\n")
+    sr("GetConnections")
+
+    conns = spp()
+
+    if isinstance(conns, tuple):
+        conns = SynapseCollection(None)
+
+    return conns
+
+
+def _get_connections_selection(source, target, synapse_model, synapse_label):
+    """Return the dictionary selecting connections for `GetConnections` and `GetConnectionColumns`."""
+
     params = {}
 
     if source is not None:
@@ -102,17 +123,65 @@ def GetConnections(source=None, target=None, synapse_model=None, synapse_label=N
     if synapse_label is not None:
         params["synapse_label"] = synapse_label
 
-    sps(params)
+    return params
 
-    print("BEFORE SLI RUN. pynest/nest/lib/hl_api_connections.py\n")
-    sr("GetConnections")
 
-    conns = spp()
+@check_stack
+def GetConnectionColumns(source=None, target=None, synapse_model=None, synapse_label=None, parameters=None):
+    """Return connections as columns of NumPy arrays.
 
-    if isinstance(conns, tuple):
-        conns = SynapseCollection(None)
+    Connections are selected as in :py:func:`.GetConnections`, but instead of
+    a `SynapseCollection`, a dictionary with one array per connection property
+    is returned. This avoids creating an object per connection and is
+    considerably faster and leaner for large numbers of connections.
 
-    return conns
+    Parameters
+    ----------
+    source : NodeCollection, optional
+        Source node IDs, only connections from these
+        pre-synaptic neurons are returned
+    target : NodeCollection, optional
+        Target node IDs, only connections to these
+        postsynaptic neurons are returned
+    synapse_model : str, optional
+        Only connections with this synapse type are returned
+    synapse_label : int, optional
+        (non-negative) only connections with this synapse label are returned
+    parameters : str or list of str, optional
+        Numerical synapse parameters, such as ``"weight"`` and ``"delay"``,
+        to return in addition to the connection identifiers
+
+    Returns
+    -------
+    dict:
+        Arrays ``source``, ``target``, ``target_thread``, ``synapse_modelid``
+        and ``port`` identifying the connections, and one array of floats per
+        requested parameter. Entry `i` of all arrays refers to the same
+        connection.
+
+    Raises
+    ------
+    TypeError
+
+    Notes
+    -----
+    Only connections with targets on the MPI process executing
+    the command are returned. The connection identifiers become invalid
+    when new connections are created.
+    """
+
+    params = _get_connections_selection(source, target, synapse_model, synapse_label)
+
+    if parameters is None:
+        parameters = []
+    elif is_string(parameters):
+        parameters = [parameters]
+
+    sps(params)
+    sps([kernel.SLILiteral(param) for param in parameters])
+    sr("GetConnectionColumns")
+
+    return spp()
 
 
 @check_stack
@@ -235,8 +304,9 @@ def Connect(pre, post, conn_spec=None, syn_spec=None, return_synapsecollection=F
         if "delays" in processed_syn_spec:
             raise ValueError("To specify delays, use 'delay' in syn_spec.")
 
-        weights = numpy.array(processed_syn_spec["weight"]) if "weight" in processed_syn_spec else None
-        delays = numpy.array(processed_syn_spec["delay"]) if "delay" in processed_syn_spec else None
+        # Arrays are passed on without copying if possible
+        weights = numpy.asarray(processed_syn_spec["weight"]) if "weight" in processed_syn_spec else None
+        delays = numpy.asarray(processed_syn_spec["delay"]) if "delay" in processed_syn_spec else None
 
         try:
             synapse_model = processed_syn_spec["synapse_model"]
@@ -252,10 +322,12 @@ def Connect(pre, post, conn_spec=None, syn_spec=None, return_synapsecollection=F
             for k in set(processed_syn_spec.keys()).difference(set(("weight", "delay", "synapse_model")))
         }
 
+        # One array per parameter; scalars are expanded to arrays
         if len(reduced_processed_syn_spec) > 0:
-            syn_param_values = numpy.zeros([len(reduced_processed_syn_spec), len(pre)])
-            for i, value in enumerate(reduced_processed_syn_spec.values()):
-                syn_param_values[i] = value
+            syn_param_values = [
+                numpy.asarray(value) if numpy.ndim(value) == 1 else numpy.full(len(pre), value, dtype=numpy.double)
+                for value in reduced_processed_syn_spec.values()
+            ]
         else:
             syn_param_values = None
 
@@ -502,3 +574,58 @@ def Disconnect(*args, conn_spec=None, syn_spec=None):
         sr("Disconnect_g_g_D_D")
     else:
         raise TypeError("Arguments must be either a SynapseCollection or two NodeCollections")
+
+
+@check_stack
+def SaveConnectivity(filename):
+    """Write all connections between neurons to binary snapshot files.
+
+    Each thread on each MPI process writes its local connections to a file
+    named ``<filename>-<rank>-<thread>.conn``. Connections from and to devices
+    are not included in the snapshot, nor is the state of the neurons.
+    Synapse parameters are stored as they are, so the snapshot must be
+    written before any simulation if the network is to be restored in its
+    initial state.
+
+    After a simulation, connectivity can only be saved if the kernel
+    property ``keep_source_table`` was ``True`` during the simulation and
+    all connections use static synapse models such as ``static_synapse``.
+    Other synapse models have time-dependent state, e.g., the time of the
+    last presynaptic spike ``t_lastspike``, which refers to the clock of
+    the simulation and cannot be restored in a network starting at time 0.
+    In this case, ``SaveConnectivity`` raises an error.
+
+    Parameters
+    ----------
+    filename : str
+        Path prefix of the snapshot files
+
+    See Also
+    --------
+    LoadConnectivity
+    """
+
+    sps(filename)
+    sr("SaveConnectivity")
+
+
+@check_stack
+def LoadConnectivity(filename):
+    """Restore connections from snapshot files written by :py:func:`.SaveConnectivity`.
+
+    All nodes must have been created exactly as when the snapshot was
+    written, and the kernel must use the same numbers of MPI processes and
+    threads and the same resolution. No connections may exist when loading.
+
+    Parameters
+    ----------
+    filename : str
+        Path prefix of the snapshot files
+
+    See Also
+    --------
+    SaveConnectivity
+    """
+
+    sps(filename)
+    sr("LoadConnectivity")
@@ -418,9 +418,14 @@ class SonataNetwork:
 
         For large networks, the edge HDF5 files might not fit into memory in
         their entirety. In the NEST kernel, the edge HDF5 datasets are therefore
-        read sequentially as blocks of contiguous hyperslabs. The hyperslab size
-        is modifiable so that the user is able to achieve a balance between
-        the number of read operations and memory overhead.
+        read sequentially as blocks of hyperslabs. The hyperslab size is
+        modifiable so that the user is able to achieve a balance between the
+        number of read operations and memory overhead. The next block is read
+        while connections are created from the current one, so two blocks are
+        held in memory at a time.
+
+        If an edge file provides the ``indices/target_to_source`` index, each
+        MPI process only reads the edges of its local target nodes.
 
         Parameters
         ----------
@@ -296,8 +296,8 @@ cdef class NESTEngine:
             raise TypeError('weights must be a 1-dimensional NumPy array')
         if delays is not None and  not (isinstance(delays, numpy.ndarray) and delays.ndim == 1):
             raise TypeError('delays must be a 1-dimensional NumPy array')
-        if syn_param_values is not None and not ((isinstance(syn_param_values, numpy.ndarray) and syn_param_values.ndim == 2)):
-            raise TypeError('syn_param_values must be a 2-dimensional NumPy array')
+        if syn_param_values is not None and not all(isinstance(v, numpy.ndarray) and v.ndim == 1 for v in syn_param_values):
+            raise TypeError('syn_param_values must be a sequence of 1-dimensional NumPy arrays')
 
         if len(sources) != len(targets):
             raise ValueError('Sources and targets must be arrays of the same length.')
@@ -306,10 +306,10 @@ cdef class NESTEngine:
         if delays is not None and len(sources) != len(delays):
                 raise ValueError('delays must be an array of the same length as sources and targets.')
         if syn_param_values is not None:
-            if not len(syn_param_keys) == syn_param_values.shape[0]:
-                raise ValueError('syn_param_values must be a matrix with one array per key in syn_param_keys.')
-            if not len(sources) == syn_param_values.shape[1]:
-                raise ValueError('syn_param_values must be a matrix with arrays of the same length as sources and targets.')
+            if not len(syn_param_keys) == len(syn_param_values):
+                raise ValueError('syn_param_values must contain one array per key in syn_param_keys.')
+            if not all(len(sources) == len(v) for v in syn_param_values):
+                raise ValueError('syn_param_values must contain arrays of the same length as sources and targets.')
 
         # Get pointers to the first element in each NumPy array
         cdef long[::1] sources_mv = numpy.ascontiguousarray(sources, dtype=int)
@@ -336,11 +336,16 @@ cdef class NESTEngine:
             for key in syn_param_keys:
                 param_keys_ptr.push_back(key.encode('utf8'))
 
-        cdef double[:, ::1] param_values_mv
-        cdef double* param_values_ptr = NULL
+        # Pointers to the parameter arrays, which are only copied if not already contiguous arrays of doubles.
+        # The list keeps the arrays alive during the call.
+        cdef double[::1] param_values_mv
+        cdef vector[double*] param_values_ptr
+        param_values_arrays = []
         if syn_param_values is not None:
-            param_values_mv = numpy.ascontiguousarray(syn_param_values, dtype=numpy.double)
-            param_values_ptr = &param_values_mv[0][0]
+            for values in syn_param_values:
+                param_values_mv = numpy.ascontiguousarray(values, dtype=numpy.double)
+                param_values_arrays.append(param_values_mv)
+                param_values_ptr.push_back(&param_values_mv[0])
 
         cdef string syn_model_string = synapse_model.encode('UTF-8')
 
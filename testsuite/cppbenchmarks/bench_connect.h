@@ -0,0 +1,122 @@
+/*
+ *  bench_connect.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef BENCH_CONNECT_H
+#define BENCH_CONNECT_H
+
+// C++ includes:
+#include <string>
+#include <tuple>
+
+// Includes from nestkernel:
+#include "nest.h"
+#include "nest_names.h"
+#include "node_collection.h"
+
+// Includes from sli:
+#include "dictutils.h"
+
+// Includes from cppbenchmarks:
+#include "benchmark.h"
+#include "synthetic_network.h"
+
+namespace nest_benchmarks
+{
+
+/**
+ * Create nodes and measure connecting them with the given rule.
+ *
+ * Only the call to connect is timed. Since the peak RSS is reported for the
+ * whole process, connection benchmarks should be run one at a time using
+ * --filter when comparing memory consumption.
+ */
+inline void
+benchmark_connect( BenchmarkState& state,
+  const size_t num_targets,
+  const size_t num_connections,
+  const DictionaryDatum& conn_spec )
+{
+  state.set_items_per_iteration( 0, num_connections );
+  while ( state.keep_running() )
+  {
+    state.pause_timing();
+    nest::NodeCollectionPTR sources;
+    nest::NodeCollectionPTR targets;
+    std::tie( sources, targets ) = create_synthetic_nodes( state, num_targets );
+
+    DictionaryDatum syn_spec( new Dictionary );
+    def< std::string >( syn_spec, nest::names::synapse_model, state.synapse_model() );
+    state.resume_timing();
+
+    nest::connect( sources, targets, conn_spec, { syn_spec } );
+  }
+}
+
+/**
+ * Connecting sources to targets with fan_in incoming connections each.
+ */
+void
+connect_fixed_indegree( BenchmarkState& state )
+{
+  const BenchmarkConfig& config = state.config();
+
+  DictionaryDatum conn_spec( new Dictionary );
+  def< std::string >( conn_spec, nest::names::rule, "fixed_indegree" );
+  def< long >( conn_spec, nest::names::indegree, config.fan_in );
+
+  benchmark_connect( state, config.num_targets(), config.num_targets() * config.fan_in, conn_spec );
+}
+NEST_BENCHMARK( connect_fixed_indegree, true );
+
+/**
+ * Connecting each source to one target.
+ */
+void
+connect_one_to_one( BenchmarkState& state )
+{
+  const BenchmarkConfig& config = state.config();
+
+  DictionaryDatum conn_spec( new Dictionary );
+  def< std::string >( conn_spec, nest::names::rule, "one_to_one" );
+
+  benchmark_connect( state, config.num_sources, config.num_sources, conn_spec );
+}
+NEST_BENCHMARK( connect_one_to_one, true );
+
+/**
+ * Connecting each source to all targets.
+ */
+void
+connect_all_to_all( BenchmarkState& state )
+{
+  const BenchmarkConfig& config = state.config();
+
+  DictionaryDatum conn_spec( new Dictionary );
+  def< std::string >( conn_spec, nest::names::rule, "all_to_all" );
+
+  benchmark_connect( state, config.num_targets(), config.num_sources * config.num_targets(), conn_spec );
+}
+NEST_BENCHMARK( connect_all_to_all, true );
+
+} // namespace nest_benchmarks
+
+#endif /* BENCH_CONNECT_H */
@@ -0,0 +1,160 @@
+/*
+ *  bench_spike_delivery.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef BENCH_SPIKE_DELIVERY_H
+#define BENCH_SPIKE_DELIVERY_H
+
+// Includes from nestkernel:
+#include "event.h"
+#include "event_delivery_manager_impl.h"
+#include "kernel_manager.h"
+#include "ring_buffer.h"
+
+// Includes from cppbenchmarks:
+#include "benchmark.h"
+#include "synthetic_network.h"
+
+namespace nest_benchmarks
+{
+
+/**
+ * Emit one spike from each source, as if all sources had fired in the first step of the slice.
+ */
+inline void
+emit_spikes( const nest::NodeCollectionPTR sources )
+{
+#pragma omp parallel
+  {
+    const size_t tid = nest::kernel().vp_manager.get_thread_id();
+    const auto end_it = sources->end();
+    for ( auto it = sources->thread_local_begin(); it < end_it; ++it )
+    {
+      nest::Node* source = nest::kernel().node_manager.get_node_or_proxy( ( *it ).node_id, tid );
+      nest::SpikeEvent se;
+      se.set_sender( *source );
+      nest::kernel().event_delivery_manager.send_remote( tid, se, 0 );
+    }
+  }
+}
+
+/**
+ * Delivery of spikes from the MPI receive buffer to the targets.
+ *
+ * Includes reading the receive buffer, Connector::send() and accumulation
+ * of weights in the ring buffers of the targets. Emission and exchange of
+ * spikes are not measured.
+ */
+void
+deliver_events( BenchmarkState& state )
+{
+  const nest::NodeCollectionPTR sources = build_synthetic_network( state );
+  nest::prepare();
+
+  state.set_items_per_iteration( state.config().num_sources, state.config().num_sources * state.config().fan_out );
+  while ( state.keep_running() )
+  {
+    state.pause_timing();
+    emit_spikes( sources );
+    nest::kernel().event_delivery_manager.gather_spike_data();
+    state.resume_timing();
+
+#pragma omp parallel
+    {
+      nest::kernel().event_delivery_manager.deliver_events( nest::kernel().vp_manager.get_thread_id() );
+    }
+  }
+
+  nest::cleanup();
+}
+NEST_BENCHMARK( deliver_events, true );
+
+/**
+ * Collocation of emitted spikes into MPI buffers and their exchange.
+ */
+void
+gather_spike_data( BenchmarkState& state )
+{
+  const nest::NodeCollectionPTR sources = build_synthetic_network( state );
+  nest::prepare();
+
+  state.set_items_per_iteration( state.config().num_sources, 0 );
+  while ( state.keep_running() )
+  {
+    state.pause_timing();
+    emit_spikes( sources );
+    state.resume_timing();
+
+    nest::kernel().event_delivery_manager.gather_spike_data();
+
+    state.pause_timing();
+#pragma omp parallel
+    {
+      nest::kernel().event_delivery_manager.deliver_events( nest::kernel().vp_manager.get_thread_id() );
+    }
+    state.resume_timing();
+  }
+
+  nest::cleanup();
+}
+NEST_BENCHMARK( gather_spike_data, true );
+
+/**
+ * Accumulation of weights in a ring buffer.
+ *
+ * Each iteration adds one weight per synapse at pseudo-random offsets,
+ * mimicking the delivery of spikes with heterogeneous delays.
+ */
+void
+ring_buffer_add_value( BenchmarkState& state )
+{
+  nest::reset_kernel();
+  DictionaryDatum kernel_dict( new Dictionary );
+  def< double >( kernel_dict, nest::names::min_delay, 0.1 );
+  def< double >( kernel_dict, nest::names::max_delay, 10.0 );
+  nest::set_kernel_status( kernel_dict );
+  nest::kernel().event_delivery_manager.init_moduli();
+
+  nest::RingBuffer buffer;
+  const long max_offset = nest::kernel().connection_manager.get_max_delay();
+
+  const size_t num_synapses = state.config().fan_in;
+  std::vector< long > offsets( num_synapses );
+  for ( size_t i = 0; i < num_synapses; ++i )
+  {
+    offsets[ i ] = ( 7919 * i ) % max_offset;
+  }
+
+  state.set_items_per_iteration( 0, num_synapses );
+  while ( state.keep_running() )
+  {
+    for ( const long offset : offsets )
+    {
+      buffer.add_value( offset, 1.0 );
+    }
+    do_not_optimize( buffer );
+  }
+}
+NEST_BENCHMARK( ring_buffer_add_value, false );
+
+} // namespace nest_benchmarks
+
+#endif /* BENCH_SPIKE_DELIVERY_H */
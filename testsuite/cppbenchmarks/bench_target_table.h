@@ -0,0 +1,65 @@
+/*
+ *  bench_target_table.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef BENCH_TARGET_TABLE_H
+#define BENCH_TARGET_TABLE_H
+
+// Includes from nestkernel:
+#include "kernel_manager.h"
+
+// Includes from cppbenchmarks:
+#include "benchmark.h"
+#include "synthetic_network.h"
+
+namespace nest_benchmarks
+{
+
+/**
+ * Construction of the presynaptic connection infrastructure.
+ *
+ * Measures sorting of connections, restructuring of the connection tables
+ * and communication of target data to the presynaptic side, i.e., the work
+ * done at the beginning of the first simulation after connections have been
+ * created.
+ */
+void
+update_connection_infrastructure( BenchmarkState& state )
+{
+  state.set_items_per_iteration( 0, state.config().num_sources * state.config().fan_out );
+  while ( state.keep_running() )
+  {
+    state.pause_timing();
+    build_synthetic_network( state );
+    nest::kernel().node_manager.check_wfr_use();
+    state.resume_timing();
+
+#pragma omp parallel
+    {
+      nest::kernel().simulation_manager.update_connection_infrastructure( nest::kernel().vp_manager.get_thread_id() );
+    }
+  }
+}
+NEST_BENCHMARK( update_connection_infrastructure, true );
+
+} // namespace nest_benchmarks
+
+#endif /* BENCH_TARGET_TABLE_H */
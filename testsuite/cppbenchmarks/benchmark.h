@@ -0,0 +1,347 @@
+/*
+ *  benchmark.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+// C++ includes:
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+// C includes:
+#include <sys/resource.h>
+
+/**
+ * Minimal benchmark harness.
+ *
+ * The interface follows Google Benchmark, which is not a dependency of NEST.
+ */
+namespace nest_benchmarks
+{
+
+/**
+ * Parameters of synthetic networks and of time measurement, set from the command line.
+ */
+struct BenchmarkConfig
+{
+  size_t num_sources = 1000;
+  size_t fan_out = 100;
+  size_t fan_in = 100;
+  size_t num_threads = 1;
+  double min_time = 0.5;
+  std::vector< std::string > synapse_models { "static_synapse" };
+  std::string filter;
+
+  //! Number of targets such that targets have on average fan_in incoming connections
+  size_t
+  num_targets() const
+  {
+    return std::max( size_t( 1 ), num_sources * fan_out / fan_in );
+  }
+};
+
+/**
+ * State of a single benchmark run with a fixed number of iterations.
+ */
+class BenchmarkState
+{
+public:
+  BenchmarkState( const BenchmarkConfig& config, const std::string& synapse_model, const size_t max_iterations )
+    : config_( config )
+    , synapse_model_( synapse_model )
+    , max_iterations_( max_iterations )
+    , iterations_( 0 )
+    , spikes_per_iteration_( 0 )
+    , synapses_per_iteration_( 0 )
+    , started_( false )
+    , running_( false )
+    , elapsed_( 0 )
+  {
+  }
+
+  /**
+   * Returns true as long as the benchmark loop is to be repeated.
+   *
+   * Time is measured from the first call to the last call.
+   */
+  bool
+  keep_running()
+  {
+    if ( not started_ )
+    {
+      started_ = true;
+      resume_timing();
+    }
+    else
+    {
+      ++iterations_;
+    }
+
+    if ( iterations_ < max_iterations_ )
+    {
+      return true;
+    }
+
+    pause_timing();
+    return false;
+  }
+
+  //! Exclude code from time measurement
+  void
+  pause_timing()
+  {
+    if ( running_ )
+    {
+      elapsed_ += std::chrono::steady_clock::now() - start_;
+      running_ = false;
+    }
+  }
+
+  //! Continue time measurement after pause_timing()
+  void
+  resume_timing()
+  {
+    start_ = std::chrono::steady_clock::now();
+    running_ = true;
+  }
+
+  //! Set numbers of spikes and synapses processed in each iteration, used for reporting
+  void
+  set_items_per_iteration( const size_t spikes, const size_t synapses )
+  {
+    spikes_per_iteration_ = spikes;
+    synapses_per_iteration_ = synapses;
+  }
+
+  const BenchmarkConfig&
+  config() const
+  {
+    return config_;
+  }
+
+  const std::string&
+  synapse_model() const
+  {
+    return synapse_model_;
+  }
+
+  size_t
+  iterations() const
+  {
+    return iterations_;
+  }
+
+  size_t
+  spikes_per_iteration() const
+  {
+    return spikes_per_iteration_;
+  }
+
+  size_t
+  synapses_per_iteration() const
+  {
+    return synapses_per_iteration_;
+  }
+
+  //! Measured time in seconds
+  double
+  elapsed() const
+  {
+    return std::chrono::duration< double >( elapsed_ ).count();
+  }
+
+private:
+  const BenchmarkConfig& config_;
+  const std::string synapse_model_;
+  const size_t max_iterations_;
+  size_t iterations_;
+  size_t spikes_per_iteration_;
+  size_t synapses_per_iteration_;
+  bool started_;
+  bool running_;
+  std::chrono::steady_clock::time_point start_;
+  std::chrono::steady_clock::duration elapsed_;
+};
+
+/**
+ * Prevent the compiler from optimizing away computations whose results are otherwise unused.
+ */
+template < typename T >
+inline void
+do_not_optimize( T& value )
+{
+#ifdef __GNUC__
+  asm volatile( "" : : "r,m"( value ) : "memory" );
+#else
+  static volatile T* sink = nullptr;
+  sink = &value;
+#endif
+}
+
+typedef void ( *BenchmarkFunction )( BenchmarkState& );
+
+struct RegisteredBenchmark
+{
+  std::string name;
+  BenchmarkFunction function;
+  bool per_synapse_model; //!< run once for each synapse model
+};
+
+inline std::vector< RegisteredBenchmark >&
+registered_benchmarks()
+{
+  static std::vector< RegisteredBenchmark > benchmarks;
+  return benchmarks;
+}
+
+struct BenchmarkRegistrar
+{
+  BenchmarkRegistrar( const std::string& name, BenchmarkFunction function, const bool per_synapse_model )
+  {
+    registered_benchmarks().push_back( { name, function, per_synapse_model } );
+  }
+};
+
+/**
+ * Register benchmark function.
+ *
+ * If per_synapse_model is true, the benchmark is run once for each synapse
+ * model given on the command line.
+ */
+#define NEST_BENCHMARK( function, per_synapse_model ) \
+  static nest_benchmarks::BenchmarkRegistrar registrar_##function( #function, function, per_synapse_model )
+
+/**
+ * Peak resident set size of the process in MiB.
+ *
+ * The peak is taken over the lifetime of the process, i.e., over all
+ * benchmarks run so far.
+ */
+inline double
+peak_rss_mib()
+{
+  rusage usage;
+  getrusage( RUSAGE_SELF, &usage );
+#ifdef __APPLE__
+  return usage.ru_maxrss / ( 1024.0 * 1024.0 ); // bytes
+#else
+  return usage.ru_maxrss / 1024.0; // KiB
+#endif
+}
+
+/**
+ * Print time per iteration and per item, or "-" if no items are processed, and peak RSS.
+ */
+inline void
+print_result( const std::string& name, const std::string& synapse_model, const BenchmarkState& state )
+{
+  const double ns_per_iteration = 1e9 * state.elapsed() / state.iterations();
+
+  char per_spike[ 32 ] = "-";
+  if ( state.spikes_per_iteration() > 0 )
+  {
+    std::snprintf( per_spike, sizeof( per_spike ), "%.2f", ns_per_iteration / state.spikes_per_iteration() );
+  }
+  char per_synapse[ 32 ] = "-";
+  if ( state.synapses_per_iteration() > 0 )
+  {
+    std::snprintf( per_synapse, sizeof( per_synapse ), "%.2f", ns_per_iteration / state.synapses_per_iteration() );
+  }
+
+  std::printf( "%-28s %-24s %12zu %16.0f %12s %12s %16.1f\n",
+    name.c_str(),
+    synapse_model.c_str(),
+    state.iterations(),
+    ns_per_iteration,
+    per_spike,
+    per_synapse,
+    peak_rss_mib() );
+  std::fflush( stdout );
+}
+
+/**
+ * Run benchmark with increasing numbers of iterations until at least min_time is measured.
+ */
+inline void
+run_benchmark( const RegisteredBenchmark& benchmark, const BenchmarkConfig& config, const std::string& synapse_model )
+{
+  constexpr size_t max_iterations = 1000000000;
+
+  size_t iterations = 1;
+  while ( true )
+  {
+    BenchmarkState state( config, synapse_model, iterations );
+    benchmark.function( state );
+
+    if ( state.elapsed() >= config.min_time or iterations >= max_iterations )
+    {
+      print_result( benchmark.name, synapse_model, state );
+      return;
+    }
+
+    // Predict number of iterations required, with some margin, but grow at most tenfold
+    const double predicted = 1.4 * iterations * config.min_time / std::max( state.elapsed(), 1e-9 );
+    iterations = std::min( max_iterations,
+      std::max( iterations + 1, std::min( 10 * iterations, static_cast< size_t >( std::ceil( predicted ) ) ) ) );
+  }
+}
+
+inline void
+run_registered_benchmarks( const BenchmarkConfig& config )
+{
+  std::printf( "%-28s %-24s %12s %16s %12s %12s %16s\n",
+    "Benchmark",
+    "Synapse model",
+    "Iterations",
+    "ns/iteration",
+    "ns/spike",
+    "ns/synapse",
+    "Peak RSS/MiB" );
+
+  for ( const auto& benchmark : registered_benchmarks() )
+  {
+    if ( benchmark.name.find( config.filter ) == std::string::npos )
+    {
+      continue;
+    }
+
+    if ( benchmark.per_synapse_model )
+    {
+      for ( const auto& synapse_model : config.synapse_models )
+      {
+        run_benchmark( benchmark, config, synapse_model );
+      }
+    }
+    else
+    {
+      run_benchmark( benchmark, config, "-" );
+    }
+  }
+}
+
+} // namespace nest_benchmarks
+
+#endif /* BENCHMARK_H */
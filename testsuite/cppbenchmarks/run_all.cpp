@@ -0,0 +1,161 @@
+/*
+ *  run_all.cpp
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+// C++ includes:
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+// Includes from nestkernel:
+#include "kernel_manager.h"
+#include "nest.h"
+
+// Includes from cppbenchmarks
+#include "benchmark.h"
+#include "bench_connect.h"
+#include "bench_spike_delivery.h"
+#include "bench_target_table.h"
+
+namespace
+{
+
+void
+print_usage( const char* program )
+{
+  const nest_benchmarks::BenchmarkConfig defaults;
+  std::cout << "Usage: " << program << " [options]\n\n"
+            << "Options:\n"
+            << "  --num_sources=N        number of source neurons [" << defaults.num_sources << "]\n"
+            << "  --fan_out=N            outgoing connections per source [" << defaults.fan_out << "]\n"
+            << "  --fan_in=N             average incoming connections per target [" << defaults.fan_in << "]\n"
+            << "  --synapse_models=M,... synapse models [" << defaults.synapse_models[ 0 ] << "]\n"
+            << "  --num_threads=N        number of threads [" << defaults.num_threads << "]\n"
+            << "  --min_time=T           minimal measured time per benchmark in s [" << defaults.min_time << "]\n"
+            << "  --filter=S             only run benchmarks whose name contains S\n";
+}
+
+/**
+ * Parse command line options into config.
+ *
+ * @returns false if an option is unknown or malformed
+ */
+bool
+parse_options( const int argc, char* argv[], nest_benchmarks::BenchmarkConfig& config )
+{
+  for ( int i = 1; i < argc; ++i )
+  {
+    const std::string arg( argv[ i ] );
+    const size_t eq_pos = arg.find( '=' );
+    if ( arg.compare( 0, 2, "--" ) != 0 or eq_pos == std::string::npos )
+    {
+      return false;
+    }
+
+    const std::string key = arg.substr( 2, eq_pos - 2 );
+    const std::string value = arg.substr( eq_pos + 1 );
+
+    if ( key == "num_sources" )
+    {
+      config.num_sources = std::stoul( value );
+    }
+    else if ( key == "fan_out" )
+    {
+      config.fan_out = std::stoul( value );
+    }
+    else if ( key == "fan_in" )
+    {
+      config.fan_in = std::max( 1UL, std::stoul( value ) );
+    }
+    else if ( key == "num_threads" )
+    {
+      config.num_threads = std::max( 1UL, std::stoul( value ) );
+    }
+    else if ( key == "min_time" )
+    {
+      config.min_time = std::stod( value );
+    }
+    else if ( key == "filter" )
+    {
+      config.filter = value;
+    }
+    else if ( key == "synapse_models" )
+    {
+      config.synapse_models.clear();
+      std::istringstream models( value );
+      std::string model;
+      while ( std::getline( models, model, ',' ) )
+      {
+        config.synapse_models.push_back( model );
+      }
+    }
+    else
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+} // namespace
+
+int
+main( int argc, char* argv[] )
+{
+  nest_benchmarks::BenchmarkConfig config;
+  try
+  {
+    if ( not parse_options( argc, argv, config ) )
+    {
+      print_usage( argv[ 0 ] );
+      return EXIT_FAILURE;
+    }
+  }
+  catch ( std::logic_error& )
+  {
+    // thrown by std::stoul() and std::stod()
+    print_usage( argv[ 0 ] );
+    return EXIT_FAILURE;
+  }
+
+  // Options have been parsed, do not pass them on to the kernel
+  int kernel_argc = 1;
+  nest::init_nest( &kernel_argc, &argv );
+
+  int exitcode = EXIT_SUCCESS;
+  try
+  {
+    nest_benchmarks::run_registered_benchmarks( config );
+  }
+  catch ( std::exception& e )
+  {
+    std::cerr << "Benchmark failed: " << e.what() << std::endl;
+    exitcode = EXIT_FAILURE;
+  }
+
+  nest::kernel().finalize();
+  nest::kernel().mpi_manager.mpi_finalize( exitcode );
+  nest::KernelManager::destroy_kernel_manager();
+
+  return exitcode;
+}
@@ -0,0 +1,98 @@
+/*
+ *  synthetic_network.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef SYNTHETIC_NETWORK_H
+#define SYNTHETIC_NETWORK_H
+
+// C++ includes:
+#include <tuple>
+#include <utility>
+
+// Includes from nestkernel:
+#include "nest.h"
+#include "nest_names.h"
+#include "node_collection.h"
+
+// Includes from sli:
+#include "dictutils.h"
+
+// Includes from cppbenchmarks:
+#include "benchmark.h"
+
+namespace nest_benchmarks
+{
+
+/**
+ * Reset the kernel and create num_sources parrot neurons as sources and
+ * num_targets iaf_psc_alpha neurons as targets.
+ *
+ * @returns node collections of sources and targets
+ */
+inline std::pair< nest::NodeCollectionPTR, nest::NodeCollectionPTR >
+create_synthetic_nodes( const BenchmarkState& state, const size_t num_targets )
+{
+  const BenchmarkConfig& config = state.config();
+
+  nest::reset_kernel();
+
+  DictionaryDatum kernel_dict( new Dictionary );
+  def< long >( kernel_dict, nest::names::local_num_threads, config.num_threads );
+  nest::set_kernel_status( kernel_dict );
+
+  nest::NodeCollectionPTR sources = nest::create( "parrot_neuron", config.num_sources );
+  nest::NodeCollectionPTR targets = nest::create( "iaf_psc_alpha", num_targets );
+
+  return { sources, targets };
+}
+
+/**
+ * Reset the kernel and build network with fan-out and fan-in given by the configuration.
+ *
+ * Sources are parrot neurons connected to iaf_psc_alpha targets with the
+ * fixed_outdegree rule using the synapse model of the benchmark state.
+ *
+ * @returns node collection of sources
+ */
+inline nest::NodeCollectionPTR
+build_synthetic_network( const BenchmarkState& state )
+{
+  const BenchmarkConfig& config = state.config();
+
+  nest::NodeCollectionPTR sources;
+  nest::NodeCollectionPTR targets;
+  std::tie( sources, targets ) = create_synthetic_nodes( state, config.num_targets() );
+
+  DictionaryDatum conn_spec( new Dictionary );
+  def< std::string >( conn_spec, nest::names::rule, "fixed_outdegree" );
+  def< long >( conn_spec, nest::names::outdegree, config.fan_out );
+
+  DictionaryDatum syn_spec( new Dictionary );
+  def< std::string >( syn_spec, nest::names::synapse_model, state.synapse_model() );
+
+  nest::connect( sources, targets, conn_spec, { syn_spec } );
+
+  return sources;
+}
+
+} // namespace nest_benchmarks
+
+#endif /* SYNTHETIC_NETWORK_H */
@@ -26,6 +26,8 @@
 
 // Includes from cpptests
 #include "test_block_vector.h"
+#include "test_compressed_source_vector.h"
+#include "test_counter_based_random_stream.h"
 #include "test_enum_bitfield.h"
 #include "test_parameter.h"
 #include "test_sort.h"
@@ -113,6 +113,41 @@ BOOST_AUTO_TEST_CASE( test_clear )
   BOOST_REQUIRE( n_elements == 0 );
 }
 
+BOOST_AUTO_TEST_CASE( test_reserve )
+{
+  BlockVector< int > block_vector;
+  const int N_first = 10;
+  for ( int i = 0; i < N_first; ++i )
+  {
+    block_vector.push_back( i );
+  }
+
+  // reserve more than fits into the current block, then fill beyond the reserved size
+  const int N = 3 * block_vector.get_max_block_size() + 5;
+  block_vector.reserve( N );
+  BOOST_REQUIRE( block_vector.size() == static_cast< size_t >( N_first ) );
+  for ( int i = N_first; i < N + 10; ++i )
+  {
+    block_vector.push_back( i );
+  }
+
+  BOOST_REQUIRE( block_vector.size() == static_cast< size_t >( N + 10 ) );
+  int expected = 0;
+  for ( const int& value : block_vector )
+  {
+    BOOST_REQUIRE( value == expected );
+    ++expected;
+  }
+  BOOST_REQUIRE( expected == N + 10 );
+
+  // erasing releases reserved blocks
+  block_vector.reserve( 10 * block_vector.get_max_block_size() );
+  block_vector.erase( block_vector.begin() + 2, block_vector.end() );
+  BOOST_REQUIRE( block_vector.size() == 2 );
+  block_vector.push_back( 2 );
+  BOOST_REQUIRE( block_vector[ 2 ] == 2 );
+}
+
 BOOST_AUTO_TEST_CASE( test_erase )
 {
   int N = 10;
@@ -0,0 +1,145 @@
+/*
+ *  test_compressed_source_vector.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef TEST_COMPRESSED_SOURCE_VECTOR_H
+#define TEST_COMPRESSED_SOURCE_VECTOR_H
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+// C++ includes:
+#include <algorithm>
+#include <random>
+#include <vector>
+
+// Includes from nestkernel:
+#include "compressed_source_vector.h"
+
+namespace nest
+{
+
+/**
+ * Fixture creating sorted node IDs with runs of random length and random gaps, including large gaps.
+ */
+struct compressed_source_vector_fixture
+{
+  compressed_source_vector_fixture()
+  {
+    std::mt19937 rng( 1234 );
+    size_t node_id = 1;
+    for ( size_t i = 0; i < 5000; ++i )
+    {
+      if ( rng() % 3 == 0 )
+      {
+        node_id += 1 + ( i % 100 == 0 ? rng() : rng() % 10 );
+      }
+      node_ids.push_back( node_id );
+      sources.push_back( Source( node_id, true ) );
+    }
+    BOOST_REQUIRE( compressed.assign( sources ) );
+  }
+
+  std::vector< size_t > node_ids;
+  BlockVector< Source > sources;
+  CompressedSourceVector compressed;
+};
+
+BOOST_AUTO_TEST_SUITE( test_compressed_source_vector )
+
+BOOST_FIXTURE_TEST_CASE( test_get_node_id, compressed_source_vector_fixture )
+{
+  BOOST_REQUIRE( compressed.size() == node_ids.size() );
+  for ( size_t lcid = 0; lcid < node_ids.size(); ++lcid )
+  {
+    BOOST_REQUIRE( compressed.get_node_id( lcid ) == node_ids[ lcid ] );
+  }
+}
+
+BOOST_FIXTURE_TEST_CASE( test_get_run, compressed_source_vector_fixture )
+{
+  for ( size_t lcid = 0; lcid < node_ids.size(); ++lcid )
+  {
+    const SourceRun run = compressed.get_run( lcid );
+    const size_t first_lcid = std::lower_bound( node_ids.begin(), node_ids.end(), node_ids[ lcid ] ) - node_ids.begin();
+    const size_t end_lcid = std::upper_bound( node_ids.begin(), node_ids.end(), node_ids[ lcid ] ) - node_ids.begin();
+    BOOST_REQUIRE( run.node_id == node_ids[ lcid ] );
+    BOOST_REQUIRE( run.first_lcid == first_lcid );
+    BOOST_REQUIRE( run.length == end_lcid - first_lcid );
+    BOOST_REQUIRE( run.is_primary );
+  }
+}
+
+BOOST_FIXTURE_TEST_CASE( test_find_first, compressed_source_vector_fixture )
+{
+  for ( size_t lcid = 0; lcid < node_ids.size(); ++lcid )
+  {
+    const size_t first_lcid = std::lower_bound( node_ids.begin(), node_ids.end(), node_ids[ lcid ] ) - node_ids.begin();
+    BOOST_REQUIRE( compressed.find_first( node_ids[ lcid ] ) == first_lcid );
+  }
+  BOOST_REQUIRE( compressed.find_first( 0 ) == invalid_index );
+  BOOST_REQUIRE( compressed.find_first( node_ids.back() + 1 ) == invalid_index );
+}
+
+BOOST_FIXTURE_TEST_CASE( test_for_each_run, compressed_source_vector_fixture )
+{
+  size_t num_entries = 0;
+  size_t num_runs = 0;
+  compressed.for_each_run(
+    [ & ]( const SourceRun& run )
+    {
+      BOOST_REQUIRE( run.index == num_runs );
+      BOOST_REQUIRE( run.first_lcid == num_entries );
+      BOOST_REQUIRE( run.node_id == node_ids[ run.first_lcid ] );
+      num_entries += run.length;
+      ++num_runs;
+    } );
+  BOOST_REQUIRE( num_entries == node_ids.size() );
+  BOOST_REQUIRE( num_runs == compressed.num_runs() );
+}
+
+BOOST_FIXTURE_TEST_CASE( test_processed_flags, compressed_source_vector_fixture )
+{
+  const SourceRun run = compressed.get_run( node_ids.size() / 2 );
+  BOOST_REQUIRE( not compressed.is_processed( run ) );
+  compressed.set_processed( run, true );
+  BOOST_REQUIRE( compressed.is_processed( compressed.get_run( run.first_lcid + run.length - 1 ) ) );
+  BOOST_REQUIRE( not compressed.is_processed( compressed.get_run( run.first_lcid + run.length ) ) );
+  compressed.reset_processed_flags();
+  BOOST_REQUIRE( not compressed.is_processed( run ) );
+}
+
+BOOST_AUTO_TEST_CASE( test_reject_unsorted )
+{
+  BlockVector< Source > sources;
+  sources.push_back( Source( 5, true ) );
+  sources.push_back( Source( 3, true ) );
+
+  CompressedSourceVector compressed;
+  BOOST_REQUIRE( not compressed.assign( sources ) );
+  BOOST_REQUIRE( compressed.empty() );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace nest
+
+#endif /* TEST_COMPRESSED_SOURCE_VECTOR_H */
@@ -0,0 +1,105 @@
+/*
+ *  test_counter_based_random_stream.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef TEST_COUNTER_BASED_RANDOM_STREAM_H
+#define TEST_COUNTER_BASED_RANDOM_STREAM_H
+
+// C++ includes:
+#include <cmath>
+
+// Includes from nestkernel:
+#include "random_generators.h"
+
+namespace nest
+{
+
+BOOST_AUTO_TEST_SUITE( test_counter_based_random_stream )
+
+/**
+ * Streams with equal keys must produce equal numbers, streams with different keys different numbers.
+ */
+BOOST_AUTO_TEST_CASE( test_stream_determined_by_key )
+{
+  CounterBasedRandomStream a( { 1, 2, 3 } );
+  CounterBasedRandomStream b( { 1, 2, 3 } );
+  CounterBasedRandomStream c( { 1, 3, 2 } );
+
+  for ( int i = 0; i < 10; ++i )
+  {
+    const std::uint64_t x = a.next();
+    BOOST_REQUIRE( x == b.next() );
+    BOOST_REQUIRE( x != c.next() );
+  }
+}
+
+/**
+ * Sample means of binomial and hypergeometric numbers must be within five standard errors of the mean.
+ */
+BOOST_AUTO_TEST_CASE( test_binomial_hypergeometric_mean )
+{
+  const size_t num_samples = 10000;
+  const size_t n = 1000;
+  const size_t successes = 300;
+  const size_t population = 2000;
+  const double p = static_cast< double >( successes ) / population;
+
+  double binomial_sum = 0;
+  double hypergeometric_sum = 0;
+  for ( size_t i = 0; i < num_samples; ++i )
+  {
+    CounterBasedRandomStream stream( { 12345, i } );
+    const size_t k_binomial = stream.binomial( n, p );
+    const size_t k_hypergeometric = stream.hypergeometric( n, successes, population );
+    BOOST_REQUIRE( k_binomial <= n );
+    BOOST_REQUIRE( k_hypergeometric <= successes );
+    binomial_sum += k_binomial;
+    hypergeometric_sum += k_hypergeometric;
+  }
+
+  const double mean = n * p;
+  const double binomial_sd = std::sqrt( n * p * ( 1 - p ) );
+  const double hypergeometric_sd = binomial_sd * std::sqrt( ( population - n ) / ( population - 1.0 ) );
+  BOOST_REQUIRE( std::abs( binomial_sum / num_samples - mean ) < 5 * binomial_sd / std::sqrt( num_samples ) );
+  BOOST_REQUIRE(
+    std::abs( hypergeometric_sum / num_samples - mean ) < 5 * hypergeometric_sd / std::sqrt( num_samples ) );
+}
+
+/**
+ * Degenerate cases must return the only possible value.
+ */
+BOOST_AUTO_TEST_CASE( test_binomial_hypergeometric_limits )
+{
+  CounterBasedRandomStream stream( { 42 } );
+
+  BOOST_REQUIRE( stream.binomial( 10, 0.0 ) == 0 );
+  BOOST_REQUIRE( stream.binomial( 10, 1.0 ) == 10 );
+  BOOST_REQUIRE( stream.hypergeometric( 10, 0, 20 ) == 0 );
+  BOOST_REQUIRE( stream.hypergeometric( 10, 20, 20 ) == 10 );
+  BOOST_REQUIRE( stream.hypergeometric( 15, 10, 20 ) >= 5 );
+  BOOST_REQUIRE( stream.hypergeometric( 20, 7, 20 ) == 7 );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace nest
+
+#endif /* TEST_COUNTER_BASED_RANDOM_STREAM_H */
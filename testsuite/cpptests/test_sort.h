@@ -28,6 +28,7 @@
 
 // C++ includes:
 #include <algorithm>
+#include <random>
 #include <vector>
 
 // Includes from libnestutil:
@@ -232,6 +233,109 @@ BOOST_FIXTURE_TEST_CASE( test_boost_linear, fill_bv_vec_linear )
   BOOST_REQUIRE( std::equal( vec_sort_small.begin(), vec_sort_small.end(), bv_perm_small.begin() ) );
 }
 
+/**
+ * Tests whether two arrays with randomly generated numbers are sorted
+ * correctly when sorting with radix sort.
+ */
+BOOST_FIXTURE_TEST_CASE( test_radix_random, fill_bv_vec_random )
+{
+  nest::radix_sort( bv_sort, bv_perm );
+
+  BOOST_REQUIRE( std::equal( vec_sort.begin(), vec_sort.end(), bv_sort.begin() ) );
+  BOOST_REQUIRE( std::equal( vec_sort.begin(), vec_sort.end(), bv_perm.begin() ) );
+
+  nest::radix_sort( bv_sort_small, bv_perm_small );
+
+  BOOST_REQUIRE( std::equal( vec_sort_small.begin(), vec_sort_small.end(), bv_sort_small.begin() ) );
+  BOOST_REQUIRE( std::equal( vec_sort_small.begin(), vec_sort_small.end(), bv_perm_small.begin() ) );
+}
+
+/**
+ * Tests whether two arrays with linearly decreasing numbers are sorted
+ * correctly when sorting with radix sort.
+ */
+BOOST_FIXTURE_TEST_CASE( test_radix_linear, fill_bv_vec_linear )
+{
+  nest::radix_sort( bv_sort, bv_perm );
+
+  BOOST_REQUIRE( std::equal( vec_sort.begin(), vec_sort.end(), bv_sort.begin() ) );
+  BOOST_REQUIRE( std::equal( vec_sort.begin(), vec_sort.end(), bv_perm.begin() ) );
+
+  nest::radix_sort( bv_sort_small, bv_perm_small );
+
+  BOOST_REQUIRE( std::equal( vec_sort_small.begin(), vec_sort_small.end(), bv_sort_small.begin() ) );
+  BOOST_REQUIRE( std::equal( vec_sort_small.begin(), vec_sort_small.end(), bv_perm_small.begin() ) );
+}
+
+/**
+ * Tests that radix sort handles negative numbers and keeps the order of
+ * equal entries.
+ */
+BOOST_AUTO_TEST_CASE( test_radix_negative_stable )
+{
+  const size_t N = 5000;
+  BlockVector< int > bv_sort;
+  BlockVector< size_t > bv_perm;
+  std::mt19937 rng( 42 );
+  for ( size_t i = 0; i < N; ++i )
+  {
+    bv_sort.push_back( static_cast< int >( rng() % 200 ) - 100 );
+    bv_perm.push_back( i );
+  }
+
+  std::vector< std::pair< int, size_t > > expected;
+  for ( size_t i = 0; i < N; ++i )
+  {
+    expected.emplace_back( bv_sort[ i ], i );
+  }
+  std::stable_sort( expected.begin(),
+    expected.end(),
+    []( const std::pair< int, size_t >& a, const std::pair< int, size_t >& b ) { return a.first < b.first; } );
+
+  nest::radix_sort( bv_sort, bv_perm );
+
+  for ( size_t i = 0; i < N; ++i )
+  {
+    BOOST_REQUIRE( bv_sort[ i ] == expected[ i ].first );
+    BOOST_REQUIRE( bv_perm[ i ] == expected[ i ].second );
+  }
+}
+
+/**
+ * Tests that radix sort sorts Sources by node ID if the vectors are larger
+ * than one chunk, also when the chunks are sorted by tasks of several
+ * threads.
+ */
+BOOST_AUTO_TEST_CASE( test_radix_sources )
+{
+  const size_t N = 3 * RADIX_SORT_CHUNK_SIZE + 17;
+  BlockVector< nest::Source > bv_sort;
+  BlockVector< size_t > bv_perm;
+  std::vector< size_t > vec_sort;
+  std::mt19937_64 rng( 42 );
+  for ( size_t i = 0; i < N; ++i )
+  {
+    // include node IDs that need more than 32 bits
+    const size_t node_id = 1 + ( i % 7 == 0 ? rng() % ( 1UL << 40 ) : rng() % 1000 );
+    bv_sort.push_back( nest::Source( node_id, true ) );
+    bv_perm.push_back( node_id );
+    vec_sort.push_back( node_id );
+  }
+  std::sort( vec_sort.begin(), vec_sort.end() );
+
+#pragma omp parallel
+  {
+#pragma omp single
+    nest::radix_sort( bv_sort, bv_perm );
+  }
+
+  for ( size_t i = 0; i < N; ++i )
+  {
+    BOOST_REQUIRE( bv_sort[ i ].get_node_id() == vec_sort[ i ] );
+    BOOST_REQUIRE( bv_perm[ i ] == vec_sort[ i ] );
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 #endif /* TEST_SORT_H */
@@ -0,0 +1,51 @@
+# -*- coding: utf-8 -*-
+#
+# test_recording_backend_statistics_mpi.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+Test that the ``statistics`` recording backend reduces the statistics of all MPI processes to rank 0.
+"""
+
+import nest
+import numpy as np
+
+
+def test_statistics_reduced_to_rank_zero():
+    """
+    Rank 0 must report the statistics of all senders, all other ranks those of their local senders.
+    """
+
+    nest.ResetKernel()
+
+    neurons = nest.Create("iaf_psc_alpha", 10, params={"I_e": 450.0})
+    sr = nest.Create("spike_recorder", params={"record_to": "statistics", "bin_width": 5.0})
+    nest.Connect(neurons, sr)
+    nest.Simulate(200.0)
+
+    stats = sr.statistics
+    local_neurons = sorted(n.global_id for n in neurons if n.vp % nest.NumProcesses() == nest.Rank())
+
+    if nest.Rank() == 0:
+        np.testing.assert_array_equal(stats["senders"], neurons.tolist())
+    else:
+        np.testing.assert_array_equal(stats["senders"], local_neurons)
+
+    assert len(stats["histogram"]) == 40
+    assert sum(stats["spike_counts"]) == sum(stats["histogram"])
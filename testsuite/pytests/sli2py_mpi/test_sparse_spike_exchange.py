@@ -0,0 +1,58 @@
+# -*- coding: utf-8 -*-
+#
+# test_sparse_spike_exchange.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+
+from mpi_test_wrapper import MPITestAssertEqual
+
+
+@MPITestAssertEqual([1, 2, 4])
+def test_sparse_spike_exchange():
+    """
+    Confirm that network with sparse spike exchange is invariant under number of MPI ranks.
+    """
+
+    import nest
+
+    nest.ResetKernel()
+
+    nest.set(total_num_virtual_procs=4, overwrite_files=True, use_sparse_spike_exchange=True)
+
+    nrns = nest.Create("iaf_psc_alpha", 400, params={"I_e": 370.0})
+    pg = nest.Create("poisson_generator", params={"rate": 5000.0})
+    srec = nest.Create(
+        "spike_recorder",
+        params={
+            "label": SPIKE_LABEL.format(nest.num_processes),  # noqa: F821
+            "record_to": "ascii",
+            "time_in_steps": True,
+        },
+    )
+
+    nest.Connect(pg, nrns, syn_spec={"weight": 10.0, "delay": 1.0})
+    nest.Connect(
+        nrns,
+        nrns,
+        {"rule": "fixed_indegree", "indegree": 50},
+        syn_spec={"weight": -10.0, "delay": 1.0},
+    )
+    nest.Connect(nrns, srec)
+
+    nest.Simulate(200)
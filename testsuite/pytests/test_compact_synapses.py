@@ -0,0 +1,156 @@
+# -*- coding: utf-8 -*-
+#
+# test_compact_synapses.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+Test that compact static synapses behave like static_synapse while requiring less memory.
+"""
+
+import nest
+import numpy as np
+import pytest
+
+COMPACT_MODELS = ["static_synapse_compact", "static_synapse_quantized"]
+
+
+@pytest.fixture(autouse=True)
+def reset():
+    nest.ResetKernel()
+
+
+def simulate_network(synapse_model):
+    """
+    Simulate a small recurrent network and return spikes and final membrane potentials.
+
+    All weights are multiples of the default weight scale of static_synapse_quantized
+    and exactly representable in single precision.
+    """
+
+    nest.ResetKernel()
+    pop = nest.Create("iaf_psc_alpha", 20, params={"I_e": 350.0})
+    pg = nest.Create("poisson_generator", params={"rate": 20000.0})
+    sr = nest.Create("spike_recorder")
+
+    nest.Connect(pg, pop, syn_spec={"synapse_model": synapse_model, "weight": 5.0})
+    nest.Connect(
+        pop,
+        pop,
+        {"rule": "fixed_indegree", "indegree": 5},
+        syn_spec={"synapse_model": synapse_model, "weight": -20.5, "delay": 1.5},
+    )
+    nest.Connect(pop, sr)
+    nest.Simulate(100.0)
+
+    return sr.events, pop.V_m
+
+
+@pytest.mark.parametrize("synapse_model", COMPACT_MODELS)
+def test_compact_synapse_identical_results(synapse_model):
+    """
+    Spikes and membrane potentials must not differ from those obtained with static_synapse.
+    """
+
+    spikes_ref, V_m_ref = simulate_network("static_synapse")
+    spikes, V_m = simulate_network(synapse_model)
+
+    assert len(spikes_ref["times"]) > 0
+    np.testing.assert_array_equal(spikes["senders"], spikes_ref["senders"])
+    np.testing.assert_array_equal(spikes["times"], spikes_ref["times"])
+    np.testing.assert_array_equal(V_m, V_m_ref)
+
+
+@pytest.mark.parametrize("synapse_model", COMPACT_MODELS)
+def test_compact_synapse_memory_saved(synapse_model):
+    """
+    Compact synapses must be smaller than static_synapse and the savings reported by the kernel.
+    """
+
+    size_full = nest.GetDefaults("static_synapse", "size_of")
+    size_compact = nest.GetDefaults(synapse_model, "size_of")
+    assert size_compact < size_full
+
+    n = nest.Create("iaf_psc_alpha", 10)
+    nest.Connect(n, n, syn_spec={"synapse_model": synapse_model})
+    nest.Connect(n, n)
+
+    assert nest.compact_synapse_memory_saved == 100 * (size_full - size_compact)
+
+
+def test_compact_synapse_weights():
+    """
+    Weights must be rounded to single precision and be readable and settable as usual.
+    """
+
+    n = nest.Create("iaf_psc_alpha", 2)
+    nest.Connect(n[0], n[1], syn_spec={"synapse_model": "static_synapse_compact", "weight": 0.1, "delay": 2.0})
+
+    conn = nest.GetConnections()
+    assert conn.weight == np.float32(0.1)
+    assert conn.delay == 2.0
+
+    conn.weight = 2.5
+    assert conn.weight == 2.5
+
+
+def test_quantized_synapse_weights():
+    """
+    Weights must be rounded to multiples of weight_scale and be readable and settable as usual.
+    """
+
+    nest.SetDefaults("static_synapse_quantized", {"weight_scale": 0.5, "weight": 2.0})
+    n = nest.Create("iaf_psc_alpha", 4)
+    nest.Connect(n[0], n[1], syn_spec={"synapse_model": "static_synapse_quantized"})
+    nest.Connect(n[0], n[2], syn_spec={"synapse_model": "static_synapse_quantized", "weight": -3.2})
+    nest.Connect(n[0], n[3], syn_spec={"synapse_model": "static_synapse_quantized", "weight": 1.7})
+
+    conns = nest.GetConnections()
+    assert conns.weight == [2.0, -3.0, 1.5]
+
+    conns[0].weight = 100.0
+    assert conns[0].weight == 100.0
+
+
+def test_quantized_synapse_weight_out_of_range():
+    """
+    Weights that cannot be represented with the given scale must be rejected.
+    """
+
+    n = nest.Create("iaf_psc_alpha", 2)
+    nest.Connect(n[0], n[1], syn_spec={"synapse_model": "static_synapse_quantized", "weight": 3276.7})
+    with pytest.raises(nest.kernel.NESTError):
+        nest.Connect(n[0], n[1], syn_spec={"synapse_model": "static_synapse_quantized", "weight": 3276.8})
+    with pytest.raises(nest.kernel.NESTError):
+        nest.GetConnections().weight = -4000.0
+
+
+def test_quantized_synapse_weight_scale_fixed_after_connect():
+    """
+    The weight scale must not change once connections exist, except through copies of the model.
+    """
+
+    n = nest.Create("iaf_psc_alpha", 2)
+    nest.Connect(n[0], n[1], syn_spec={"synapse_model": "static_synapse_quantized"})
+    with pytest.raises(nest.kernel.NESTError):
+        nest.SetDefaults("static_synapse_quantized", {"weight_scale": 0.01})
+
+    nest.CopyModel("static_synapse_quantized", "fine_quantized", {"weight_scale": 0.01, "weight": 0.25})
+    nest.Connect(n[0], n[1], syn_spec={"synapse_model": "fine_quantized"})
+    assert nest.GetConnections(synapse_model="fine_quantized").weight == 0.25
+    assert nest.GetDefaults("static_synapse_quantized", "weight_scale") == 0.1
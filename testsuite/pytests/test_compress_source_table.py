@@ -0,0 +1,108 @@
+# -*- coding: utf-8 -*-
+#
+# test_compress_source_table.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+Test that compressing the source table during connection setup gives identical results.
+"""
+
+import nest
+import numpy as np
+import pytest
+
+if nest.ll_api.sli_func("is_threaded"):
+    THREAD_NUMBERS = [1, 2, 3]
+else:
+    THREAD_NUMBERS = [1]
+
+
+@pytest.fixture(autouse=True)
+def reset():
+    nest.ResetKernel()
+
+
+def simulate_network(compress_source_table, use_compressed_spikes, num_threads):
+    """
+    Simulate a recurrent network with two synapse types and return spikes and membrane potentials.
+    """
+
+    nest.ResetKernel()
+    nest.local_num_threads = num_threads
+    nest.use_compressed_spikes = use_compressed_spikes
+    nest.keep_source_table = False
+    nest.compress_source_table = compress_source_table
+
+    pop = nest.Create("iaf_psc_alpha", 60, params={"I_e": 370.0})
+    pg = nest.Create("poisson_generator", params={"rate": 5000.0})
+    sr = nest.Create("spike_recorder")
+
+    nest.Connect(pg, pop, syn_spec={"weight": 10.0})
+    nest.Connect(
+        pop[:30],
+        pop,
+        {"rule": "fixed_indegree", "indegree": 15},
+        syn_spec={"weight": -40.0, "delay": nest.random.uniform_int(3) * 0.5 + 1.0},
+    )
+    nest.Connect(
+        pop[30:],
+        pop,
+        {"rule": "fixed_indegree", "indegree": 15},
+        syn_spec={"synapse_model": "stdp_synapse", "weight": 5.0, "delay": 1.0},
+    )
+    nest.Connect(pop, sr)
+
+    nest.Simulate(200.0)
+
+    return sr.events, pop.V_m
+
+
+@pytest.mark.parametrize("use_compressed_spikes", [False, True])
+@pytest.mark.parametrize("num_threads", THREAD_NUMBERS)
+def test_compress_source_table_identical_results(use_compressed_spikes, num_threads):
+    """
+    Spikes and membrane potentials must not depend on the representation of the source table.
+    """
+
+    spikes_ref, V_m_ref = simulate_network(False, use_compressed_spikes, num_threads)
+    spikes, V_m = simulate_network(True, use_compressed_spikes, num_threads)
+
+    assert len(spikes_ref["times"]) > 0
+    np.testing.assert_array_equal(spikes["senders"], spikes_ref["senders"])
+    np.testing.assert_array_equal(spikes["times"], spikes_ref["times"])
+    np.testing.assert_array_equal(V_m, V_m_ref)
+
+
+def test_compress_source_table_requires_discarding_source_table():
+    """
+    The source table can only be compressed if it is not kept after connection setup.
+    """
+
+    assert nest.keep_source_table
+    with pytest.raises(nest.kernel.NESTError):
+        nest.compress_source_table = True
+
+    nest.keep_source_table = False
+    nest.compress_source_table = True
+    with pytest.raises(nest.kernel.NESTError):
+        nest.keep_source_table = True
+
+    # a rejected setting must leave both flags unchanged
+    assert not nest.keep_source_table
+    assert nest.compress_source_table
@@ -387,6 +387,82 @@ class TestConnectArrays(unittest.TestCase):
 
         self.assertEqual(src_alpha_ref, src_alpha)
 
+    @unittest.skipIf(not HAVE_OPENMP, "NEST was compiled without multi-threading")
+    def test_connect_arrays_devices_threaded(self):
+        """Connecting NumPy arrays including devices as sources and targets, threaded"""
+
+        nest.local_num_threads = 2
+
+        neurons = nest.Create("iaf_psc_alpha", 4)
+        pg = nest.Create("poisson_generator")
+        sr = nest.Create("spike_recorder")
+
+        sources = np.array([pg.global_id] * 4 + list(neurons.global_id))
+        targets = np.array(list(neurons.global_id) + [sr.global_id] * 4)
+        weights = np.arange(1.0, 9.0)
+
+        nest.Connect(
+            sources,
+            targets,
+            conn_spec="one_to_one",
+            syn_spec={"weight": weights, "synapse_model": "static_synapse_lbl", "synapse_label": 3},
+        )
+
+        conns = nest.GetConnections()
+        conn_info = sorted(zip(conns.source, conns.target, conns.weight))
+        self.assertEqual(conn_info, sorted(zip(sources, targets, weights)))
+        self.assertEqual(conns.synapse_label, len(conns) * [3])
+
+    @unittest.skipIf(not HAVE_OPENMP, "NEST was compiled without multi-threading")
+    def test_connect_arrays_typed_setters_threaded(self):
+        """Connecting NumPy arrays with parameters set by typed setters of the synapse model, threaded"""
+
+        nest.local_num_threads = 3
+
+        nest.Create("iaf_psc_exp_multisynapse", 10, params={"tau_syn": [1.0, 2.0]})
+        sources = np.array([2, 5, 3, 10, 1, 9, 4, 6, 8, 7])
+        targets = np.array([1, 1, 4, 4, 7, 7, 10, 10, 2, 3])
+        params = {
+            "weight": np.linspace(1.0, 2.0, 10),
+            "delay": np.linspace(1.0, 1.9, 10),
+            "receptor_type": np.array([1, 2] * 5),
+            "tau_plus": np.linspace(10.0, 20.0, 10),
+            "lambda": np.linspace(0.01, 0.1, 10),
+            "alpha": np.linspace(0.5, 1.5, 10),
+            "mu_plus": np.linspace(0.0, 1.0, 10),
+            "mu_minus": np.linspace(1.0, 0.0, 10),
+            "Wmax": np.linspace(50.0, 100.0, 10),
+            "Kplus": np.linspace(0.0, 0.9, 10),
+        }
+
+        nest.Connect(sources, targets, conn_spec="one_to_one", syn_spec=dict(params, synapse_model="stdp_synapse"))
+
+        conns = nest.GetConnections()
+        expected = {(s, t): i for i, (s, t) in enumerate(zip(sources, targets))}
+        status = conns.get(["source", "target", "receptor"] + [k for k in params if k != "receptor_type"])
+        self.assertEqual(len(status["source"]), len(sources))
+        for j, (s, t) in enumerate(zip(status["source"], status["target"])):
+            i = expected[(s, t)]
+            self.assertEqual(status["receptor"][j], params["receptor_type"][i])
+            for key in params:
+                if key != "receptor_type":
+                    self.assertAlmostEqual(status[key][j], params[key][i])
+
+    def test_connect_arrays_typed_setters_check_parameters(self):
+        """Connecting NumPy arrays with inconsistent parameters set by typed setters raises an error"""
+
+        nest.Create("iaf_psc_alpha", 2)
+        sources = np.array([1, 2])
+        targets = np.array([2, 1])
+
+        with self.assertRaises(nest.kernel.NESTErrors.BadProperty):
+            nest.Connect(
+                sources,
+                targets,
+                conn_spec="one_to_one",
+                syn_spec={"weight": np.ones(2), "Wmax": -np.ones(2), "synapse_model": "stdp_synapse"},
+            )
+
 
 def suite():
     suite = unittest.TestLoader().loadTestsFromTestCase(TestConnectArrays)
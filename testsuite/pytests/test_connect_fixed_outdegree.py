@@ -123,6 +123,36 @@ class TestFixedOutDegree(connect_test_base.ConnectTestBase):
         M = connect_test_base.get_connectivity_matrix(pop, pop)
         connect_test_base.mpi_assert(np.diag(M), np.zeros(N), self)
 
+    def testErrorAutapsesExhaustTargets(self):
+        conn_params = self.conn_dict.copy()
+        N = 10
+        conn_params["allow_autapses"] = False
+        conn_params["allow_multapses"] = False
+        conn_params["outdegree"] = N
+        pop = nest.Create("iaf_psc_alpha", N)
+        with self.assertRaises(nest.kernel.NESTError):
+            nest.Connect(pop, pop, conn_params)
+
+    def testOutDegreeWithDevicesManyThreads(self):
+        conn_params = self.conn_dict.copy()
+        conn_params["allow_autapses"] = False
+        conn_params["allow_multapses"] = False
+        N = 30
+        nest.ResetKernel()
+        nest.local_num_threads = 4
+        pop = nest.Create("iaf_psc_alpha", N)
+        recorders = nest.Create("spike_recorder", 3)
+        targets = pop + recorders
+
+        # every neuron must connect to all other neurons and to all recorders
+        conn_params["outdegree"] = N + 2
+        nest.Connect(pop, targets, conn_params)
+
+        M = connect_test_base.get_connectivity_matrix(pop, pop)
+        connect_test_base.mpi_assert(M, np.ones((N, N)) - np.eye(N), self)
+        M = connect_test_base.get_connectivity_matrix(pop, recorders)
+        connect_test_base.mpi_assert(M, np.ones((3, N)), self)
+
     def testMultapsesTrue(self):
         conn_params = self.conn_dict.copy()
         N = 3
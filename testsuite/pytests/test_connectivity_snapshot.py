@@ -0,0 +1,179 @@
+# -*- coding: utf-8 -*-
+#
+# test_connectivity_snapshot.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+Test that connectivity restored with LoadConnectivity is identical to the saved connectivity.
+"""
+
+import nest
+import numpy as np
+import pytest
+
+CONNECTION_KEYS = ["source", "target", "synapse_model", "weight", "delay"]
+
+
+@pytest.fixture(autouse=True)
+def reset():
+    nest.ResetKernel()
+
+
+def create_nodes(num_threads):
+    nest.ResetKernel()
+    nest.local_num_threads = num_threads
+    nest.rng_seed = 1234
+    pop = nest.Create("iaf_psc_alpha", 30, params={"I_e": 350.0})
+    pg = nest.Create("poisson_generator", params={"rate": 20000.0})
+    sr = nest.Create("spike_recorder")
+    return pop, pg, sr
+
+
+def connect_neurons(pop):
+    nest.Connect(
+        pop,
+        pop,
+        {"rule": "fixed_indegree", "indegree": 5},
+        syn_spec={
+            "synapse_model": "static_synapse",
+            "weight": nest.random.uniform(-30.0, -10.0),
+            "delay": nest.random.uniform(1.0, 3.0),
+        },
+    )
+    nest.Connect(pop[:10], pop[10:20], "one_to_one", syn_spec={"synapse_model": "tsodyks2_synapse", "weight": 50.0})
+
+
+def connect_devices_and_simulate(pop, pg, sr):
+    # Connect() draws from the random number generators, while LoadConnectivity() does not.
+    # Reseeding lets the generator produce the same input in original and restored networks.
+    nest.rng_seed = 5678
+    nest.Connect(pg, pop, syn_spec={"weight": 5.0})
+    nest.Connect(pop, sr)
+    nest.Simulate(100.0)
+    return sr.events["senders"], sr.events["times"]
+
+
+def connection_table(pop):
+    conns = nest.GetConnections(source=pop, target=pop).get(CONNECTION_KEYS)
+    return sorted(zip(*(conns[key] for key in CONNECTION_KEYS)))
+
+
+@pytest.mark.parametrize("num_threads", [1, 2])
+def test_snapshot_restores_connections(tmp_path, num_threads):
+    """Test that connections and simulation results are identical after restoring a snapshot."""
+
+    filename = str(tmp_path / "net")
+
+    pop, pg, sr = create_nodes(num_threads)
+    connect_neurons(pop)
+    nest.SaveConnectivity(filename)
+    expected_conns = connection_table(pop)
+    expected_senders, expected_times = connect_devices_and_simulate(pop, pg, sr)
+
+    pop, pg, sr = create_nodes(num_threads)
+    nest.LoadConnectivity(filename)
+    assert nest.num_connections == len(expected_conns)
+    assert connection_table(pop) == expected_conns
+    senders, times = connect_devices_and_simulate(pop, pg, sr)
+
+    assert len(expected_senders) > 0
+    np.testing.assert_array_equal(senders, expected_senders)
+    np.testing.assert_array_equal(times, expected_times)
+
+
+@pytest.mark.parametrize("num_threads", [1, 2])
+def test_snapshot_after_simulate(tmp_path, num_threads):
+    """Test that a snapshot saved after Simulate with kept source table restores the same network."""
+
+    filename_initial = str(tmp_path / "initial")
+    filename_simulated = str(tmp_path / "simulated")
+
+    pop, pg, sr = create_nodes(num_threads)
+    nest.keep_source_table = True
+    nest.Connect(
+        pop,
+        pop,
+        {"rule": "fixed_indegree", "indegree": 5},
+        syn_spec={"weight": nest.random.uniform(-30.0, -10.0), "delay": nest.random.uniform(1.0, 3.0)},
+    )
+    nest.SaveConnectivity(filename_initial)
+    expected_conns = connection_table(pop)
+    connect_devices_and_simulate(pop, pg, sr)
+    nest.SaveConnectivity(filename_simulated)
+
+    pop, pg, sr = create_nodes(num_threads)
+    nest.LoadConnectivity(filename_initial)
+    expected_senders, expected_times = connect_devices_and_simulate(pop, pg, sr)
+
+    pop, pg, sr = create_nodes(num_threads)
+    nest.LoadConnectivity(filename_simulated)
+    assert nest.num_connections == len(expected_conns)
+    assert connection_table(pop) == expected_conns
+    senders, times = connect_devices_and_simulate(pop, pg, sr)
+
+    assert len(expected_senders) > 0
+    np.testing.assert_array_equal(senders, expected_senders)
+    np.testing.assert_array_equal(times, expected_times)
+
+
+def test_save_after_simulate_requires_static_synapses(tmp_path):
+    """Test that connections with time-dependent synapse state cannot be saved after Simulate."""
+
+    filename = str(tmp_path / "net")
+
+    pop, pg, sr = create_nodes(1)
+    nest.keep_source_table = True
+    connect_neurons(pop)
+    nest.SaveConnectivity(filename)
+    connect_devices_and_simulate(pop, pg, sr)
+
+    with pytest.raises(nest.kernel.NESTError, match="tsodyks2_synapse"):
+        nest.SaveConnectivity(filename)
+
+
+def test_load_requires_no_connections(tmp_path):
+    """Test that connectivity cannot be loaded on top of existing connections."""
+
+    filename = str(tmp_path / "net")
+
+    pop, _, _ = create_nodes(1)
+    connect_neurons(pop)
+    nest.SaveConnectivity(filename)
+
+    with pytest.raises(nest.kernel.NESTError):
+        nest.LoadConnectivity(filename)
+
+
+def test_load_requires_same_network(tmp_path):
+    """Test that snapshots are rejected if threads or nodes differ."""
+
+    filename = str(tmp_path / "net")
+
+    pop, _, _ = create_nodes(1)
+    connect_neurons(pop)
+    nest.SaveConnectivity(filename)
+
+    create_nodes(2)
+    with pytest.raises(nest.kernel.NESTError):
+        nest.LoadConnectivity(filename)
+
+    create_nodes(1)
+    nest.Create("iaf_psc_alpha")
+    with pytest.raises(nest.kernel.NESTError):
+        nest.LoadConnectivity(filename)
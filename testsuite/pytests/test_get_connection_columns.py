@@ -0,0 +1,203 @@
+# -*- coding: utf-8 -*-
+#
+# test_get_connection_columns.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+Test that ``GetConnectionColumns`` returns the same connections as ``GetConnections``.
+"""
+
+import nest
+import numpy as np
+import pytest
+
+if nest.ll_api.sli_func("is_threaded"):
+    THREAD_NUMBERS = [1, 2, 3]
+else:
+    THREAD_NUMBERS = [1]
+
+ID_COLUMNS = ["source", "target", "target_thread", "synapse_modelid", "port"]
+
+
+@pytest.fixture(autouse=True)
+def reset():
+    nest.ResetKernel()
+
+
+def build_network(num_threads):
+    """
+    Create neurons and devices connected by several synapse models.
+    """
+
+    nest.local_num_threads = num_threads
+
+    pop = nest.Create("iaf_psc_alpha", 20)
+    pg = nest.Create("poisson_generator")
+    sr = nest.Create("spike_recorder")
+
+    nest.Connect(pg, pop, syn_spec={"weight": 3.0})
+    nest.Connect(
+        pop[:10],
+        pop,
+        {"rule": "fixed_indegree", "indegree": 4},
+        syn_spec={"weight": nest.random.uniform(-2.0, 2.0), "delay": nest.random.uniform_int(4) * 0.5 + 1.0},
+    )
+    nest.Connect(
+        pop[10:],
+        pop,
+        {"rule": "fixed_indegree", "indegree": 3},
+        syn_spec={"synapse_model": "stdp_synapse_lbl", "synapse_label": 7, "weight": 5.0, "delay": 2.0},
+    )
+    nest.Connect(pop, sr)
+
+    return pop, pg, sr
+
+
+def sorted_columns(columns):
+    """
+    Return columns as rows sorted lexicographically to compare independent of order.
+    """
+
+    rows = np.column_stack([columns[key] for key in ID_COLUMNS + ["weight", "delay"]])
+    return rows[np.lexsort(rows.T[::-1])]
+
+
+@pytest.mark.parametrize("num_threads", THREAD_NUMBERS)
+@pytest.mark.parametrize(
+    "selection",
+    [
+        {},
+        {"synapse_model": "stdp_synapse_lbl"},
+        {"synapse_model": "stdp_synapse_lbl", "synapse_label": 7},
+        {"synapse_label": 7},
+        {"source": slice(5, 15)},
+        {"target": slice(0, 10)},
+        {"source": slice(0, 12), "target": slice(8, 20), "synapse_model": "static_synapse"},
+    ],
+)
+def test_columns_match_get_connections(num_threads, selection):
+    """
+    Columns must contain exactly the connections and parameters returned by ``GetConnections``.
+    """
+
+    pop, _, _ = build_network(num_threads)
+    selection = {key: pop[value] if isinstance(value, slice) else value for key, value in selection.items()}
+
+    conns = nest.GetConnections(**selection)
+    assert len(conns) > 0
+
+    reference = conns.get(["source", "target", "target_thread", "synapse_id", "port", "weight", "delay"])
+    reference["synapse_modelid"] = reference.pop("synapse_id")
+    columns = nest.GetConnectionColumns(**selection, parameters=["weight", "delay"])
+
+    assert all(len(columns[key]) == len(conns) for key in ID_COLUMNS + ["weight", "delay"])
+    np.testing.assert_array_equal(sorted_columns(columns), sorted_columns(reference))
+
+
+def test_columns_include_device_connections():
+    """
+    Connections from and to devices must be included.
+    """
+
+    pop, pg, sr = build_network(1)
+
+    from_pg = nest.GetConnectionColumns(source=pg, parameters="weight")
+    np.testing.assert_array_equal(np.sort(from_pg["target"]), pop.tolist())
+    np.testing.assert_array_equal(from_pg["weight"], 3.0)
+
+    to_sr = nest.GetConnectionColumns(target=sr)
+    np.testing.assert_array_equal(np.sort(to_sr["source"]), pop.tolist())
+
+
+def test_columns_without_matching_connections():
+    """
+    An empty selection must yield empty columns.
+    """
+
+    build_network(1)
+
+    columns = nest.GetConnectionColumns(synapse_model="tsodyks_synapse", parameters=["weight"])
+    assert sorted(columns.keys()) == sorted(ID_COLUMNS + ["weight"])
+    assert all(len(column) == 0 for column in columns.values())
+
+
+@pytest.mark.parametrize("parameter", ["no_such_parameter", "source"])
+def test_invalid_parameter_raises(parameter):
+    """
+    Unknown parameters and identifier columns cannot be requested as synapse parameters.
+    """
+
+    build_network(1)
+
+    with pytest.raises(nest.kernel.NESTError):
+        nest.GetConnectionColumns(parameters=[parameter])
+
+
+@pytest.mark.parametrize("num_threads", THREAD_NUMBERS)
+@pytest.mark.parametrize(
+    "synapse_model, parameters",
+    [
+        ("stdp_synapse", ["weight", "delay", "tau_plus", "Wmax", "Kplus"]),
+        ("tsodyks2_synapse", ["weight", "U", "u", "x"]),
+        (None, ["weight", "delay"]),
+    ],
+)
+def test_columns_read_synapse_parameters(num_threads, synapse_model, parameters):
+    """
+    Parameters read directly from connections or from their status must match ``GetConnections``.
+    """
+
+    nest.local_num_threads = num_threads
+
+    pop = nest.Create("iaf_psc_alpha", 10)
+    nest.Connect(
+        pop,
+        pop,
+        {"rule": "fixed_indegree", "indegree": 3},
+        syn_spec={
+            "synapse_model": "stdp_synapse",
+            "weight": nest.random.uniform(1.0, 5.0),
+            "delay": nest.random.uniform(1.0, 3.0),
+            "Wmax": 50.0,
+            "tau_plus": 15.0,
+        },
+    )
+    nest.Connect(pop, pop, "one_to_one", syn_spec={"synapse_model": "tsodyks2_synapse", "U": 0.3})
+
+    selection = {"synapse_model": synapse_model} if synapse_model else {}
+    conns = nest.GetConnections(**selection)
+    reference = conns.get(["source", "target", "port"] + parameters)
+    columns = nest.GetConnectionColumns(**selection, parameters=parameters)
+
+    keys = ["source", "target", "port"] + parameters
+    expected = np.column_stack([reference[key] for key in keys])
+    actual = np.column_stack([columns[key] for key in keys])
+    np.testing.assert_array_equal(actual[np.lexsort(actual.T[::-1])], expected[np.lexsort(expected.T[::-1])])
+
+
+def test_common_property_cannot_be_requested():
+    """
+    Parameters shared by all connections of a model are not parameters of the individual connections.
+    """
+
+    pop = nest.Create("iaf_psc_alpha", 5)
+    nest.Connect(pop, pop, syn_spec={"synapse_model": "stdp_synapse_hom"})
+
+    with pytest.raises(nest.kernel.NESTError):
+        nest.GetConnectionColumns(parameters=["tau_plus"])
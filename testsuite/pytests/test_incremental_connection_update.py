@@ -0,0 +1,99 @@
+# -*- coding: utf-8 -*-
+#
+# test_incremental_connection_update.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+Test that connections created between calls to Simulate are delivered identically
+with incremental updates and full rebuilds of the connection infrastructure.
+"""
+
+import nest
+import numpy as np
+import pytest
+
+if nest.ll_api.sli_func("is_threaded"):
+    THREAD_NUMBERS = [1, 2, 3]
+else:
+    THREAD_NUMBERS = [1]
+
+
+@pytest.fixture(autouse=True)
+def reset():
+    nest.ResetKernel()
+
+
+def simulate_growing_network(use_incremental_connection_update, use_compressed_spikes, num_threads, disconnect=False):
+    """
+    Alternately add connections and nodes to a network and simulate it; return spikes.
+
+    All connections of a projection have the same weight, so that the order in which
+    input is summed up does not affect the results.
+    """
+
+    nest.ResetKernel()
+    nest.local_num_threads = num_threads
+    nest.use_compressed_spikes = use_compressed_spikes
+    nest.use_incremental_connection_update = use_incremental_connection_update
+    # delays of connections created after Simulate must lie within the delay extrema
+    nest.set(min_delay=1.0, max_delay=2.0)
+
+    pop = nest.Create("iaf_psc_alpha", 40, params={"I_e": 370.0})
+    pg = nest.Create("poisson_generator", params={"rate": 5000.0})
+    sr = nest.Create("spike_recorder")
+    nest.Connect(pg, pop, syn_spec={"weight": 10.0})
+    nest.Connect(pop, sr)
+    nest.Simulate(50.0)
+
+    nest.Connect(pop[:20], pop, {"rule": "fixed_indegree", "indegree": 5}, syn_spec={"weight": -32.0, "delay": 1.5})
+    nest.Simulate(50.0)
+
+    # sources with existing connections gain targets on existing and new threads
+    new_pop = nest.Create("iaf_psc_alpha", 20, params={"I_e": 380.0})
+    nest.Connect(new_pop, sr)
+    nest.Connect(pop, new_pop, {"rule": "fixed_indegree", "indegree": 5}, syn_spec={"weight": 16.0})
+    nest.Connect(pop[20:], pop, {"rule": "fixed_indegree", "indegree": 5}, syn_spec={"weight": -32.0, "delay": 1.5})
+    nest.Simulate(50.0)
+
+    if disconnect:
+        nest.Disconnect(nest.GetConnections(source=pop[:5], target=pop))
+        nest.Connect(new_pop, pop, {"rule": "fixed_indegree", "indegree": 2}, syn_spec={"weight": 16.0})
+        nest.Simulate(50.0)
+
+    return sr.events
+
+
+@pytest.mark.parametrize(
+    "use_compressed_spikes, disconnect",
+    [(False, False), (True, False), (True, True)],
+)
+@pytest.mark.parametrize("num_threads", THREAD_NUMBERS)
+def test_incremental_update_identical_results(use_compressed_spikes, num_threads, disconnect):
+    """
+    Spikes must not depend on whether the connection infrastructure is updated incrementally.
+
+    Disconnect requires connections sorted by source, which is only the case with compressed spikes.
+    """
+
+    spikes_ref = simulate_growing_network(False, use_compressed_spikes, num_threads, disconnect)
+    spikes = simulate_growing_network(True, use_compressed_spikes, num_threads, disconnect)
+
+    assert len(spikes_ref["times"]) > 0
+    np.testing.assert_array_equal(spikes["senders"], spikes_ref["senders"])
+    np.testing.assert_array_equal(spikes["times"], spikes_ref["times"])
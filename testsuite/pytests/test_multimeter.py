@@ -126,3 +126,59 @@ def test_identical_recording_from_multiple_multimeters(model):
 
     for recordable in recordables:
         nptest.assert_array_equal(mm1.events[recordable], mm2.events[recordable])
+
+
+@pytest.mark.parametrize("record_to", ["memory", "ascii"])
+@pytest.mark.parametrize("time_in_steps", [False, True])
+def test_population_recording_matches_individual_recordings(record_to, time_in_steps, tmp_path):
+    """
+    Test that recording from a population gives the same samples as recording from each neuron.
+
+    A multimeter connected to several neurons hands the samples of all neurons to
+    the recording backend in one block per time slice. The samples must be
+    identical to those of multimeters connected to a single neuron each, and
+    must be ordered by time first and by sender second.
+    """
+
+    nest.data_path = str(tmp_path)
+    nest.overwrite_files = True
+
+    params = {"record_from": ["V_m", "I_syn_ex"], "interval": 0.3, "start": 2.0, "stop": 40.0}
+    nrns = nest.Create("iaf_psc_alpha", 5, params={"I_e": [300.0, 350.0, 400.0, 450.0, 500.0]})
+    pg = nest.Create("poisson_generator", params={"rate": 10000.0})
+    mm_pop = nest.Create("multimeter", params)
+    mm_single = nest.Create("multimeter", len(nrns), params)
+    mm_pop.set(record_to=record_to, time_in_steps=time_in_steps)
+    if record_to == "ascii":
+        mm_pop.precision = 17
+    mm_single.set(time_in_steps=time_in_steps)
+
+    nest.Connect(pg, nrns, syn_spec={"weight": 20.0})
+    nest.Connect(mm_pop, nrns)
+    nest.Connect(mm_single, nrns, "one_to_one")
+
+    nest.Simulate(50.0)
+
+    if record_to == "ascii":
+        data = []
+        for fname in mm_pop.filenames:
+            data.extend(line.split() for line in open(fname) if line[0].isdigit())
+        senders = [int(row[0]) for row in data]
+        times = [float(row[1]) for row in data]
+        pop_events = {"senders": senders, "times": times, "V_m": [float(row[-2]) for row in data]}
+    else:
+        pop_events = mm_pop.events
+        assert mm_pop.n_events == len(pop_events["senders"])
+        if time_in_steps:
+            assert all(offset == 0.0 for offset in pop_events["offsets"])
+
+    times = list(pop_events["times"])
+    senders = list(pop_events["senders"])
+    assert len(times) > 0
+    assert sorted(zip(times, senders)) == list(zip(times, senders))
+
+    for nrn, mm in zip(nrns, mm_single):
+        is_nrn = [sender == nrn.global_id for sender in senders]
+        single_events = mm.events
+        nptest.assert_allclose([t for t, s in zip(times, is_nrn) if s], single_events["times"])
+        nptest.assert_allclose([v for v, s in zip(pop_events["V_m"], is_nrn) if s], single_events["V_m"])
@@ -0,0 +1,110 @@
+# -*- coding: utf-8 -*-
+#
+# test_pipelined_spike_exchange.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+Test pipelined exchange of spikes.
+
+With pipelined spike exchange, spikes are delivered one slice later than
+usual and min_delay is set to half the minimal delay. Results must be
+identical to a simulation without pipelining and with min_delay set to the
+same value explicitly.
+"""
+
+import nest
+import numpy as np
+import pytest
+
+if nest.ll_api.sli_func("is_threaded"):
+    THREAD_NUMBERS = [1, 2]
+else:
+    THREAD_NUMBERS = [1]
+
+
+def simulate_network(use_pipelined_spike_exchange, num_threads):
+    nest.ResetKernel()
+    nest.local_num_threads = num_threads
+    if use_pipelined_spike_exchange:
+        nest.use_pipelined_spike_exchange = True
+    else:
+        nest.set(min_delay=1.0, max_delay=4.0)
+
+    pop = nest.Create("iaf_psc_alpha", 50, params={"I_e": 370.0})
+    pg = nest.Create("poisson_generator", params={"rate": 5000.0})
+    sr = nest.Create("spike_recorder")
+
+    nest.Connect(pg, pop, syn_spec={"weight": 10.0, "delay": 2.0})
+    nest.Connect(
+        pop,
+        pop,
+        {"rule": "fixed_indegree", "indegree": 10},
+        syn_spec={"weight": -40.0, "delay": nest.random.uniform_int(5) * 0.5 + 2.0},
+    )
+    nest.Connect(pop, sr)
+
+    # several runs to check that pending spikes are carried over correctly
+    for _ in range(4):
+        nest.Simulate(50.0)
+
+    return nest.min_delay, sr.events, pop.V_m
+
+
+@pytest.mark.parametrize("num_threads", THREAD_NUMBERS)
+def test_pipelined_spike_exchange_identical_results(num_threads):
+    min_delay_ref, spikes_ref, V_m_ref = simulate_network(False, num_threads)
+    min_delay, spikes, V_m = simulate_network(True, num_threads)
+
+    assert min_delay == min_delay_ref == 1.0
+    assert len(spikes_ref["times"]) > 0
+    np.testing.assert_array_equal(spikes["senders"], spikes_ref["senders"])
+    np.testing.assert_array_equal(spikes["times"], spikes_ref["times"])
+    np.testing.assert_array_equal(V_m, V_m_ref)
+
+
+def test_pipelined_spike_exchange_requires_two_step_delay():
+    nest.ResetKernel()
+    nest.use_pipelined_spike_exchange = True
+
+    n = nest.Create("iaf_psc_alpha", 2)
+    nest.Connect(n[0], n[1], syn_spec={"delay": nest.resolution})
+
+    with pytest.raises(nest.kernel.NESTErrors.KernelException):
+        nest.Simulate(10.0)
+
+
+def test_pipelined_spike_exchange_rejects_short_delay_after_simulate():
+    nest.ResetKernel()
+    nest.use_pipelined_spike_exchange = True
+
+    n = nest.Create("iaf_psc_alpha", 2)
+    nest.Connect(n[0], n[1], syn_spec={"delay": 2.0})
+    nest.Simulate(10.0)
+
+    # min_delay is 1 ms now, but delays must span two slices
+    with pytest.raises(nest.kernel.NESTErrors.BadDelay):
+        nest.Connect(n[1], n[0], syn_spec={"delay": 1.0})
+
+
+def test_pipelined_spike_exchange_cannot_be_switched_after_simulate():
+    nest.ResetKernel()
+    nest.Simulate(1.0)
+
+    with pytest.raises(nest.kernel.NESTErrors.KernelException):
+        nest.use_pipelined_spike_exchange = True
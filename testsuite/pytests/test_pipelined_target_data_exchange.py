@@ -0,0 +1,108 @@
+# -*- coding: utf-8 -*-
+#
+# test_pipelined_target_data_exchange.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+Test that pipelined exchange of target data creates the same connection infrastructure.
+"""
+
+import nest
+import numpy as np
+import pytest
+
+if nest.ll_api.sli_func("is_threaded"):
+    THREAD_NUMBERS = [1, 2, 3]
+else:
+    THREAD_NUMBERS = [1]
+
+
+@pytest.fixture(autouse=True)
+def reset():
+    nest.ResetKernel()
+
+
+def simulate_network(use_pipelined_target_data_exchange, use_compressed_spikes, num_threads, max_buffer_size):
+    """
+    Simulate a recurrent network and return spikes and the target data exchange log.
+    """
+
+    nest.ResetKernel()
+    nest.local_num_threads = num_threads
+    nest.use_compressed_spikes = use_compressed_spikes
+    nest.use_pipelined_target_data_exchange = use_pipelined_target_data_exchange
+    nest.max_buffer_size_target_data = max_buffer_size
+
+    pop = nest.Create("iaf_psc_alpha", 60, params={"I_e": 370.0})
+    pg = nest.Create("poisson_generator", params={"rate": 5000.0})
+    sr = nest.Create("spike_recorder")
+
+    nest.Connect(pg, pop, syn_spec={"weight": 10.0})
+    nest.Connect(pop[:30], pop, {"rule": "fixed_indegree", "indegree": 15}, syn_spec={"weight": -40.0, "delay": 1.5})
+    nest.Connect(pop[30:], pop, {"rule": "fixed_indegree", "indegree": 15}, syn_spec={"weight": 5.0})
+    nest.Connect(pop, sr)
+
+    nest.Simulate(100.0)
+
+    return sr.events, nest.target_data_exchange_log
+
+
+@pytest.mark.parametrize("use_compressed_spikes", [False, True])
+@pytest.mark.parametrize("num_threads", THREAD_NUMBERS)
+@pytest.mark.parametrize("max_buffer_size", [16, 16777216])
+def test_pipelined_target_data_exchange_identical_results(use_compressed_spikes, num_threads, max_buffer_size):
+    """
+    Spikes must not depend on whether target data are exchanged in pipelined rounds.
+
+    The small maximal buffer size enforces many rounds.
+    """
+
+    spikes_ref, _ = simulate_network(False, use_compressed_spikes, num_threads, max_buffer_size)
+    spikes, _ = simulate_network(True, use_compressed_spikes, num_threads, max_buffer_size)
+
+    assert len(spikes_ref["times"]) > 0
+    np.testing.assert_array_equal(spikes["senders"], spikes_ref["senders"])
+    np.testing.assert_array_equal(spikes["times"], spikes_ref["times"])
+
+
+@pytest.mark.parametrize("use_pipelined_target_data_exchange", [False, True])
+def test_target_data_exchange_log(use_pipelined_target_data_exchange):
+    """
+    Each round of target data exchange must be logged; buffers must grow from round to round up to their maximum.
+    """
+
+    _, log = simulate_network(use_pipelined_target_data_exchange, False, 1, 16)
+
+    num_rounds = len(log["round"])
+    assert num_rounds > 1
+    np.testing.assert_array_equal(log["round"], np.arange(num_rounds))
+    assert np.all(np.diff(log["buffer_size"]) >= 0)
+    assert log["buffer_size"][-1] == 16
+    assert np.all(np.array(log["bytes"]) > np.array(log["buffer_size"]))
+    assert len(log["time"]) == num_rounds
+
+
+def test_pipelined_target_data_exchange_single_round():
+    """
+    Without a limit on the buffer size, buffers sized per rank suffice for a single round.
+    """
+
+    _, log = simulate_network(True, True, 2, 16777216)
+
+    np.testing.assert_array_equal(log["round"], [0])
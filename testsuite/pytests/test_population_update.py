@@ -0,0 +1,100 @@
+# -*- coding: utf-8 -*-
+#
+# test_population_update.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+Test that updating nodes through population kernels gives identical results.
+"""
+
+import nest
+import numpy as np
+import pytest
+
+if nest.ll_api.sli_func("is_threaded"):
+    THREAD_NUMBERS = [1, 2]
+else:
+    THREAD_NUMBERS = [1]
+
+
+def simulate_network(model, use_population_update, num_threads):
+    """
+    Simulate a small recurrent network and return spikes and final membrane potentials.
+
+    One node is frozen and one is recorded by a multimeter so that population
+    kernels are interrupted by individually updated nodes.
+    """
+
+    nest.ResetKernel()
+    nest.local_num_threads = num_threads
+    nest.use_population_update = use_population_update
+
+    pop = nest.Create(model, 20, params={"I_e": nest.random.uniform(300.0, 500.0)})
+    pg = nest.Create("poisson_generator", params={"rate": 20000.0})
+    dc = nest.Create("dc_generator", params={"amplitude": 50.0, "start": 20.0})
+    sr = nest.Create("spike_recorder")
+    mm = nest.Create("multimeter", params={"record_from": ["V_m"]})
+
+    pop[7].frozen = True
+
+    nest.Connect(pg, pop, syn_spec={"weight": 5.0})
+    nest.Connect(dc, pop)
+    nest.Connect(pop, pop, {"rule": "fixed_indegree", "indegree": 5}, syn_spec={"weight": -20.0, "delay": 1.5})
+    nest.Connect(pop, sr)
+    nest.Connect(mm, pop[3])
+
+    # two runs to check that state is written back and reloaded between runs
+    nest.Simulate(50.0)
+    nest.Simulate(50.0)
+
+    return sr.events, pop.V_m, mm.events["V_m"]
+
+
+@pytest.mark.parametrize("model", ["iaf_psc_alpha", "iaf_psc_exp", "iaf_psc_delta"])
+@pytest.mark.parametrize("num_threads", THREAD_NUMBERS)
+def test_population_update_identical_results(model, num_threads):
+    """
+    Spikes, membrane potentials and recorded data must not depend on the update mode.
+    """
+
+    spikes_ref, V_m_ref, rec_ref = simulate_network(model, False, num_threads)
+    spikes, V_m, rec = simulate_network(model, True, num_threads)
+
+    assert len(spikes_ref["times"]) > 0
+    np.testing.assert_array_equal(spikes["senders"], spikes_ref["senders"])
+    np.testing.assert_array_equal(spikes["times"], spikes_ref["times"])
+    np.testing.assert_array_equal(V_m, V_m_ref)
+    np.testing.assert_array_equal(rec, rec_ref)
+
+
+def test_population_update_set_status_between_runs():
+    """
+    Changes of state between runs must be taken into account by population kernels.
+    """
+
+    nest.ResetKernel()
+    nest.use_population_update = True
+
+    n = nest.Create("iaf_psc_alpha", 3)
+    nest.Simulate(10.0)
+    n.V_m = -60.0
+    nest.Simulate(0.1)
+
+    # membrane potential relaxes from -60 mV towards E_L = -70 mV
+    assert all(-61.0 < v < -60.0 for v in n.V_m)
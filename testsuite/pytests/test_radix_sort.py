@@ -0,0 +1,82 @@
+# -*- coding: utf-8 -*-
+#
+# test_radix_sort.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+Test that sorting connections with radix sort gives identical results.
+"""
+
+import nest
+import numpy as np
+import pytest
+
+if nest.ll_api.sli_func("is_threaded"):
+    THREAD_NUMBERS = [1, 2, 3]
+else:
+    THREAD_NUMBERS = [1]
+
+CONNECTION_KEYS = ["source", "target", "synapse_model", "weight", "delay"]
+
+
+@pytest.fixture(autouse=True)
+def reset():
+    nest.ResetKernel()
+
+
+def simulate_network(use_radix_sort, num_threads):
+    """
+    Simulate a recurrent network and return connections and spikes.
+
+    All connections of a projection have the same weight, so that the order
+    in which input is summed up does not affect the results.
+    """
+
+    nest.ResetKernel()
+    nest.local_num_threads = num_threads
+    nest.use_radix_sort = use_radix_sort
+
+    pop = nest.Create("iaf_psc_alpha", 100, params={"I_e": 370.0})
+    pg = nest.Create("poisson_generator", params={"rate": 5000.0})
+    sr = nest.Create("spike_recorder")
+
+    nest.Connect(pg, pop, syn_spec={"weight": 10.0})
+    nest.Connect(pop, pop, {"rule": "fixed_indegree", "indegree": 20}, syn_spec={"weight": -32.0, "delay": 1.5})
+    nest.Connect(pop[:50], pop, {"rule": "fixed_outdegree", "outdegree": 10}, syn_spec={"weight": 16.0})
+    nest.Connect(pop, sr)
+
+    nest.Simulate(200.0)
+
+    conns = nest.GetConnections(source=pop, target=pop).get(CONNECTION_KEYS)
+    return sorted(zip(*(conns[key] for key in CONNECTION_KEYS))), sr.events
+
+
+@pytest.mark.parametrize("num_threads", THREAD_NUMBERS)
+def test_radix_sort_identical_results(num_threads):
+    """
+    Connections and spikes must not depend on the algorithm used to sort connections.
+    """
+
+    conns_ref, spikes_ref = simulate_network(False, num_threads)
+    conns, spikes = simulate_network(True, num_threads)
+
+    assert conns == conns_ref
+    assert len(spikes_ref["times"]) > 0
+    np.testing.assert_array_equal(spikes["senders"], spikes_ref["senders"])
+    np.testing.assert_array_equal(spikes["times"], spikes_ref["times"])
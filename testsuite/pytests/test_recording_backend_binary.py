@@ -0,0 +1,153 @@
+# -*- coding: utf-8 -*-
+#
+# test_recording_backend_binary.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+Test that the ``binary`` recording backend records the same data as the ``memory`` backend.
+"""
+
+import os
+
+import nest
+import numpy as np
+import pytest
+
+if nest.ll_api.sli_func("is_threaded"):
+    THREAD_NUMBERS = [1, 2]
+else:
+    THREAD_NUMBERS = [1]
+
+
+@pytest.fixture(autouse=True)
+def reset(tmp_path):
+    nest.ResetKernel()
+    nest.data_path = str(tmp_path)
+    nest.overwrite_files = True
+
+
+def record(backend, num_threads, block_size=4096):
+    """
+    Simulate neurons recorded by a spike recorder and a multimeter and return both recorders.
+    """
+
+    nest.local_num_threads = num_threads
+    nest.SetDefaults("binary", {"block_size": block_size})
+
+    neurons = nest.Create("iaf_psc_alpha", 10, params={"I_e": nest.random.uniform(370.0, 400.0)})
+    sr = nest.Create("spike_recorder", params={"record_to": backend})
+    mm = nest.Create(
+        "multimeter", params={"record_to": backend, "record_from": ["V_m", "I_syn_ex"], "interval": 0.5}
+    )
+    nest.Connect(neurons, sr)
+    nest.Connect(mm, neurons)
+
+    # The file is written from Prepare to Cleanup, so all runs in between end up in the same file
+    with nest.RunManager():
+        nest.Run(100.0)
+        nest.Run(50.0)
+
+    return sr, mm
+
+
+def sorted_events(events, keys):
+    """
+    Return the given event columns sorted by sender and time.
+    """
+
+    order = np.lexsort((events["times"], events["senders"]))
+    return {key: np.asarray(events[key])[order] for key in keys}
+
+
+@pytest.mark.parametrize("num_threads", THREAD_NUMBERS)
+@pytest.mark.parametrize("block_size", [1, 7, 4096])
+def test_binary_matches_memory(num_threads, block_size):
+    """
+    Events read from the binary files must be identical to those recorded in memory.
+    """
+
+    sr_ref, mm_ref = record("memory", num_threads)
+    spikes_ref = sr_ref.events
+    samples_ref = mm_ref.events
+
+    nest.ResetKernel()
+    sr, mm = record("binary", num_threads, block_size)
+    data = nest.ReadBinaryRecording(sr.filename)
+
+    assert data[sr.global_id]["model"] == "spike_recorder"
+    assert data[mm.global_id]["model"] == "multimeter"
+
+    spikes = data[sr.global_id]["events"]
+    assert len(spikes_ref["times"]) > 0
+    for key, values in sorted_events(spikes_ref, ["senders", "times"]).items():
+        np.testing.assert_array_equal(sorted_events(spikes, [key])[key], values)
+
+    samples = data[mm.global_id]["events"]
+    for key, values in sorted_events(samples_ref, ["senders", "times", "V_m", "I_syn_ex"]).items():
+        np.testing.assert_array_equal(sorted_events(samples, [key])[key], values)
+
+
+def test_filename_and_label():
+    """
+    The file name must contain data path, data prefix and backend filename, and the label must be stored.
+    """
+
+    nest.data_prefix = "prefix_"
+    nest.SetDefaults("binary", {"filename": "spikes"})
+
+    sr = nest.Create("spike_recorder", params={"record_to": "binary", "label": "my_recorder"})
+    nest.Connect(nest.Create("poisson_generator", params={"rate": 1000.0}), sr)
+    nest.Simulate(10.0)
+
+    filename = sr.filename
+    assert filename.startswith(os.path.join(nest.data_path, "prefix_spikes"))
+    assert filename.endswith(".nestbin")
+    assert nest.ReadBinaryRecording(filename)[sr.global_id]["label"] == "my_recorder"
+
+
+def test_existing_file_is_not_overwritten():
+    """
+    Preparing must fail if the file exists and overwriting files is disabled.
+    """
+
+    sr = nest.Create("spike_recorder", params={"record_to": "binary"})
+    nest.Simulate(10.0)
+    assert os.path.exists(sr.filename)
+
+    nest.overwrite_files = False
+    with pytest.raises(nest.kernel.NESTErrors.IOError):
+        nest.Simulate(10.0)
+
+
+def test_block_size():
+    """
+    The block size must be positive and cannot be changed between Prepare and Cleanup.
+    """
+
+    with pytest.raises(nest.kernel.NESTErrors.BadProperty):
+        nest.SetDefaults("binary", {"block_size": 0})
+
+    nest.Create("spike_recorder", params={"record_to": "binary"})
+    nest.Prepare()
+    with pytest.raises(nest.kernel.NESTErrors.BadProperty):
+        nest.SetDefaults("binary", {"block_size": 10})
+    nest.Cleanup()
+
+    nest.SetDefaults("binary", {"block_size": 10})
+    assert nest.GetDefaults("binary", "block_size") == 10
@@ -0,0 +1,176 @@
+# -*- coding: utf-8 -*-
+#
+# test_recording_backend_hdf5.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+Test that the ``hdf5`` recording backend records the same data as the ``memory`` backend.
+"""
+
+import os
+
+import nest
+import numpy as np
+import pytest
+
+h5py = pytest.importorskip("h5py")
+
+# Skip all tests in this module if no HDF5
+pytestmark = pytest.mark.skipif_missing_hdf5
+
+if nest.ll_api.sli_func("is_threaded"):
+    THREAD_NUMBERS = [1, 2]
+else:
+    THREAD_NUMBERS = [1]
+
+
+@pytest.fixture(autouse=True)
+def reset(tmp_path):
+    nest.ResetKernel()
+    nest.data_path = str(tmp_path)
+    nest.overwrite_files = True
+
+
+def record(backend, num_threads, backend_params=None):
+    """
+    Simulate neurons recorded by a spike recorder and a multimeter and return both recorders.
+    """
+
+    nest.local_num_threads = num_threads
+    nest.SetDefaults("hdf5", backend_params or {})
+
+    neurons = nest.Create("iaf_psc_alpha", 10, params={"I_e": nest.random.uniform(370.0, 400.0)})
+    sr = nest.Create("spike_recorder", params={"record_to": backend})
+    mm = nest.Create(
+        "multimeter", params={"record_to": backend, "record_from": ["V_m", "I_syn_ex"], "interval": 0.5}
+    )
+    nest.Connect(neurons, sr)
+    nest.Connect(mm, neurons)
+
+    # The file is written from Prepare to Cleanup, so all runs in between end up in the same file
+    with nest.RunManager():
+        nest.Run(100.0)
+        nest.Run(50.0)
+
+    return sr, mm
+
+
+def sorted_events(events, keys):
+    """
+    Return the given event columns sorted by sender and time.
+    """
+
+    order = np.lexsort((events["times"], events["senders"]))
+    return {key: np.asarray(events[key])[order] for key in keys}
+
+
+def read_events(group):
+    """
+    Return all datasets of a device group as arrays.
+    """
+
+    return {key: group[key][()] for key in group.keys()}
+
+
+@pytest.mark.parametrize("num_threads", THREAD_NUMBERS)
+@pytest.mark.parametrize(
+    "backend_params",
+    [
+        {"buffer_size": 1, "chunk_size": 1},
+        {"buffer_size": 50, "chunk_size": 16, "compression_level": 4},
+        {},
+    ],
+)
+def test_hdf5_matches_memory(num_threads, backend_params):
+    """
+    Events read from the HDF5 file must be identical to those recorded in memory.
+    """
+
+    sr_ref, mm_ref = record("memory", num_threads)
+    spikes_ref = sr_ref.events
+    samples_ref = mm_ref.events
+
+    nest.ResetKernel()
+    sr, mm = record("hdf5", num_threads, backend_params)
+
+    with h5py.File(sr.filename, "r") as f:
+        assert f.attrs["resolution"] == nest.resolution
+        assert f[str(sr.global_id)].attrs["model"] == "spike_recorder"
+        assert f[str(mm.global_id)].attrs["model"] == "multimeter"
+        spikes = read_events(f[str(sr.global_id)])
+        samples = read_events(f[str(mm.global_id)])
+
+    assert len(spikes_ref["times"]) > 0
+    for key, values in sorted_events(spikes_ref, ["senders", "times"]).items():
+        np.testing.assert_array_equal(sorted_events(spikes, [key])[key], values)
+
+    for key, values in sorted_events(samples_ref, ["senders", "times", "V_m", "I_syn_ex"]).items():
+        np.testing.assert_array_equal(sorted_events(samples, [key])[key], values)
+
+
+def test_filename_and_label():
+    """
+    The file name must contain data path, data prefix and backend filename, and the label must be stored.
+    """
+
+    nest.data_prefix = "prefix_"
+    nest.SetDefaults("hdf5", {"filename": "spikes"})
+
+    sr = nest.Create("spike_recorder", params={"record_to": "hdf5", "label": "my_recorder"})
+    nest.Connect(nest.Create("poisson_generator", params={"rate": 1000.0}), sr)
+    nest.Simulate(10.0)
+
+    filename = sr.filename
+    assert filename.startswith(os.path.join(nest.data_path, "prefix_spikes"))
+    assert filename.endswith(".h5")
+    with h5py.File(filename, "r") as f:
+        assert f[str(sr.global_id)].attrs["label"] == "my_recorder"
+
+
+def test_existing_file_is_not_overwritten():
+    """
+    Preparing must fail if the file exists and overwriting files is disabled.
+    """
+
+    sr = nest.Create("spike_recorder", params={"record_to": "hdf5"})
+    nest.Simulate(10.0)
+    assert os.path.exists(sr.filename)
+
+    nest.overwrite_files = False
+    with pytest.raises(nest.kernel.NESTErrors.IOError):
+        nest.Simulate(10.0)
+
+
+@pytest.mark.parametrize("param", ["buffer_size", "chunk_size", "compression_level"])
+def test_parameters(param):
+    """
+    Invalid values must be rejected and parameters cannot be changed between Prepare and Cleanup.
+    """
+
+    with pytest.raises(nest.kernel.NESTErrors.BadProperty):
+        nest.SetDefaults("hdf5", {param: -1})
+
+    nest.Create("spike_recorder", params={"record_to": "hdf5"})
+    nest.Prepare()
+    with pytest.raises(nest.kernel.NESTErrors.BadProperty):
+        nest.SetDefaults("hdf5", {param: 5})
+    nest.Cleanup()
+
+    nest.SetDefaults("hdf5", {param: 5})
+    assert nest.GetDefaults("hdf5", param) == 5
@@ -22,6 +22,7 @@
 import unittest
 
 import nest
+import numpy as np
 
 HAVE_OPENMP = nest.ll_api.sli_func("is_threaded")
 
@@ -122,6 +123,95 @@ class TestRecordingBackendMemory(unittest.TestCase):
         with self.assertRaises(nest.kernel.NESTErrors.BadProperty):
             mm.time_in_steps = False
 
+    def record(self, params, n_neurons=2, num_threads=1, simtime=50.0):
+        """Record V_m of neurons with a multimeter with the given parameters."""
+
+        nest.ResetKernel()
+        nest.local_num_threads = num_threads
+
+        neurons = nest.Create("iaf_psc_alpha", n_neurons, params={"I_e": 400.0})
+        mm = nest.Create("multimeter", params=dict({"interval": 0.1, "record_from": ["V_m"]}, **params))
+        nest.Connect(mm, neurons)
+        nest.Simulate(simtime)
+
+        return mm
+
+    def testCapacity(self):
+        """Test that a device with capacity keeps the most recent events in order."""
+
+        for num_threads in [1, 2]:
+            reference_mm = self.record({}, num_threads=num_threads)
+            reference = reference_mm.events
+            mm = self.record({"capacity": 150}, num_threads=num_threads)
+            events = mm.events
+
+            # n_events counts all events, also those which were discarded
+            self.assertEqual(mm.n_events, reference_mm.n_events)
+            self.assertEqual(events["times"].size, 150 * num_threads)
+
+            for key in ["senders", "times", "V_m"]:
+                expected = np.concatenate(
+                    [reference[key][reference["senders"] == s][-150 * num_threads // 2 :] for s in [1, 2]]
+                )
+                actual = np.concatenate([events[key][events["senders"] == s] for s in [1, 2]])
+                np.testing.assert_array_equal(actual, expected)
+
+            mm.n_events = 0
+            self.assertEqual(mm.events["times"].size, 0)
+
+    def testDecimate(self):
+        """Test that decimation keeps the first of each downsampling_factor events of each sender."""
+
+        reference = self.record({}).events
+        events = self.record({"downsampling": "decimate", "downsampling_factor": 4}).events
+
+        for s in [1, 2]:
+            for key in ["times", "V_m"]:
+                np.testing.assert_array_equal(
+                    events[key][events["senders"] == s], reference[key][reference["senders"] == s][::4]
+                )
+
+    def testMinMax(self):
+        """Test that min/max downsampling keeps the envelope of each sender."""
+
+        factor = 7
+        reference = self.record({}).events
+        events = self.record({"downsampling": "minmax", "downsampling_factor": factor, "capacity": 1000}).events
+
+        for s in [1, 2]:
+            times = reference["times"][reference["senders"] == s]
+            v_m = reference["V_m"][reference["senders"] == s]
+            num_windows = times.size // factor
+            times = times[: num_windows * factor].reshape(num_windows, factor)
+            v_m = v_m[: num_windows * factor].reshape(num_windows, factor)
+
+            np.testing.assert_array_equal(events["times"][events["senders"] == s][0::2], times[:, 0])
+            np.testing.assert_array_equal(events["times"][events["senders"] == s][1::2], times[:, -1])
+            np.testing.assert_array_equal(events["V_m"][events["senders"] == s][0::2], v_m.min(axis=1))
+            np.testing.assert_array_equal(events["V_m"][events["senders"] == s][1::2], v_m.max(axis=1))
+
+    def testBoundedMemoryParameters(self):
+        """Test validation of the parameters for bounded recording."""
+
+        nest.ResetKernel()
+
+        mm = nest.Create("multimeter", params={"record_to": "memory"})
+        self.assertEqual(mm.capacity, 0)
+        self.assertEqual(mm.downsampling, "none")
+        self.assertEqual(mm.downsampling_factor, 1)
+
+        with self.assertRaises(nest.kernel.NESTErrors.BadProperty):
+            mm.capacity = -1
+        with self.assertRaises(nest.kernel.NESTErrors.BadProperty):
+            mm.downsampling = "mean"
+        with self.assertRaises(nest.kernel.NESTErrors.BadProperty):
+            mm.downsampling_factor = 0
+
+        nest.Simulate(10)
+        for key, value in [("capacity", 10), ("downsampling", "minmax"), ("downsampling_factor", 2)]:
+            with self.assertRaises(nest.kernel.NESTErrors.BadProperty):
+                mm.set({key: value})
+
 
 def suite():
     suite = unittest.TestLoader()
@@ -0,0 +1,134 @@
+# -*- coding: utf-8 -*-
+#
+# test_recording_backend_statistics.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+Test that the ``statistics`` recording backend computes the same statistics as obtained from recorded spikes.
+"""
+
+import nest
+import numpy as np
+import pytest
+
+if nest.ll_api.sli_func("is_threaded"):
+    THREAD_NUMBERS = [1, 2]
+else:
+    THREAD_NUMBERS = [1]
+
+
+@pytest.fixture(autouse=True)
+def reset():
+    nest.ResetKernel()
+
+
+def record(backend, num_threads, bin_width=5.0):
+    """
+    Simulate neurons recorded by a spike recorder in two runs and return the recorder.
+    """
+
+    nest.local_num_threads = num_threads
+
+    neurons = nest.Create("iaf_psc_alpha", 10, params={"I_e": nest.random.uniform(370.0, 400.0)})
+    noise = nest.Create("poisson_generator", params={"rate": 5000.0})
+    params = {"record_to": backend}
+    if backend == "statistics":
+        params["bin_width"] = bin_width
+    sr = nest.Create("spike_recorder", params=params)
+    nest.Connect(noise, neurons, syn_spec={"weight": 20.0})
+    nest.Connect(neurons, sr)
+
+    nest.Simulate(120.0)
+    nest.Simulate(80.0)
+
+    return sr
+
+
+@pytest.mark.parametrize("num_threads", THREAD_NUMBERS)
+@pytest.mark.parametrize("bin_width", [0.1, 5.0, 30.0])
+def test_statistics_match_recorded_spikes(num_threads, bin_width):
+    """
+    Histogram and per-sender statistics must match those computed from spikes recorded in memory.
+    """
+
+    events = record("memory", num_threads).events
+    senders, times = events["senders"], events["times"]
+    assert len(times) > 0
+
+    nest.ResetKernel()
+    stats = record("statistics", num_threads, bin_width).statistics
+
+    num_bins = int(np.ceil(200.0 / bin_width - 1e-9))
+    bins = np.ceil(np.round(times / bin_width, 9)).astype(int) - 1
+    np.testing.assert_array_equal(stats["histogram"], np.bincount(bins, minlength=num_bins))
+
+    expected_senders = np.unique(senders)
+    np.testing.assert_array_equal(stats["senders"], expected_senders)
+
+    for i, sender in enumerate(expected_senders):
+        spikes = np.sort(times[senders == sender])
+        isi = np.diff(spikes)
+        assert stats["spike_counts"][i] == len(spikes)
+        assert stats["first_spike_times"][i] == pytest.approx(spikes[0])
+        assert stats["last_spike_times"][i] == pytest.approx(spikes[-1])
+        if len(isi) > 0:
+            assert stats["isi_mean"][i] == pytest.approx(np.mean(isi))
+            assert stats["isi_cv"][i] == pytest.approx(np.std(isi) / np.mean(isi), abs=1e-12)
+        else:
+            assert np.isnan(stats["isi_mean"][i])
+            assert np.isnan(stats["isi_cv"][i])
+
+
+def test_reset_statistics():
+    """
+    Setting n_events to 0 must reset the statistics.
+    """
+
+    sr = record("statistics", 1)
+    assert sum(sr.statistics["spike_counts"]) > 0
+
+    sr.n_events = 0
+    assert len(sr.statistics["senders"]) == 0
+    assert len(sr.statistics["histogram"]) == 0
+
+    nest.Simulate(50.0)
+    stats = sr.statistics
+    assert sum(stats["spike_counts"]) == sum(stats["histogram"])
+    assert all(stats["first_spike_times"] > 200.0)
+
+
+def test_bin_width():
+    """
+    The bin width must be a multiple of the resolution and cannot be changed after Simulate.
+    """
+
+    nest.resolution = 0.1
+    sr = nest.Create("spike_recorder", params={"record_to": "statistics"})
+    assert sr.bin_width == 10.0
+
+    for bin_width in [0.0, -1.0, 0.25]:
+        with pytest.raises(nest.kernel.NESTErrors.BadProperty):
+            sr.bin_width = bin_width
+
+    sr.bin_width = 0.3
+    nest.Simulate(1.0)
+    assert len(sr.statistics["histogram"]) == 4
+
+    with pytest.raises(nest.kernel.NESTErrors.BadProperty):
+        sr.bin_width = 1.0
@@ -24,6 +24,7 @@ import unittest
 import nest
 
 HAVE_SIONLIB = nest.ll_api.sli_func("statusdict/have_sionlib ::")
+HAVE_HDF5 = nest.ll_api.sli_func("statusdict/have_hdf5 ::")
 
 
 class TestRecordingBackends(unittest.TestCase):
@@ -68,13 +69,16 @@ class TestRecordingBackends(unittest.TestCase):
         nest.ResetKernel()
 
         backends = nest.recording_backends
-        expected_backends = ("ascii", "memory", "screen")
+        expected_backends = ("ascii", "binary", "memory", "screen", "statistics")
 
         self.assertTrue(all([b in backends for b in expected_backends]))
 
         if HAVE_SIONLIB:
             self.assertTrue("sionlib" in backends)
 
+        if HAVE_HDF5:
+            self.assertTrue("hdf5" in backends)
+
     def testGlobalRecordingBackendProperties(self):
         """Test setting of global backend properties.
 
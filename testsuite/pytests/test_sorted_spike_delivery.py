@@ -0,0 +1,167 @@
+# -*- coding: utf-8 -*-
+#
+# test_sorted_spike_delivery.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+Test that delivering spikes sorted by connection gives identical results.
+"""
+
+import nest
+import numpy as np
+import pytest
+
+if nest.ll_api.sli_func("is_threaded"):
+    THREAD_NUMBERS = [1, 2, 3]
+else:
+    THREAD_NUMBERS = [1]
+
+
+def simulate_network(use_sorted_spike_delivery, use_compressed_spikes, num_threads):
+    """
+    Simulate a recurrent network with static and plastic synapses.
+    """
+
+    nest.ResetKernel()
+    nest.local_num_threads = num_threads
+    nest.use_compressed_spikes = use_compressed_spikes
+    nest.use_sorted_spike_delivery = use_sorted_spike_delivery
+    nest.min_delay = 0.5
+    nest.max_delay = 3.0
+
+    pop = nest.Create("iaf_psc_alpha", 50, params={"I_e": 370.0})
+    pg = nest.Create("poisson_generator", params={"rate": 5000.0})
+    sr = nest.Create("spike_recorder")
+
+    nest.Connect(pg, pop, syn_spec={"weight": 10.0})
+    nest.Connect(
+        pop[:25],
+        pop,
+        {"rule": "fixed_indegree", "indegree": 10},
+        syn_spec={"weight": -40.0, "delay": nest.random.uniform_int(3) * 0.5 + 1.0},
+    )
+    nest.Connect(
+        pop[25:],
+        pop,
+        {"rule": "fixed_indegree", "indegree": 10},
+        syn_spec={"synapse_model": "stdp_synapse", "weight": 5.0, "delay": 1.0},
+    )
+    nest.Connect(pop, sr)
+
+    nest.Simulate(200.0)
+
+    conns = nest.GetConnections(pop[25:], pop)
+    return sr.events, pop.V_m, sorted(zip(conns.source, conns.target, conns.weight))
+
+
+@pytest.mark.parametrize("use_compressed_spikes", [False, True])
+@pytest.mark.parametrize("num_threads", THREAD_NUMBERS)
+def test_sorted_spike_delivery_identical_results(use_compressed_spikes, num_threads):
+    """
+    Spikes, membrane potentials and plastic weights must not depend on delivery order.
+    """
+
+    spikes_ref, V_m_ref, weights_ref = simulate_network(False, use_compressed_spikes, num_threads)
+    spikes, V_m, weights = simulate_network(True, use_compressed_spikes, num_threads)
+
+    assert len(spikes_ref["times"]) > 0
+    np.testing.assert_array_equal(np.sort(spikes["senders"]), np.sort(spikes_ref["senders"]))
+    np.testing.assert_array_equal(np.sort(spikes["times"]), np.sort(spikes_ref["times"]))
+    # inputs may be summed in different order in the ring buffers
+    np.testing.assert_allclose(V_m, V_m_ref, rtol=1e-12)
+    assert weights == weights_ref
+
+
+@pytest.mark.parametrize("synapse_model", ["static_synapse", "static_synapse_hom_w"])
+def test_sorted_spike_delivery_records_static_weights(synapse_model):
+    """
+    Weights of static synapses must be recorded if a weight recorder is attached.
+    """
+
+    def record_weights(use_sorted_spike_delivery):
+        nest.ResetKernel()
+        nest.use_sorted_spike_delivery = use_sorted_spike_delivery
+
+        wr = nest.Create("weight_recorder")
+        nest.CopyModel(synapse_model, "recorded_synapse", {"weight_recorder": wr, "weight": 2.0})
+
+        pre = nest.Create("parrot_neuron", 5)
+        post = nest.Create("iaf_psc_alpha", 5)
+        sg = nest.Create("spike_generator", params={"spike_times": [1.0, 2.0, 5.0]})
+        nest.Connect(sg, pre)
+        nest.Connect(pre, post, syn_spec={"synapse_model": "recorded_synapse"})
+
+        nest.Simulate(10.0)
+
+        events = wr.events
+        return sorted(zip(events["times"], events["senders"], events["targets"], events["weights"]))
+
+    weights_ref = record_weights(False)
+    weights = record_weights(True)
+
+    assert len(weights_ref) == 3 * 5 * 5
+    assert weights == weights_ref
+
+
+@pytest.mark.parametrize("synapse_model", ["static_synapse", "static_synapse_hom_w"])
+@pytest.mark.parametrize("num_threads", THREAD_NUMBERS)
+def test_sorted_spike_delivery_direct_input(synapse_model, num_threads):
+    """
+    Static synapses writing directly into spike input buffers must give identical results.
+
+    Targets include models which receive spikes through their event handler.
+    """
+
+    def simulate(use_sorted_spike_delivery):
+        nest.ResetKernel()
+        nest.local_num_threads = num_threads
+        nest.use_sorted_spike_delivery = use_sorted_spike_delivery
+        nest.min_delay = 0.5
+        nest.max_delay = 4.0
+
+        pre = nest.Create("parrot_neuron", 20)
+        pg = nest.Create("poisson_generator", params={"rate": 100.0})
+        nest.Connect(pg, pre)
+
+        post = (
+            nest.Create("iaf_psc_alpha", 5)
+            + nest.Create("iaf_psc_exp", 5)
+            + nest.Create("iaf_psc_delta", 5)
+            + nest.Create("iaf_cond_alpha", 5)
+        )
+        # excitatory and inhibitory input with the full range of delays
+        for name, weight in [("syn_ex", 30.0), ("syn_in", -20.0)]:
+            nest.CopyModel(synapse_model, name, {"weight": weight})
+            nest.Connect(
+                pre,
+                post,
+                {"rule": "fixed_outdegree", "outdegree": 10},
+                syn_spec={"synapse_model": name, "delay": nest.random.uniform_int(8) * 0.5 + 0.5},
+            )
+
+        # two runs to check that input buffers are registered again
+        nest.Simulate(50.0)
+        nest.Simulate(50.0)
+
+        return post.V_m
+
+    V_m_ref = simulate(False)
+    V_m = simulate(True)
+
+    np.testing.assert_allclose(V_m, V_m_ref, rtol=1e-12)
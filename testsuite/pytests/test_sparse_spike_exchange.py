@@ -0,0 +1,101 @@
+# -*- coding: utf-8 -*-
+#
+# test_sparse_spike_exchange.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+Test exchange of spikes with MPI_Alltoallv.
+
+Sparse spike exchange only changes how spikes are transmitted between ranks,
+so results must be identical to those obtained with fixed-size buffers.
+"""
+
+import nest
+import numpy as np
+import pytest
+
+if nest.ll_api.sli_func("is_threaded"):
+    THREAD_NUMBERS = [1, 2]
+else:
+    THREAD_NUMBERS = [1]
+
+
+def simulate_network(model, use_sparse_spike_exchange, num_threads):
+    nest.ResetKernel()
+    nest.local_num_threads = num_threads
+    nest.use_sparse_spike_exchange = use_sparse_spike_exchange
+
+    pop = nest.Create(model, 50, params={"I_e": 370.0})
+    pg = nest.Create("poisson_generator", params={"rate": 5000.0})
+    sr = nest.Create("spike_recorder")
+
+    nest.Connect(pg, pop, syn_spec={"weight": 10.0})
+    nest.Connect(pop, pop, {"rule": "fixed_indegree", "indegree": 10}, syn_spec={"weight": -40.0, "delay": 1.5})
+    nest.Connect(pop, sr)
+
+    # two runs to check that spikes received at the end of a run are delivered
+    nest.Simulate(50.0)
+    nest.Simulate(50.0)
+
+    return sr.events, pop.V_m
+
+
+@pytest.mark.parametrize("model", ["iaf_psc_alpha", "iaf_psc_exp_ps"])
+@pytest.mark.parametrize("num_threads", THREAD_NUMBERS)
+def test_sparse_spike_exchange_identical_results(model, num_threads):
+    spikes_ref, V_m_ref = simulate_network(model, False, num_threads)
+    spikes, V_m = simulate_network(model, True, num_threads)
+
+    assert len(spikes_ref["times"]) > 0
+    np.testing.assert_array_equal(spikes["senders"], spikes_ref["senders"])
+    np.testing.assert_array_equal(spikes["times"], spikes_ref["times"])
+    np.testing.assert_array_equal(V_m, V_m_ref)
+
+
+def test_sparse_spike_exchange_counts_bytes():
+    nest.ResetKernel()
+    nest.use_sparse_spike_exchange = True
+
+    n = nest.Create("iaf_psc_alpha", 10, params={"I_e": 500.0})
+    nest.Connect(n, n)
+    nest.Simulate(100.0)
+
+    bytes_sent = nest.spike_exchange_bytes_sent
+    assert bytes_sent > 0
+
+    # counters are reset at the beginning of each call to Simulate
+    n.I_e = 0.0
+    nest.Simulate(10.0)
+    assert 0 < nest.spike_exchange_bytes_sent < bytes_sent
+
+
+def test_sparse_spike_exchange_cannot_be_switched_after_simulate():
+    nest.ResetKernel()
+    nest.Simulate(1.0)
+
+    with pytest.raises(nest.kernel.NESTErrors.KernelException):
+        nest.use_sparse_spike_exchange = True
+
+
+def test_sparse_spike_exchange_rejects_pipelining():
+    nest.ResetKernel()
+    nest.set(use_sparse_spike_exchange=True, use_pipelined_spike_exchange=True)
+
+    with pytest.raises(nest.kernel.NESTErrors.KernelException):
+        nest.Simulate(10.0)
@@ -0,0 +1,53 @@
+# -*- coding: utf-8 -*-
+#
+# test_spikes_sent_per_slice_histogram.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+Test the histogram of the number of spikes sent per slice.
+"""
+
+import nest
+import pytest
+
+
+@pytest.mark.parametrize("use_sparse_spike_exchange", [False, True])
+def test_spikes_sent_per_slice_histogram(use_sparse_spike_exchange):
+    """
+    Slices are counted by number of spikes sent, independent of how spikes are exchanged.
+    """
+
+    nest.ResetKernel()
+    nest.use_sparse_spike_exchange = use_sparse_spike_exchange
+
+    sg = nest.Create("spike_generator", params={"spike_times": [1.0, 5.3, 5.6]})
+    parrot = nest.Create("parrot_neuron")
+    neuron = nest.Create("iaf_psc_alpha")
+    nest.Connect(sg, parrot)
+    nest.Connect(parrot, neuron)
+
+    assert nest.min_delay == 1.0
+
+    # the parrot neuron spikes at 2.0 ms, and at 6.3 and 6.6 ms in the same slice
+    nest.Simulate(10.0)
+    assert nest.spikes_sent_per_slice_histogram == [8, 1, 1]
+
+    # the histogram covers only the most recent call to Simulate()
+    nest.Simulate(10.0)
+    assert nest.spikes_sent_per_slice_histogram == [10]
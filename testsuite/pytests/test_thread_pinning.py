@@ -0,0 +1,92 @@
+# -*- coding: utf-8 -*-
+#
+# test_thread_pinning.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+Test pinning of threads to CPUs and reporting of thread placement.
+"""
+
+import os
+import sys
+
+import nest
+import pytest
+
+if nest.ll_api.sli_func("is_threaded"):
+    THREAD_NUMBERS = [1, 2]
+else:
+    THREAD_NUMBERS = [1]
+
+
+@pytest.fixture(autouse=True)
+def reset():
+    nest.ResetKernel()
+    yield
+    nest.ResetKernel()
+
+
+@pytest.mark.parametrize("num_threads", THREAD_NUMBERS)
+def test_thread_placement_reported_for_each_thread(num_threads):
+    nest.local_num_threads = num_threads
+
+    assert not nest.pin_threads
+    assert len(nest.thread_cpus) == num_threads
+    assert len(nest.thread_numa_nodes) == num_threads
+
+
+@pytest.mark.skipif(not sys.platform.startswith("linux"), reason="thread pinning requires Linux")
+@pytest.mark.parametrize("num_threads", THREAD_NUMBERS)
+def test_pinned_threads_run_on_distinct_available_cpus(num_threads):
+    available_cpus = sorted(os.sched_getaffinity(0))
+
+    nest.local_num_threads = num_threads
+    nest.pin_threads = True
+
+    assert nest.pin_threads
+    expected_cpus = [available_cpus[tid % len(available_cpus)] for tid in range(num_threads)]
+    assert nest.thread_cpus == expected_cpus
+
+
+@pytest.mark.skipif(not sys.platform.startswith("linux"), reason="thread pinning requires Linux")
+def test_pinning_survives_change_of_thread_number():
+    available_cpus = sorted(os.sched_getaffinity(0))
+
+    nest.pin_threads = True
+    nest.local_num_threads = THREAD_NUMBERS[-1]
+
+    assert nest.thread_cpus == [available_cpus[tid % len(available_cpus)] for tid in range(THREAD_NUMBERS[-1])]
+
+
+@pytest.mark.skipif(not sys.platform.startswith("linux"), reason="thread pinning requires Linux")
+def test_reset_kernel_unpins_threads():
+    available_cpus = os.sched_getaffinity(0)
+
+    nest.pin_threads = True
+    nest.ResetKernel()
+
+    assert not nest.pin_threads
+    assert os.sched_getaffinity(0) == available_cpus
+
+
+def test_pin_threads_cannot_be_changed_after_nodes_are_created():
+    nest.Create("iaf_psc_alpha")
+
+    with pytest.raises(nest.kernel.NESTError):
+        nest.pin_threads = True